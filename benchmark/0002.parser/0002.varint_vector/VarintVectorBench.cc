@@ -0,0 +1,329 @@
+// VarintVectorBench.cc
+//
+// Micro-benchmark for the LEB128 vector decoding kernel in
+// uwvm2/parser/wasm/utils/varint.h and the local declaration fast path of
+// the code section, on the shapes they are used for:
+//
+// - elem_funcidx_1b : element segment function indices below 2^7,
+//                     every index is a single byte.
+// - elem_funcidx_2b : function indices below 5000, mostly 2-byte
+//                     encodings (large tables of big modules).
+// - br_table        : many short br_table label vectors (1-64 labels)
+//                     with depths below 16.
+// - locals          : local declaration groups (count, value type),
+//                     1-8 groups per function, with an occasional
+//                     multi-byte count.
+//
+// Each scenario is decoded by:
+//
+// - scalar : one `fast_io::mnp::leb128_get` per value plus a bound check,
+//            as the parser did before the kernel;
+// - simd   : `decode_uleb128_vector` (index vectors only);
+// - inline : the single-byte count check of the code section (locals only).
+//            Local groups interleave counts with value types and a function
+//            has only a few of them, so a run scan does not pay off there.
+//
+// Machine-readable output lines look like:
+//
+//   uwvm2_varint scenario=<...> impl=<scalar|simd|inline> values=<...> total_ns=<...>
+//                ns_per_value=<...> avg_bytes_value=<...> gib_per_s=<...>
+//
+// (one line per scenario and implementation).
+//
+// Environment variables:
+//   VALUES : number of values per scenario (default: 1_000_000)
+//   ITERS  : number of outer iterations   (default: 20)
+//
+// Typical standalone build command (from project root):
+//
+//   clang++ benchmark/0002.parser/0002.varint_vector/VarintVectorBench.cc
+//       -o benchmark/0002.parser/0002.varint_vector/VarintVectorBench
+//       -std=c++2c -O3 -march=native
+//       -fno-rtti -fno-unwind-tables -fno-asynchronous-unwind-tables
+//       -I src -I third-parties/fast_io/include
+//
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <random>
+#include <chrono>
+
+#include <uwvm2/parser/wasm/utils/varint.h>
+#include <uwvm2/utils/macro/push_macros.h>
+
+namespace utils = ::uwvm2::parser::wasm::utils;
+
+using u32 = std::uint_least32_t;
+
+enum class scenario_kind
+{
+    index_vectors,
+    locals
+};
+
+struct scenario_config
+{
+    char const* name{};
+    scenario_kind kind{};
+    // Values are drawn from [0, bound).
+    u32 bound{};
+    // Vector lengths are drawn from [min_length, max_length].
+    std::size_t min_length{};
+    std::size_t max_length{};
+};
+
+// Concatenated vectors and the number of values (or local groups) in each.
+struct scenario_data
+{
+    std::vector<std::byte> bytes{};
+    std::vector<std::size_t> lengths{};
+    std::size_t values{};
+};
+
+struct bench_result
+{
+    char const* scenario{};
+    char const* impl{};
+    std::size_t values{};
+    long long total_ns{};
+    double ns_per_value{};
+    double avg_bytes_value{};
+    double gib_per_s{};
+};
+
+static void uleb128_encode_u32(std::vector<std::byte>& out, u32 value)
+{
+    do
+    {
+        std::uint8_t byte{static_cast<std::uint8_t>(value & 0x7Fu)};
+        value >>= 7u;
+        if(value != 0u) { byte = static_cast<std::uint8_t>(byte | 0x80u); }
+        out.push_back(static_cast<std::byte>(byte));
+    }
+    while(value != 0u);
+}
+
+static scenario_data generate(scenario_config const& cfg, std::size_t value_count, std::uint64_t seed)
+{
+    scenario_data data{};
+    data.bytes.reserve(value_count * 2u);
+
+    std::mt19937_64 rng{seed};
+    std::uniform_int_distribution<u32> value_dist{0u, cfg.bound - 1u};
+    std::uniform_int_distribution<std::size_t> length_dist{cfg.min_length, cfg.max_length};
+    // wasm1 value types i32, i64, f32, f64.
+    std::uniform_int_distribution<unsigned> type_dist{0x7Cu, 0x7Fu};
+    std::uniform_int_distribution<unsigned> percent_dist{0u, 99u};
+
+    while(data.values < value_count)
+    {
+        auto const length{length_dist(rng)};
+        data.lengths.push_back(length);
+
+        for(std::size_t i{}; i != length; ++i)
+        {
+            if(cfg.kind == scenario_kind::locals)
+            {
+                // One group in twenty declares more than 127 locals.
+                u32 const count{percent_dist(rng) < 5u ? 128u + value_dist(rng) : value_dist(rng) % 128u};
+                uleb128_encode_u32(data.bytes, count);
+                data.bytes.push_back(static_cast<std::byte>(type_dist(rng)));
+            }
+            else
+            {
+                uleb128_encode_u32(data.bytes, value_dist(rng));
+            }
+        }
+
+        data.values += length;
+    }
+
+    return data;
+}
+
+[[noreturn]] static void bench_fail(char const* what)
+{
+    std::fprintf(stderr, "VarintVectorBench: %s\n", what);
+    std::abort();
+}
+
+// Scalar baseline: one leb128_get per value, as in the parser loops the kernel replaced.
+static u32 scalar_decode_index_vectors(scenario_config const& cfg, scenario_data const& data, std::vector<u32>& out)
+{
+    using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+    auto curr{data.bytes.data()};
+    auto const end{data.bytes.data() + data.bytes.size()};
+    u32 checksum{};
+
+    for(auto const length: data.lengths)
+    {
+        for(std::size_t i{}; i != length; ++i)
+        {
+            u32 value;  // No initialization necessary
+            auto const [next, parse_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                  ::fast_io::mnp::leb128_get(value))};
+            if(parse_err != ::fast_io::parse_code::ok || value >= cfg.bound) [[unlikely]] { bench_fail("scalar decode failed"); }
+            out[i] = value;
+            curr = reinterpret_cast<std::byte const*>(next);
+        }
+        checksum += out[length - 1u];
+    }
+
+    return checksum;
+}
+
+static u32 simd_decode_index_vectors(scenario_config const& cfg, scenario_data const& data, std::vector<u32>& out)
+{
+    auto curr{data.bytes.data()};
+    auto const end{data.bytes.data() + data.bytes.size()};
+    u32 checksum{};
+
+    for(auto const length: data.lengths)
+    {
+        auto const res{utils::decode_uleb128_vector(curr, end, out.data(), length, cfg.bound)};
+        if(res.code != ::fast_io::parse_code::ok) [[unlikely]] { bench_fail("decode_uleb128_vector failed"); }
+        curr = res.curr;
+        checksum += out[length - 1u];
+    }
+
+    return checksum;
+}
+
+// Local declarations, the loop of the code section with and without the single-byte clocal_n fast path.
+template <bool inline_single_byte>
+static u32 decode_locals(scenario_data const& data)
+{
+    using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+    auto curr{data.bytes.data()};
+    auto const end{data.bytes.data() + data.bytes.size()};
+    u32 checksum{};
+
+    for(auto const group_count: data.lengths)
+    {
+        for(std::size_t group{}; group != group_count; ++group)
+        {
+            u32 count;  // No initialization necessary
+            if(inline_single_byte && curr != end && (std::to_integer<unsigned>(*curr) & 0x80u) == 0u)
+            {
+                count = std::to_integer<u32>(*curr);
+                ++curr;
+            }
+            else
+            {
+                auto const [next, parse_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                      reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                      ::fast_io::mnp::leb128_get(count))};
+                if(parse_err != ::fast_io::parse_code::ok) [[unlikely]] { bench_fail("local count decode failed"); }
+                curr = reinterpret_cast<std::byte const*>(next);
+            }
+
+            if(curr == end) [[unlikely]] { bench_fail("missing local type"); }
+            auto const type{std::to_integer<unsigned>(*curr)};
+            if(type < 0x7Cu || type > 0x7Fu) [[unlikely]] { bench_fail("invalid local type"); }
+            ++curr;
+
+            checksum += count + type;
+        }
+    }
+
+    return checksum;
+}
+
+static std::size_t read_env_size(char const* name, std::size_t default_value)
+{
+    if(char const* s = std::getenv(name))
+    {
+        char* end{};
+        unsigned long long v = std::strtoull(s, &end, 10);
+        if(end && *end == '\0' && v > 0) { return static_cast<std::size_t>(v); }
+    }
+    return default_value;
+}
+
+static bench_result run_benchmark(scenario_config const& cfg, scenario_data const& data, bool use_simd, std::size_t iterations)
+{
+    std::size_t max_length{};
+    for(auto const length: data.lengths) { max_length = length > max_length ? length : max_length; }
+    std::vector<u32> out(max_length);
+
+    // Keeps the decode loops from being optimized away and checks both paths agree.
+    static u32 expected_checksum{};
+    u32 checksum{};
+
+    auto const t0{std::chrono::steady_clock::now()};
+
+    for(std::size_t i{}; i != iterations; ++i)
+    {
+        if(cfg.kind == scenario_kind::locals) { checksum = use_simd ? decode_locals<true>(data) : decode_locals<false>(data); }
+        else
+        {
+            checksum = use_simd ? simd_decode_index_vectors(cfg, data, out) : scalar_decode_index_vectors(cfg, data, out);
+        }
+    }
+
+    auto const t1{std::chrono::steady_clock::now()};
+
+    if(!use_simd) { expected_checksum = checksum; }
+    else if(checksum != expected_checksum) { bench_fail("scalar and simd results differ"); }
+
+    long long const total_ns{std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()};
+
+    std::size_t const total_values{data.values * iterations};
+    double const total_bytes{static_cast<double>(data.bytes.size()) * static_cast<double>(iterations)};
+    double const seconds{static_cast<double>(total_ns) * 1e-9};
+
+    bench_result r{};
+    r.scenario = cfg.name;
+    r.impl = !use_simd ? "scalar" : cfg.kind == scenario_kind::locals ? "inline" : "simd";
+    r.values = total_values;
+    r.total_ns = total_ns;
+    r.ns_per_value = static_cast<double>(total_ns) / static_cast<double>(total_values);
+    r.avg_bytes_value = static_cast<double>(data.bytes.size()) / static_cast<double>(data.values);
+    r.gib_per_s = (total_bytes / (1024.0 * 1024.0 * 1024.0)) / seconds;
+    return r;
+}
+
+static void print_bench_result(bench_result const& r)
+{
+    std::printf("uwvm2_varint scenario=%s impl=%s values=%zu total_ns=%lld " "ns_per_value=%.6f avg_bytes_value=%.6f gib_per_s=%.6f\n",
+                r.scenario,
+                r.impl,
+                r.values,
+                static_cast<long long>(r.total_ns),
+                r.ns_per_value,
+                r.avg_bytes_value,
+                r.gib_per_s);
+}
+
+int main()
+{
+    std::size_t const value_count = read_env_size("VALUES", 1'000'000);
+    std::size_t const iterations = read_env_size("ITERS", 20);
+
+    scenario_config const scenarios[]{
+        {"elem_funcidx_1b", scenario_kind::index_vectors, 100u,  256u, 4096u},
+        {"elem_funcidx_2b", scenario_kind::index_vectors, 5000u, 256u, 4096u},
+        {"br_table",        scenario_kind::index_vectors, 16u,   1u,   64u  },
+        {"locals",          scenario_kind::locals,        1000u, 1u,   8u   },
+    };
+
+    std::puts("uwvm2 parser uleb128 vector benchmark");
+    std::printf("  values      = %zu\n", value_count);
+    std::printf("  iterations  = %zu\n", iterations);
+
+    for(auto const& cfg: scenarios)
+    {
+        auto const data{generate(cfg, value_count, 0x1234'5678'9ABC'DEF0ull)};
+
+        print_bench_result(run_benchmark(cfg, data, false, iterations));
+        print_bench_result(run_benchmark(cfg, data, true, iterations));
+    }
+
+    return 0;
+}
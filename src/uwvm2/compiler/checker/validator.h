@@ -0,0 +1,900 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/utils/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::checker
+{
+    /// @brief      Validation of wasm1 function bodies, shared by every execution engine.
+    /// @details    `function_validator_t` checks a body in one pass with an operand stack of value types and a control stack, as described by the
+    ///             validation algorithm of the specification. The same pass records what an engine would otherwise decode again: the types of all
+    ///             locals, the matching `else`/`end` of every block and the maximum operand stack height (`function_side_table_t`).
+    ///
+    ///             The validator and the side table keep their storage between bodies, so once they have grown to the largest body no more memory
+    ///             is allocated. Engines validating on several threads use one of each per thread.
+
+    using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+    using function_type_t = ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t;
+    using wasm_code_t = ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_wasm_code_t;
+
+    /// @brief      Type of an operand whose type does not matter because the code that would consume it is unreachable.
+    inline constexpr value_type unknown_value_type{};
+
+    struct global_type_t
+    {
+        value_type type{};
+        bool is_mutable{};
+    };
+
+    /// @brief      What a function body can refer to in its module, built once per module by `build_module_context`.
+    struct module_context_t
+    {
+        // Type section, used by `call_indirect`.
+        function_type_t const* types{};
+        ::std::size_t type_count{};
+
+        // Function index space (imported functions first).
+        ::uwvm2::utils::container::vector<function_type_t const*> functions{};
+        // Global index space (imported globals first).
+        ::uwvm2::utils::container::vector<global_type_t> globals{};
+
+        bool has_table{};
+        bool has_memory{};
+    };
+
+    /// @brief      Fill `context` with the index spaces of `runtime_module`, whose type section is `[types, types + type_count)`.
+    inline void build_module_context(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t const& runtime_module,
+                                     function_type_t const* types,
+                                     ::std::size_t type_count,
+                                     module_context_t& context) noexcept
+    {
+        context.types = types;
+        context.type_count = type_count;
+
+        context.functions.clear();
+        context.functions.reserve(runtime_module.imported_function_vec_storage.size() + runtime_module.local_defined_function_vec_storage.size());
+        for(auto const& imported: runtime_module.imported_function_vec_storage)
+        {
+            context.functions.push_back_unchecked(imported.import_type_ptr->imports.storage.function);
+        }
+        for(auto const& defined: runtime_module.local_defined_function_vec_storage) { context.functions.push_back_unchecked(defined.function_type_ptr); }
+
+        context.globals.clear();
+        context.globals.reserve(runtime_module.imported_global_vec_storage.size() + runtime_module.local_defined_global_vec_storage.size());
+        for(auto const& imported: runtime_module.imported_global_vec_storage)
+        {
+            auto const& global{imported.import_type_ptr->imports.storage.global};
+            context.globals.push_back_unchecked({global.type, global.is_mutable});
+        }
+        for(auto const& defined: runtime_module.local_defined_global_vec_storage)
+        {
+            context.globals.push_back_unchecked({defined.global_type_ptr->type, defined.global_type_ptr->is_mutable});
+        }
+
+        context.has_table = !runtime_module.imported_table_vec_storage.empty() || !runtime_module.local_defined_table_vec_storage.empty();
+        context.has_memory = !runtime_module.imported_memory_vec_storage.empty() || !runtime_module.local_defined_memory_vec_storage.empty();
+    }
+
+    /// @brief      A `block`, `loop` or `if` of a validated body. Offsets are relative to `code_body_t::expr_begin`.
+    /// @details    A branch to a `loop` continues at `begin`, a branch to any other block after its `end`. A false `if` condition continues after
+    ///             `else_` if there is one, after `end` otherwise.
+    struct block_entry_t
+    {
+        ::std::uint_least32_t begin{};
+        ::std::uint_least32_t else_{no_else};
+        ::std::uint_least32_t end{};
+
+        inline static constexpr ::std::uint_least32_t no_else{::std::numeric_limits<::std::uint_least32_t>::max()};
+    };
+
+    /// @brief      What the validation of a body found out, for the engine that runs it.
+    struct function_side_table_t
+    {
+        // Parameters followed by the declared locals.
+        ::uwvm2::utils::container::vector<value_type> local_types{};
+        // Every block of the body in the order of its opening instruction, so sorted by `block_entry_t::begin`.
+        ::uwvm2::utils::container::vector<block_entry_t> blocks{};
+        // In values, over the whole function.
+        ::std::size_t max_stack_height{};
+        // Including the function itself.
+        ::std::size_t max_control_depth{};
+        ::std::size_t instruction_count{};
+    };
+
+    struct validation_error_t
+    {
+        // The instruction that failed.
+        ::std::byte const* err_curr{};
+        ::uwvm2::utils::container::u8string_view message{};
+    };
+
+    namespace details
+    {
+        /// @brief      Operand and result types of a numeric instruction (0x45 to 0xbf), `arity` is 0 for other opcodes.
+        struct numeric_signature_t
+        {
+            value_type operand{};
+            value_type result{};
+            ::std::uint_least8_t arity{};
+        };
+
+        /// @brief      Value type and natural alignment (log2) of a load or store (0x28 to 0x3e).
+        struct memory_access_t
+        {
+            value_type type{};
+            ::std::uint_least32_t max_align{};
+        };
+
+        struct signature_table_t
+        {
+            numeric_signature_t numeric[256u]{};
+            memory_access_t memory[256u]{};
+        };
+
+        inline consteval signature_table_t get_signature_table() noexcept
+        {
+            constexpr auto i32{value_type::i32};
+            constexpr auto i64{value_type::i64};
+            constexpr auto f32{value_type::f32};
+            constexpr auto f64{value_type::f64};
+
+            signature_table_t table{};
+            auto const set{[&table](unsigned first, unsigned last, value_type operand, value_type result, ::std::uint_least8_t arity) constexpr noexcept
+                           {
+                               for(unsigned op{first}; op <= last; ++op) { table.numeric[op] = {operand, result, arity}; }
+                           }};
+
+            set(0x45u, 0x45u, i32, i32, 1u);  // i32.eqz
+            set(0x46u, 0x4fu, i32, i32, 2u);  // i32 comparisons
+            set(0x50u, 0x50u, i64, i32, 1u);  // i64.eqz
+            set(0x51u, 0x5au, i64, i32, 2u);  // i64 comparisons
+            set(0x5bu, 0x60u, f32, i32, 2u);  // f32 comparisons
+            set(0x61u, 0x66u, f64, i32, 2u);  // f64 comparisons
+            set(0x67u, 0x69u, i32, i32, 1u);  // i32.clz, ctz, popcnt
+            set(0x6au, 0x78u, i32, i32, 2u);  // i32 arithmetic
+            set(0x79u, 0x7bu, i64, i64, 1u);  // i64.clz, ctz, popcnt
+            set(0x7cu, 0x8au, i64, i64, 2u);  // i64 arithmetic
+            set(0x8bu, 0x91u, f32, f32, 1u);  // f32.abs to f32.sqrt
+            set(0x92u, 0x98u, f32, f32, 2u);  // f32 arithmetic
+            set(0x99u, 0x9fu, f64, f64, 1u);  // f64.abs to f64.sqrt
+            set(0xa0u, 0xa6u, f64, f64, 2u);  // f64 arithmetic
+            set(0xa7u, 0xa7u, i64, i32, 1u);  // i32.wrap_i64
+            set(0xa8u, 0xa9u, f32, i32, 1u);  // i32.trunc_f32
+            set(0xaau, 0xabu, f64, i32, 1u);  // i32.trunc_f64
+            set(0xacu, 0xadu, i32, i64, 1u);  // i64.extend_i32
+            set(0xaeu, 0xafu, f32, i64, 1u);  // i64.trunc_f32
+            set(0xb0u, 0xb1u, f64, i64, 1u);  // i64.trunc_f64
+            set(0xb2u, 0xb3u, i32, f32, 1u);  // f32.convert_i32
+            set(0xb4u, 0xb5u, i64, f32, 1u);  // f32.convert_i64
+            set(0xb6u, 0xb6u, f64, f32, 1u);  // f32.demote_f64
+            set(0xb7u, 0xb8u, i32, f64, 1u);  // f64.convert_i32
+            set(0xb9u, 0xbau, i64, f64, 1u);  // f64.convert_i64
+            set(0xbbu, 0xbbu, f32, f64, 1u);  // f64.promote_f32
+            set(0xbcu, 0xbcu, f32, i32, 1u);  // i32.reinterpret_f32
+            set(0xbdu, 0xbdu, f64, i64, 1u);  // i64.reinterpret_f64
+            set(0xbeu, 0xbeu, i32, f32, 1u);  // f32.reinterpret_i32
+            set(0xbfu, 0xbfu, i64, f64, 1u);  // f64.reinterpret_i64
+
+            table.memory[0x28u] = {i32, 2u};  // i32.load
+            table.memory[0x29u] = {i64, 3u};  // i64.load
+            table.memory[0x2au] = {f32, 2u};  // f32.load
+            table.memory[0x2bu] = {f64, 3u};  // f64.load
+            table.memory[0x2cu] = {i32, 0u};  // i32.load8_s
+            table.memory[0x2du] = {i32, 0u};  // i32.load8_u
+            table.memory[0x2eu] = {i32, 1u};  // i32.load16_s
+            table.memory[0x2fu] = {i32, 1u};  // i32.load16_u
+            table.memory[0x30u] = {i64, 0u};  // i64.load8_s
+            table.memory[0x31u] = {i64, 0u};  // i64.load8_u
+            table.memory[0x32u] = {i64, 1u};  // i64.load16_s
+            table.memory[0x33u] = {i64, 1u};  // i64.load16_u
+            table.memory[0x34u] = {i64, 2u};  // i64.load32_s
+            table.memory[0x35u] = {i64, 2u};  // i64.load32_u
+            table.memory[0x36u] = {i32, 2u};  // i32.store
+            table.memory[0x37u] = {i64, 3u};  // i64.store
+            table.memory[0x38u] = {f32, 2u};  // f32.store
+            table.memory[0x39u] = {f64, 3u};  // f64.store
+            table.memory[0x3au] = {i32, 0u};  // i32.store8
+            table.memory[0x3bu] = {i32, 1u};  // i32.store16
+            table.memory[0x3cu] = {i64, 0u};  // i64.store8
+            table.memory[0x3du] = {i64, 1u};  // i64.store16
+            table.memory[0x3eu] = {i64, 2u};  // i64.store32
+
+            return table;
+        }
+
+        inline constexpr signature_table_t signature_table{get_signature_table()};
+
+        /// @brief      Result types of the wasm1 block types that have one, a block type points into this array.
+        inline constexpr value_type single_value_types[4u]{value_type::i32, value_type::i64, value_type::f32, value_type::f64};
+
+        enum class control_frame_kind : unsigned
+        {
+            function,
+            block,
+            loop,
+            if_,
+            else_
+        };
+
+        struct control_frame_t
+        {
+            value_type const* result_begin{};
+            value_type const* result_end{};
+            // Operand stack height when the frame was entered.
+            ::std::size_t height{};
+            // Entry of the frame in `function_side_table_t::blocks`, unused for the function frame.
+            ::std::size_t block_index{};
+            control_frame_kind kind{};
+            // The rest of the frame is unreachable, its operand stack is polymorphic.
+            bool unreachable{};
+        };
+
+        using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+    }  // namespace details
+
+    /// @brief      Validates wasm1 function bodies, see the namespace description. Not thread-safe, keep one per thread.
+    struct function_validator_t
+    {
+        ::uwvm2::utils::container::vector<value_type> operands{};
+        ::uwvm2::utils::container::vector<details::control_frame_t> frames{};
+        // Labels of the current br_table, decoded at once.
+        ::uwvm2::utils::container::vector<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32> br_table_labels{};
+
+        /// @brief      Validate `code`, the body of a function of type `type` in the module described by `module`.
+        /// @return     false with `error` set if the body is invalid, `side_table` is then incomplete.
+        inline bool validate(module_context_t const& module,
+                             function_type_t const& type,
+                             wasm_code_t const& code,
+                             function_side_table_t& side_table,
+                             validation_error_t& error) noexcept
+        {
+            this->module_ptr = ::std::addressof(module);
+            this->side_table_ptr = ::std::addressof(side_table);
+            this->error_ptr = ::std::addressof(error);
+            this->expr_begin = code.body.expr_begin;
+            this->curr = code.body.expr_begin;
+            this->end = code.body.code_end;
+            this->op_begin = code.body.expr_begin;
+
+            this->operands.clear();
+            this->frames.clear();
+            side_table.blocks.clear();
+            side_table.max_stack_height = 0uz;
+            side_table.max_control_depth = 0uz;
+            side_table.instruction_count = 0uz;
+
+            if(!this->collect_local_types(type, code)) { return false; }
+
+            // Offsets into the body are stored as 32 bits.
+            if(static_cast<::std::size_t>(this->end - this->expr_begin) > static_cast<::std::size_t>(::std::numeric_limits<::std::uint_least32_t>::max()))
+                [[unlikely]]
+            {
+                return this->fail(u8"function body too large");
+            }
+
+            this->push_frame(details::control_frame_kind::function, type.result.begin, type.result.end);
+            return this->validate_instructions();
+        }
+
+    private:
+        module_context_t const* module_ptr{};
+        function_side_table_t* side_table_ptr{};
+        validation_error_t* error_ptr{};
+
+        details::wasm_byte_const_may_alias_ptr expr_begin{};
+        details::wasm_byte_const_may_alias_ptr curr{};
+        details::wasm_byte_const_may_alias_ptr end{};
+        details::wasm_byte_const_may_alias_ptr op_begin{};
+
+        inline bool fail(::uwvm2::utils::container::u8string_view message) noexcept
+        {
+            this->error_ptr->err_curr = reinterpret_cast<::std::byte const*>(this->op_begin);
+            this->error_ptr->message = message;
+            return false;
+        }
+
+        inline bool collect_local_types(function_type_t const& type, wasm_code_t const& code) noexcept
+        {
+            auto& local_types{this->side_table_ptr->local_types};
+
+            auto const param_count{static_cast<::std::size_t>(type.parameter.end - type.parameter.begin)};
+            auto const local_count{param_count + static_cast<::std::size_t>(code.all_local_count)};
+            local_types.clear();
+            local_types.reserve(local_count);
+
+            for(auto param{type.parameter.begin}; param != type.parameter.end; ++param) { local_types.push_back_unchecked(static_cast<value_type>(*param)); }
+
+            for(auto const& entry: code.locals)
+            {
+                // The parser has checked that the counts add up to `all_local_count`.
+                for(::std::uint_least32_t i{}; i != entry.count; ++i) { local_types.push_back_unchecked(static_cast<value_type>(entry.type)); }
+            }
+
+            return true;
+        }
+
+        inline bool read_byte(::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte& byte) noexcept
+        {
+            if(this->curr == this->end) [[unlikely]] { return this->fail(u8"unexpected end of the function body"); }
+            byte = *this->curr++;
+            return true;
+        }
+
+        template <typename T>
+        inline bool read_leb128(T& value) noexcept
+        {
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            auto const [next, err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(this->curr),
+                                                            reinterpret_cast<char8_t_const_may_alias_ptr>(this->end),
+                                                            ::fast_io::mnp::leb128_get(value))};
+            if(err != ::fast_io::parse_code::ok) [[unlikely]] { return this->fail(u8"invalid LEB128 immediate"); }
+            this->curr = reinterpret_cast<details::wasm_byte_const_may_alias_ptr>(next);
+            return true;
+        }
+
+        inline bool skip_bytes(::std::size_t n) noexcept
+        {
+            if(static_cast<::std::size_t>(this->end - this->curr) < n) [[unlikely]] { return this->fail(u8"unexpected end of the function body"); }
+            this->curr += n;
+            return true;
+        }
+
+        inline bool read_reserved_zero_byte() noexcept
+        {
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte byte;  // No initialization necessary
+            if(!this->read_byte(byte)) [[unlikely]] { return false; }
+            if(byte != 0u) [[unlikely]] { return this->fail(u8"reserved byte must be zero"); }
+            return true;
+        }
+
+        inline ::std::uint_least32_t get_offset(details::wasm_byte_const_may_alias_ptr ptr) const noexcept
+        { return static_cast<::std::uint_least32_t>(ptr - this->expr_begin); }
+
+        inline void push(value_type type) noexcept
+        {
+            this->operands.push_back(type);
+            if(this->operands.size() > this->side_table_ptr->max_stack_height) { this->side_table_ptr->max_stack_height = this->operands.size(); }
+        }
+
+        /// @brief      Pop an operand of type `expected`, or of any type if `expected` is `unknown_value_type`.
+        inline bool pop(value_type expected, value_type& actual) noexcept
+        {
+            auto const& frame{this->frames.back_unchecked()};
+            if(this->operands.size() == frame.height)
+            {
+                if(frame.unreachable)
+                {
+                    actual = expected;
+                    return true;
+                }
+                return this->fail(u8"operand stack underflow");
+            }
+
+            actual = this->operands.back_unchecked();
+            this->operands.pop_back_unchecked();
+            if(actual != expected && actual != unknown_value_type && expected != unknown_value_type) [[unlikely]] { return this->fail(u8"type mismatch"); }
+            return true;
+        }
+
+        inline bool pop(value_type expected) noexcept
+        {
+            value_type actual;  // No initialization necessary
+            return this->pop(expected, actual);
+        }
+
+        inline bool pop_types(value_type const* begin, value_type const* end) noexcept
+        {
+            for(auto type{end}; type != begin;)
+            {
+                if(!this->pop(*--type)) [[unlikely]] { return false; }
+            }
+            return true;
+        }
+
+        template <typename T>
+        inline bool pop_types_of(T const* begin, T const* end) noexcept
+        {
+            for(auto type{end}; type != begin;)
+            {
+                if(!this->pop(static_cast<value_type>(*--type))) [[unlikely]] { return false; }
+            }
+            return true;
+        }
+
+        template <typename T>
+        inline void push_types_of(T const* begin, T const* end) noexcept
+        {
+            for(auto type{begin}; type != end; ++type) { this->push(static_cast<value_type>(*type)); }
+        }
+
+        template <typename T>
+        inline void push_frame(details::control_frame_kind kind, T const* result_begin, T const* result_end) noexcept
+        {
+            static_assert(sizeof(T) == sizeof(value_type));
+
+            details::control_frame_t frame{};
+            frame.result_begin = reinterpret_cast<value_type const*>(result_begin);
+            frame.result_end = reinterpret_cast<value_type const*>(result_end);
+            frame.height = this->operands.size();
+            frame.kind = kind;
+
+            if(kind != details::control_frame_kind::function)
+            {
+                frame.block_index = this->side_table_ptr->blocks.size();
+                this->side_table_ptr->blocks.push_back({this->get_offset(this->op_begin), block_entry_t::no_else, 0u});
+            }
+
+            this->frames.push_back(frame);
+            if(this->frames.size() > this->side_table_ptr->max_control_depth) { this->side_table_ptr->max_control_depth = this->frames.size(); }
+        }
+
+        inline void set_unreachable() noexcept
+        {
+            auto& frame{this->frames.back_unchecked()};
+            this->operands.resize(frame.height);
+            frame.unreachable = true;
+        }
+
+        /// @brief      The operand stack of the innermost frame must hold exactly its results.
+        inline bool check_frame_results(::uwvm2::utils::container::u8string_view message) noexcept
+        {
+            auto const& frame{this->frames.back_unchecked()};
+            if(!this->pop_types(frame.result_begin, frame.result_end)) [[unlikely]] { return false; }
+            if(this->operands.size() != frame.height) [[unlikely]] { return this->fail(message); }
+            return true;
+        }
+
+        /// @brief      wasm1 block types are either empty (0x40) or a single value type.
+        inline bool read_block_type(value_type const*& result_begin, value_type const*& result_end) noexcept
+        {
+            using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+
+            wasm_byte byte;  // No initialization necessary
+            if(!this->read_byte(byte)) [[unlikely]] { return false; }
+
+            ::std::size_t index{};
+            switch(byte)
+            {
+                case static_cast<wasm_byte>(0x40u):
+                {
+                    result_begin = details::single_value_types;
+                    result_end = details::single_value_types;
+                    return true;
+                }
+                case static_cast<wasm_byte>(value_type::i32):
+                {
+                    index = 0uz;
+                    break;
+                }
+                case static_cast<wasm_byte>(value_type::i64):
+                {
+                    index = 1uz;
+                    break;
+                }
+                case static_cast<wasm_byte>(value_type::f32):
+                {
+                    index = 2uz;
+                    break;
+                }
+                case static_cast<wasm_byte>(value_type::f64):
+                {
+                    index = 3uz;
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    return this->fail(u8"invalid block type");
+                }
+            }
+
+            result_begin = details::single_value_types + index;
+            result_end = result_begin + 1u;
+            return true;
+        }
+
+        /// @brief      Frame that `depth` refers to. Branches to a loop carry no values in wasm1, branches to any other frame carry its results.
+        inline bool get_label(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 depth,
+                              value_type const*& label_begin,
+                              value_type const*& label_end) noexcept
+        {
+            if(static_cast<::std::size_t>(depth) >= this->frames.size()) [[unlikely]] { return this->fail(u8"invalid label index"); }
+            auto const& frame{this->frames.index_unchecked(this->frames.size() - 1uz - static_cast<::std::size_t>(depth))};
+            label_begin = frame.result_begin;
+            label_end = frame.kind == details::control_frame_kind::loop ? frame.result_begin : frame.result_end;
+            return true;
+        }
+
+        inline bool require_memory() noexcept
+        {
+            if(!this->module_ptr->has_memory) [[unlikely]] { return this->fail(u8"memory instruction in a module without memory"); }
+            return true;
+        }
+
+        inline bool validate_memory_access(::std::uint_least8_t op, bool is_store) noexcept
+        {
+            using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+
+            if(!this->require_memory()) [[unlikely]] { return false; }
+
+            auto const& access{details::signature_table.memory[op]};
+            wasm_u32 align;   // No initialization necessary
+            wasm_u32 offset;  // No initialization necessary
+            if(!this->read_leb128(align) || !this->read_leb128(offset)) [[unlikely]] { return false; }
+            if(align > access.max_align) [[unlikely]] { return this->fail(u8"alignment must not be larger than natural"); }
+
+            if(is_store)
+            {
+                if(!this->pop(access.type) || !this->pop(value_type::i32)) [[unlikely]] { return false; }
+            }
+            else
+            {
+                if(!this->pop(value_type::i32)) [[unlikely]] { return false; }
+                this->push(access.type);
+            }
+            return true;
+        }
+
+        inline bool validate_end() noexcept
+        {
+            auto const& frame{this->frames.back_unchecked()};
+            if(!this->check_frame_results(u8"operand stack height does not match the block type at end")) [[unlikely]] { return false; }
+            if(frame.kind == details::control_frame_kind::if_ && frame.result_begin != frame.result_end) [[unlikely]]
+            {
+                return this->fail(u8"if with a result requires an else arm");
+            }
+
+            auto const result_begin{frame.result_begin};
+            auto const result_end{frame.result_end};
+            if(frame.kind != details::control_frame_kind::function)
+            {
+                this->side_table_ptr->blocks.index_unchecked(frame.block_index).end = this->get_offset(this->op_begin);
+            }
+            this->frames.pop_back_unchecked();
+
+            if(this->frames.empty())
+            {
+                if(this->curr != this->end) [[unlikely]] { return this->fail(u8"unexpected bytes after the end of the function body"); }
+                return true;
+            }
+
+            this->push_types_of(result_begin, result_end);
+            return true;
+        }
+
+        inline bool validate_instructions() noexcept
+        {
+            using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+            using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+            using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+            using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+            using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+
+            auto& side_table{*this->side_table_ptr};
+
+            for(;;)
+            {
+                this->op_begin = this->curr;
+                wasm_byte byte;  // No initialization necessary
+                if(!this->read_byte(byte)) [[unlikely]] { return false; }
+                ++side_table.instruction_count;
+
+                switch(static_cast<op_basic>(byte))
+                {
+                    case op_basic::unreachable:
+                    {
+                        this->set_unreachable();
+                        break;
+                    }
+                    case op_basic::nop:
+                    {
+                        break;
+                    }
+                    case op_basic::block: [[fallthrough]];
+                    case op_basic::loop: [[fallthrough]];
+                    case op_basic::if_:
+                    {
+                        value_type const* result_begin;  // No initialization necessary
+                        value_type const* result_end;    // No initialization necessary
+                        if(!this->read_block_type(result_begin, result_end)) [[unlikely]] { return false; }
+
+                        auto kind{details::control_frame_kind::block};
+                        if(static_cast<op_basic>(byte) == op_basic::loop) { kind = details::control_frame_kind::loop; }
+                        else if(static_cast<op_basic>(byte) == op_basic::if_)
+                        {
+                            if(!this->pop(value_type::i32)) [[unlikely]] { return false; }
+                            kind = details::control_frame_kind::if_;
+                        }
+
+                        this->push_frame(kind, result_begin, result_end);
+                        break;
+                    }
+                    case op_basic::else_:
+                    {
+                        if(this->frames.back_unchecked().kind != details::control_frame_kind::if_) [[unlikely]]
+                        {
+                            return this->fail(u8"else without a matching if");
+                        }
+                        if(!this->check_frame_results(u8"operand stack height does not match the block type at else")) [[unlikely]] { return false; }
+
+                        auto& frame{this->frames.back_unchecked()};
+                        side_table.blocks.index_unchecked(frame.block_index).else_ = this->get_offset(this->op_begin);
+                        frame.kind = details::control_frame_kind::else_;
+                        frame.unreachable = false;
+                        break;
+                    }
+                    case op_basic::end:
+                    {
+                        if(!this->validate_end()) [[unlikely]] { return false; }
+                        if(this->frames.empty()) { return true; }
+                        break;
+                    }
+                    case op_basic::br: [[fallthrough]];
+                    case op_basic::br_if:
+                    {
+                        wasm_u32 depth;                 // No initialization necessary
+                        value_type const* label_begin;  // No initialization necessary
+                        value_type const* label_end;    // No initialization necessary
+                        if(!this->read_leb128(depth) || !this->get_label(depth, label_begin, label_end)) [[unlikely]] { return false; }
+
+                        if(static_cast<op_basic>(byte) == op_basic::br)
+                        {
+                            if(!this->pop_types(label_begin, label_end)) [[unlikely]] { return false; }
+                            this->set_unreachable();
+                        }
+                        else
+                        {
+                            if(!this->pop(value_type::i32) || !this->pop_types(label_begin, label_end)) [[unlikely]] { return false; }
+                            this->push_types_of(label_begin, label_end);
+                        }
+                        break;
+                    }
+                    case op_basic::br_table:
+                    {
+                        wasm_u32 count;  // No initialization necessary
+                        if(!this->read_leb128(count)) [[unlikely]] { return false; }
+                        // Every label takes at least one byte.
+                        if(static_cast<::std::size_t>(count) >= static_cast<::std::size_t>(this->end - this->curr)) [[unlikely]]
+                        {
+                            return this->fail(u8"br_table label count exceeds the function body");
+                        }
+
+                        // Decode all labels in one pass, each one must refer to an enclosing frame. Every frame starts at its own byte of a body whose
+                        // size fits 32 bits, so does the frame count.
+                        auto const label_count{static_cast<::std::size_t>(count) + 1uz};
+                        auto const label_bound{static_cast<wasm_u32>(this->frames.size())};
+
+                        this->br_table_labels.resize(label_count);
+                        auto const labels{this->br_table_labels.data()};
+
+                        auto const labels_res{::uwvm2::parser::wasm::utils::decode_uleb128_vector(reinterpret_cast<::std::byte const*>(this->curr),
+                                                                                                  reinterpret_cast<::std::byte const*>(this->end),
+                                                                                                  labels,
+                                                                                                  label_count,
+                                                                                                  label_bound)};
+                        if(labels_res.code != ::fast_io::parse_code::ok) [[unlikely]]
+                        {
+                            if(labels_res.out_of_bound) { return this->fail(u8"invalid label index"); }
+                            return this->fail(u8"invalid LEB128 immediate");
+                        }
+                        this->curr = reinterpret_cast<details::wasm_byte_const_may_alias_ptr>(labels_res.curr);
+
+                        // All labels must carry the same types, the default label is last.
+                        value_type const* default_begin;  // No initialization necessary
+                        value_type const* default_end;    // No initialization necessary
+                        if(!this->get_label(labels[count], default_begin, default_end)) [[unlikely]] { return false; }
+
+                        for(wasm_u32 i{}; i != count; ++i)
+                        {
+                            value_type const* label_begin;  // No initialization necessary
+                            value_type const* label_end;    // No initialization necessary
+                            if(!this->get_label(labels[i], label_begin, label_end)) [[unlikely]] { return false; }
+
+                            auto const arity{static_cast<::std::size_t>(label_end - label_begin)};
+                            if(arity != static_cast<::std::size_t>(default_end - default_begin)) [[unlikely]]
+                            {
+                                return this->fail(u8"br_table labels have inconsistent types");
+                            }
+                            for(::std::size_t k{}; k != arity; ++k)
+                            {
+                                if(label_begin[k] != default_begin[k]) [[unlikely]] { return this->fail(u8"br_table labels have inconsistent types"); }
+                            }
+                        }
+
+                        if(!this->pop(value_type::i32) || !this->pop_types(default_begin, default_end)) [[unlikely]] { return false; }
+                        this->set_unreachable();
+                        break;
+                    }
+                    case op_basic::return_:
+                    {
+                        auto const& function_frame{this->frames.front_unchecked()};
+                        if(!this->pop_types(function_frame.result_begin, function_frame.result_end)) [[unlikely]] { return false; }
+                        this->set_unreachable();
+                        break;
+                    }
+                    case op_basic::call:
+                    {
+                        wasm_u32 index;  // No initialization necessary
+                        if(!this->read_leb128(index)) [[unlikely]] { return false; }
+                        if(static_cast<::std::size_t>(index) >= this->module_ptr->functions.size()) [[unlikely]]
+                        {
+                            return this->fail(u8"invalid function index");
+                        }
+
+                        auto const callee_type{this->module_ptr->functions.index_unchecked(static_cast<::std::size_t>(index))};
+                        if(!this->pop_types_of(callee_type->parameter.begin, callee_type->parameter.end)) [[unlikely]] { return false; }
+                        this->push_types_of(callee_type->result.begin, callee_type->result.end);
+                        break;
+                    }
+                    case op_basic::call_indirect:
+                    {
+                        wasm_u32 type_index;  // No initialization necessary
+                        if(!this->read_leb128(type_index) || !this->read_reserved_zero_byte()) [[unlikely]] { return false; }
+                        if(!this->module_ptr->has_table) [[unlikely]] { return this->fail(u8"call_indirect in a module without table"); }
+                        if(static_cast<::std::size_t>(type_index) >= this->module_ptr->type_count) [[unlikely]] { return this->fail(u8"invalid type index"); }
+
+                        auto const& callee_type{this->module_ptr->types[type_index]};
+                        if(!this->pop(value_type::i32) || !this->pop_types_of(callee_type.parameter.begin, callee_type.parameter.end)) [[unlikely]]
+                        {
+                            return false;
+                        }
+                        this->push_types_of(callee_type.result.begin, callee_type.result.end);
+                        break;
+                    }
+                    case op_basic::drop:
+                    {
+                        if(!this->pop(unknown_value_type)) [[unlikely]] { return false; }
+                        break;
+                    }
+                    case op_basic::select:
+                    {
+                        value_type first;   // No initialization necessary
+                        value_type second;  // No initialization necessary
+                        if(!this->pop(value_type::i32) || !this->pop(unknown_value_type, second) || !this->pop(unknown_value_type, first)) [[unlikely]]
+                        {
+                            return false;
+                        }
+                        if(first != second && first != unknown_value_type && second != unknown_value_type) [[unlikely]]
+                        {
+                            return this->fail(u8"type mismatch");
+                        }
+                        this->push(first == unknown_value_type ? second : first);
+                        break;
+                    }
+                    case op_basic::local_get: [[fallthrough]];
+                    case op_basic::local_set: [[fallthrough]];
+                    case op_basic::local_tee:
+                    {
+                        wasm_u32 index;  // No initialization necessary
+                        if(!this->read_leb128(index)) [[unlikely]] { return false; }
+                        if(static_cast<::std::size_t>(index) >= side_table.local_types.size()) [[unlikely]] { return this->fail(u8"invalid local index"); }
+
+                        auto const local_type{side_table.local_types.index_unchecked(static_cast<::std::size_t>(index))};
+                        if(static_cast<op_basic>(byte) != op_basic::local_get)
+                        {
+                            if(!this->pop(local_type)) [[unlikely]] { return false; }
+                        }
+                        if(static_cast<op_basic>(byte) != op_basic::local_set) { this->push(local_type); }
+                        break;
+                    }
+                    case op_basic::global_get: [[fallthrough]];
+                    case op_basic::global_set:
+                    {
+                        wasm_u32 index;  // No initialization necessary
+                        if(!this->read_leb128(index)) [[unlikely]] { return false; }
+                        if(static_cast<::std::size_t>(index) >= this->module_ptr->globals.size()) [[unlikely]] { return this->fail(u8"invalid global index"); }
+
+                        auto const global{this->module_ptr->globals.index_unchecked(static_cast<::std::size_t>(index))};
+                        if(static_cast<op_basic>(byte) == op_basic::global_get) { this->push(global.type); }
+                        else
+                        {
+                            if(!global.is_mutable) [[unlikely]] { return this->fail(u8"global.set on an immutable global"); }
+                            if(!this->pop(global.type)) [[unlikely]] { return false; }
+                        }
+                        break;
+                    }
+                    case op_basic::memory_size: [[fallthrough]];
+                    case op_basic::memory_grow:
+                    {
+                        if(!this->read_reserved_zero_byte() || !this->require_memory()) [[unlikely]] { return false; }
+                        if(static_cast<op_basic>(byte) == op_basic::memory_grow)
+                        {
+                            if(!this->pop(value_type::i32)) [[unlikely]] { return false; }
+                        }
+                        this->push(value_type::i32);
+                        break;
+                    }
+                    case op_basic::i32_const:
+                    {
+                        wasm_i32 value;  // No initialization necessary
+                        if(!this->read_leb128(value)) [[unlikely]] { return false; }
+                        this->push(value_type::i32);
+                        break;
+                    }
+                    case op_basic::i64_const:
+                    {
+                        wasm_i64 value;  // No initialization necessary
+                        if(!this->read_leb128(value)) [[unlikely]] { return false; }
+                        this->push(value_type::i64);
+                        break;
+                    }
+                    case op_basic::f32_const:
+                    {
+                        if(!this->skip_bytes(4uz)) [[unlikely]] { return false; }
+                        this->push(value_type::f32);
+                        break;
+                    }
+                    case op_basic::f64_const:
+                    {
+                        if(!this->skip_bytes(8uz)) [[unlikely]] { return false; }
+                        this->push(value_type::f64);
+                        break;
+                    }
+                    default:
+                    {
+                        auto const op{static_cast<::std::uint_least8_t>(byte)};
+                        if(op >= static_cast<::std::uint_least8_t>(op_basic::i32_load) && op <= static_cast<::std::uint_least8_t>(op_basic::i64_store32))
+                        {
+                            if(!this->validate_memory_access(op, op >= static_cast<::std::uint_least8_t>(op_basic::i32_store))) [[unlikely]] { return false; }
+                            break;
+                        }
+
+                        auto const& signature{details::signature_table.numeric[op]};
+                        if(signature.arity == 0u) [[unlikely]] { return this->fail(u8"unsupported opcode"); }
+                        for(::std::uint_least8_t i{}; i != signature.arity; ++i)
+                        {
+                            if(!this->pop(signature.operand)) [[unlikely]] { return false; }
+                        }
+                        this->push(signature.result);
+                        break;
+                    }
+                }
+            }
+        }
+    };
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
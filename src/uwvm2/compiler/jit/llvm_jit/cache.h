@@ -0,0 +1,139 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# include <llvm/ADT/SmallString.h>
+# include <llvm/ADT/StringRef.h>
+# include <llvm/ExecutionEngine/ObjectCache.h>
+# include <llvm/IR/Module.h>
+# include <llvm/Support/FileSystem.h>
+# include <llvm/Support/Format.h>
+# include <llvm/Support/MemoryBuffer.h>
+# include <llvm/Support/Path.h>
+# include <llvm/Support/raw_ostream.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/hash/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::jit::llvm_jit
+{
+    /// @brief      On-disk cache of generated object code, so that a later run of the same module links the objects instead of compiling again.
+    /// @details    The object of a defined function is stored as `<directory>/<key>-<defined index>.o`. The key is the xxh3 hash of the module bytes,
+    ///             seeded with the configuration of the engine (uwvm and LLVM versions, target, CPU features, OSR entries) and with what the lowering
+    ///             branched on: the kinds of the function and global bindings and whether the memory elides bounds checks. Everything else of this
+    ///             process is reached through symbols defined when the object is linked, see `runtime::symbol`.
+    ///
+    ///             Only the objects are cached. The translated bodies of uwvm-int hold handler, binding and branch target addresses of the running
+    ///             process, and translating them again is a linear pass that doubles as the validation of the bodies.
+    namespace details
+    {
+        /// @brief      Bumped whenever the generated code or its symbols change meaning.
+        inline constexpr ::std::uint_least32_t code_cache_format_version{1u};
+
+        /// @brief      Cache key of `module`, `configuration` describes the engine.
+        inline ::std::uint_least64_t get_code_cache_key(::uwvm2::compiler::uwvm_int::compiled_module_t const& module,
+                                                        ::llvm::StringRef configuration) noexcept
+        {
+            ::std::string seed_bytes{configuration.str()};
+            seed_bytes.reserve(seed_bytes.size() + module.function_index_space.size() + module.globals.size() + 1uz);
+            for(auto const& callee: module.function_index_space) { seed_bytes.push_back(static_cast<char>(callee.kind)); }
+            for(auto const& global: module.globals) { seed_bytes.push_back(static_cast<char>(global.storage == nullptr)); }
+            seed_bytes.push_back(static_cast<char>(module.memory.elide_bounds_checks));
+
+            ::uwvm2::utils::hash::xxh3_64bits_context context{
+                .seed64{::uwvm2::utils::hash::xxh3_64bits(reinterpret_cast<::std::byte const*>(seed_bytes.data()), seed_bytes.size())}};
+            context.update(module.module_begin, module.module_end);
+            context.do_final();
+            return context.digest_value();
+        }
+
+        /// @brief      `<directory>/<key>-`, followed by the defined function index and `.o` for the object of a function.
+        inline ::std::string get_code_cache_prefix(::llvm::StringRef directory, ::std::uint_least64_t key) noexcept
+        {
+            ::std::string name{};
+            ::llvm::raw_string_ostream{name} << ::llvm::format_hex_no_prefix(key, 16u) << '-';
+            ::llvm::SmallString<256u> path{directory};
+            ::llvm::sys::path::append(path, name);
+            return path.str().str();
+        }
+
+        /// @brief      Map a cached object, null if there is none.
+        inline ::std::unique_ptr<::llvm::MemoryBuffer> load_cached_object(::llvm::StringRef path) noexcept
+        {
+            // No null terminator is required, so that the file can be mapped.
+            auto object{::llvm::MemoryBuffer::getFile(path, false, false)};
+            if(!object) { return nullptr; }
+            return ::std::move(*object);
+        }
+
+        /// @brief      Stores the object of every IR module whose identifier is a cache path, once it has been generated.
+        /// @details    The object is written to a unique temporary file that is then renamed, so a concurrent run (or one that dies halfway) never
+        ///             leaves a partial object behind. Failures are ignored: the function is recompiled by the next run.
+        struct code_cache_writer_t final : ::llvm::ObjectCache
+        {
+            inline void notifyObjectCompiled(::llvm::Module const* ir, ::llvm::MemoryBufferRef object) override
+            {
+                auto const& path{ir->getModuleIdentifier()};
+
+                int fd;  // No initialization necessary
+                ::llvm::SmallString<256u> temp_path{};
+                if(::llvm::sys::fs::createUniqueFile(path + ".%%%%%%.tmp", fd, temp_path)) { return; }
+                {
+                    ::llvm::raw_fd_ostream out{fd, true};
+                    out << object.getBuffer();
+                    out.close();
+                    if(out.has_error())
+                    {
+                        out.clear_error();
+                        ::llvm::sys::fs::remove(temp_path);
+                        return;
+                    }
+                }
+                if(::llvm::sys::fs::rename(temp_path, path)) { ::llvm::sys::fs::remove(temp_path); }
+            }
+
+            // Cached objects are looked up before lowering, see `compile_function`.
+            inline ::std::unique_ptr<::llvm::MemoryBuffer> getObject(::llvm::Module const*) override { return nullptr; }
+        };
+    }  // namespace details
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
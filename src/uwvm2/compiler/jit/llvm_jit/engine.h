@@ -0,0 +1,408 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <string_view>
+# include <type_traits>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# include <llvm/Config/llvm-config.h>
+# include <llvm/ExecutionEngine/JITSymbol.h>
+# include <llvm/ExecutionEngine/Orc/CompileUtils.h>
+# include <llvm/ExecutionEngine/Orc/Core.h>
+# include <llvm/ExecutionEngine/Orc/IRCompileLayer.h>
+# include <llvm/ExecutionEngine/Orc/JITTargetMachineBuilder.h>
+# include <llvm/ExecutionEngine/Orc/LLJIT.h>
+# include <llvm/ExecutionEngine/Orc/ThreadSafeModule.h>
+# include <llvm/IR/LLVMContext.h>
+# include <llvm/IR/Module.h>
+# include <llvm/IR/Verifier.h>
+# include <llvm/Passes/PassBuilder.h>
+# include <llvm/Support/CodeGen.h>
+# include <llvm/Support/Error.h>
+# include <llvm/Support/FileSystem.h>
+# include <llvm/Support/TargetSelect.h>
+# include <llvm/Support/raw_ostream.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include <uwvm2/uwvm/custom/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+# include "runtime.h"
+# include "lower.h"
+# include "cache.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::jit::llvm_jit
+{
+    namespace details
+    {
+        /// @brief      Code of one module: its JITDylib defines the `runtime::symbol` names for the bindings of the module and the entries of its
+        ///             functions.
+        struct module_code_t
+        {
+            ::llvm::orc::JITDylib* dylib{};
+            // See `get_code_cache_prefix`, empty without a cache.
+            ::std::string cache_prefix{};
+        };
+
+        /// @brief      One ORC LLJIT instance for the whole process. Every function is compiled as its own IR module in its own context, so
+        ///             several threads can optimize and code-generate functions at the same time.
+        struct llvm_jit_engine_t
+        {
+            ::std::unique_ptr<::llvm::orc::LLJIT> jit{};
+            // Guards `codes`, `modules` and `module_count`.
+            ::uwvm2::utils::mutex::mutex_t mutex{};
+            // Referred to by `compiled_function_t::tier2_code`, so the entries must not move.
+            ::uwvm2::utils::container::list<::uwvm2::compiler::uwvm_int::tier2_code_t> codes{};
+            // Referred to by `compiled_module_t::tier2_state`, so the entries must not move.
+            ::uwvm2::utils::container::list<module_code_t> modules{};
+            ::std::size_t module_count{};
+            // Only tiered execution enters native code in the middle of a function.
+            bool emit_osr{};
+
+            // Empty without a cache.
+            ::std::string cache_directory{};
+            // Everything besides the module the generated code depends on, see `get_code_cache_key`.
+            ::std::string cache_configuration{};
+            code_cache_writer_t cache_writer{};
+        };
+
+        inline llvm_jit_engine_t llvm_jit_engine{};  // [global]
+
+        /// @brief      The default O2 pipeline, run by the IR transform layer before code generation.
+        inline void optimize_module(::llvm::Module& ir) noexcept
+        {
+            ::llvm::LoopAnalysisManager loop_analyses{};
+            ::llvm::FunctionAnalysisManager function_analyses{};
+            ::llvm::CGSCCAnalysisManager cgscc_analyses{};
+            ::llvm::ModuleAnalysisManager module_analyses{};
+
+            ::llvm::PassBuilder pass_builder{};
+            pass_builder.registerModuleAnalyses(module_analyses);
+            pass_builder.registerCGSCCAnalyses(cgscc_analyses);
+            pass_builder.registerFunctionAnalyses(function_analyses);
+            pass_builder.registerLoopAnalyses(loop_analyses);
+            pass_builder.crossRegisterProxies(loop_analyses, function_analyses, cgscc_analyses, module_analyses);
+
+            pass_builder.buildPerModuleDefaultPipeline(::llvm::OptimizationLevel::O2).run(ir, module_analyses);
+        }
+
+        /// @brief      `LLJIT::lookup` returns an `ExecutorAddr` since LLVM 15 and a `JITEvaluatedSymbol` before.
+        template <typename Symbol>
+        inline ::std::uintptr_t get_symbol_address(Symbol const& symbol) noexcept
+        {
+            if constexpr(requires { symbol.getValue(); }) { return static_cast<::std::uintptr_t>(symbol.getValue()); }
+            else
+            {
+                return static_cast<::std::uintptr_t>(symbol.getAddress());
+            }
+        }
+
+        /// @brief      A `SymbolMap` entry for `address`: an `ExecutorSymbolDef` since LLVM 17 and a `JITEvaluatedSymbol` before.
+        template <typename Symbol = ::llvm::orc::SymbolMap::mapped_type>
+        inline Symbol get_absolute_symbol(::std::uintptr_t address, ::llvm::JITSymbolFlags flags) noexcept
+        {
+            auto const value{static_cast<::std::uint_least64_t>(address)};
+            if constexpr(::std::is_constructible_v<Symbol, ::llvm::orc::ExecutorAddr, ::llvm::JITSymbolFlags>)
+            {
+                return Symbol{::llvm::orc::ExecutorAddr{value}, flags};
+            }
+            else
+            {
+                return Symbol{value, flags};
+            }
+        }
+
+        /// @brief      Define the `runtime::symbol` names used by the generated code of `module` in `dylib`.
+        inline ::llvm::Error define_module_symbols(::uwvm2::compiler::uwvm_int::compiled_module_t const& module, ::llvm::orc::JITDylib& dylib) noexcept
+        {
+            namespace symbol = ::uwvm2::compiler::jit::llvm_jit::runtime::symbol;
+
+            auto& jit{*llvm_jit_engine.jit};
+            ::llvm::orc::SymbolMap symbols{};
+            auto const define_function{[&](::std::string_view name, ::std::uintptr_t address)
+                                       { symbols[jit.mangleAndIntern(name)] = get_absolute_symbol(address, ::llvm::JITSymbolFlags::Callable); }};
+            auto const define_binding{[&](::std::string_view name, void const* address)
+                                      { symbols[jit.mangleAndIntern(name)] = get_absolute_symbol(reinterpret_cast<::std::uintptr_t>(address), {}); }};
+
+            define_function(symbol::trap, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::uwvm_int::trap));
+            define_function(symbol::invoke_compiled, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::uwvm_int::invoke_compiled));
+            define_function(symbol::invoke_host, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::uwvm_int::invoke_host));
+            define_function(symbol::call_indirect, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::call_indirect));
+            define_function(symbol::memory_begin, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::memory_begin));
+            define_function(symbol::memory_length, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::memory_length));
+            define_function(symbol::memory_size, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::memory_size));
+            define_function(symbol::memory_grow, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::memory_grow));
+            define_function(symbol::host_global_get, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::host_global_get));
+            define_function(symbol::host_global_set, reinterpret_cast<::std::uintptr_t>(::uwvm2::compiler::jit::llvm_jit::runtime::host_global_set));
+
+            if(module.has_memory) { define_binding(symbol::memory, ::std::addressof(module.memory)); }
+            if(module.table != nullptr) { define_binding(symbol::table, module.table); }
+
+            for(::std::size_t i{}; i != module.function_index_space.size(); ++i)
+            {
+                auto const& callee{module.function_index_space.index_unchecked(i)};
+                switch(callee.kind)
+                {
+                    case ::uwvm2::compiler::uwvm_int::callable_kind::compiled: define_binding(symbol::get_indexed(symbol::function, i), callee.compiled); break;
+                    case ::uwvm2::compiler::uwvm_int::callable_kind::host: define_binding(symbol::get_indexed(symbol::function, i), callee.host); break;
+                    default: break;
+                }
+            }
+            for(::std::size_t i{}; i != module.function_type_count; ++i)
+            {
+                define_binding(symbol::get_indexed(symbol::function_type, i), module.function_types + i);
+            }
+            for(::std::size_t i{}; i != module.globals.size(); ++i)
+            {
+                auto const& global{module.globals.index_unchecked(i)};
+                // The value is the first member of `wasm_global_storage_t::storage`.
+                if(global.storage != nullptr) { define_binding(symbol::get_indexed(symbol::global, i), ::std::addressof(global.storage->storage)); }
+                else
+                {
+                    define_binding(symbol::get_indexed(symbol::global, i), ::std::addressof(global.host));
+                }
+            }
+
+            return dylib.define(::llvm::orc::absoluteSymbols(::std::move(symbols)));
+        }
+
+        /// @brief      The code of `module`, created on first use. Null if its JITDylib could not be created.
+        inline module_code_t const* get_module_code(::uwvm2::compiler::uwvm_int::compiled_module_t const& module) noexcept
+        {
+            auto& engine{llvm_jit_engine};
+            ::uwvm2::utils::mutex::mutex_guard_t guard{engine.mutex};
+            if(module.tier2_state != nullptr) { return static_cast<module_code_t const*>(module.tier2_state); }
+
+            auto dylib{engine.jit->createJITDylib("uwvm_module_" + ::std::to_string(engine.module_count++))};
+            if(!dylib) [[unlikely]]
+            {
+                ::llvm::consumeError(dylib.takeError());
+                return nullptr;
+            }
+            // Library calls the code generator may emit are resolved like those of the process.
+            dylib->addToLinkOrder(engine.jit->getMainJITDylib());
+            if(auto err{define_module_symbols(module, *dylib)}) [[unlikely]]
+            {
+                ::llvm::consumeError(::std::move(err));
+                return nullptr;
+            }
+
+            auto& code{engine.modules.emplace_back()};
+            code.dylib = ::std::addressof(*dylib);
+            if(!engine.cache_directory.empty())
+            {
+                code.cache_prefix = get_code_cache_prefix(engine.cache_directory, get_code_cache_key(module, engine.cache_configuration));
+            }
+            module.tier2_state = ::std::addressof(code);
+            return ::std::addressof(code);
+        }
+
+        /// @brief      Address of a function of `dylib`, 0 if it could not be materialized.
+        inline ::std::uintptr_t lookup_function(::llvm::orc::JITDylib& dylib, ::llvm::StringRef name) noexcept
+        {
+            auto symbol{llvm_jit_engine.jit->lookup(dylib, name)};
+            if(!symbol) [[unlikely]]
+            {
+                ::llvm::consumeError(symbol.takeError());
+                return 0u;
+            }
+            return get_symbol_address(*symbol);
+        }
+
+        /// @brief      Generate the code of `function` into `dylib`, as `entry_name` and `osr_name`. The IR module is named `object_path` so that the
+        ///             cache writer stores its object, if not empty.
+        inline bool add_function_ir(::uwvm2::compiler::uwvm_int::compiled_function_t const& function,
+                                    ::llvm::orc::JITDylib& dylib,
+                                    ::std::string const& entry_name,
+                                    ::std::string const& osr_name,
+                                    ::std::string const& object_path) noexcept
+        {
+            auto& engine{llvm_jit_engine};
+
+            auto context{::std::make_unique<::llvm::LLVMContext>()};
+#if LLVM_VERSION_MAJOR < 15
+            context->enableOpaquePointers();
+#endif
+            auto ir{::std::make_unique<::llvm::Module>(object_path.empty() ? entry_name : object_path, *context)};
+            ir->setDataLayout(engine.jit->getDataLayout());
+#if LLVM_VERSION_MAJOR >= 21
+            ir->setTargetTriple(engine.jit->getTargetTriple());
+#else
+            ir->setTargetTriple(engine.jit->getTargetTriple().str());
+#endif
+
+            if(!::uwvm2::compiler::jit::llvm_jit::lower_function(*function.module_ptr, function, *ir, entry_name, osr_name)) { return false; }
+            if(::llvm::verifyModule(*ir)) [[unlikely]] { return false; }
+
+            if(auto err{engine.jit->addIRModule(dylib, ::llvm::orc::ThreadSafeModule{::std::move(ir), ::std::move(context)})}) [[unlikely]]
+            {
+                ::llvm::consumeError(::std::move(err));
+                return false;
+            }
+            return true;
+        }
+
+        /// @brief      `tier_up_compiler_t::compile`
+        /// @details    Links the cached object of the function if there is one, and lowers and compiles the body otherwise.
+        inline ::uwvm2::compiler::uwvm_int::tier2_code_t const* compile_function(::uwvm2::compiler::uwvm_int::compiled_function_t const& function) noexcept
+        {
+            namespace symbol = ::uwvm2::compiler::jit::llvm_jit::runtime::symbol;
+
+            auto& engine{llvm_jit_engine};
+            auto const& module{*function.module_ptr};
+            auto const module_code{get_module_code(module)};
+            if(module_code == nullptr) [[unlikely]] { return nullptr; }
+            auto& dylib{*module_code->dylib};
+
+            auto const defined_index{static_cast<::std::size_t>(::std::addressof(function) - module.functions.data())};
+            auto const entry_name{symbol::get_indexed(symbol::entry, defined_index)};
+            auto const osr_name{engine.emit_osr ? entry_name + ::std::string{symbol::osr_entry_suffix} : ::std::string{}};
+
+            ::std::string object_path{};
+            bool cached{};
+            if(!module_code->cache_prefix.empty())
+            {
+                object_path = module_code->cache_prefix + ::std::to_string(defined_index) + ".o";
+                if(auto object{load_cached_object(object_path)}; object != nullptr)
+                {
+                    if(auto err{engine.jit->addObjectFile(dylib, ::std::move(object))}) [[unlikely]]
+                    {
+                        ::llvm::consumeError(::std::move(err));
+                        ::llvm::sys::fs::remove(object_path);
+                        return nullptr;
+                    }
+                    cached = true;
+                }
+            }
+            if(!cached && !add_function_ir(function, dylib, entry_name, osr_name, object_path)) { return nullptr; }
+
+            ::uwvm2::compiler::uwvm_int::tier2_code_t code{};
+            auto const entry{lookup_function(dylib, entry_name)};
+            auto const osr_entry{osr_name.empty() ? 0u : lookup_function(dylib, osr_name)};
+            if(entry == 0u || (!osr_name.empty() && osr_entry == 0u)) [[unlikely]]
+            {
+                // A cached object that does not link is dropped, the next run compiles the function again.
+                if(cached) { ::llvm::sys::fs::remove(object_path); }
+                return nullptr;
+            }
+            code.entry = reinterpret_cast<decltype(code.entry)>(entry);
+            if(osr_entry != 0u) { code.osr_entry = reinterpret_cast<decltype(code.osr_entry)>(osr_entry); }
+
+            ::uwvm2::utils::mutex::mutex_guard_t guard{engine.mutex};
+            return ::std::addressof(engine.codes.emplace_back(code));
+        }
+    }  // namespace details
+
+    /// @brief      Create the LLJIT for the host and install it as `::uwvm2::compiler::uwvm_int::tier_up_compiler`, for `compiler`. Must be called
+    ///             before `::uwvm2::compiler::uwvm_int::instantiate`.
+    /// @param      cache_directory Where generated objects are cached across runs (created if missing), empty for no cache. Caching is off if the
+    ///             directory cannot be created.
+    /// @return     Whether the JIT could be created. The modules are only interpreted otherwise.
+    inline bool install_llvm_jit(::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t compiler,
+                                 ::uwvm2::utils::container::u8string_view cache_directory) noexcept
+    {
+        auto& engine{details::llvm_jit_engine};
+        if(compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_only) { return true; }
+
+        engine.emit_osr = compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered;
+
+        if(engine.jit == nullptr)
+        {
+            if(::llvm::InitializeNativeTarget() || ::llvm::InitializeNativeTargetAsmPrinter()) [[unlikely]] { return false; }
+
+            auto target_machine_builder{::llvm::orc::JITTargetMachineBuilder::detectHost()};
+            if(!target_machine_builder) [[unlikely]]
+            {
+                ::llvm::consumeError(target_machine_builder.takeError());
+                return false;
+            }
+            // Cached objects are linked at whatever addresses a later run gets.
+            target_machine_builder->setRelocationModel(::llvm::Reloc::PIC_);
+            target_machine_builder->setCodeModel(::llvm::CodeModel::Small);
+
+            ::llvm::StringRef const cache_path{reinterpret_cast<char const*>(cache_directory.data()), cache_directory.size()};
+            if(!cache_path.empty() && !::llvm::sys::fs::create_directories(cache_path))
+            {
+                engine.cache_directory = cache_path.str();
+
+                auto const version{::uwvm2::uwvm::custom::uwvm_version};
+                ::llvm::raw_string_ostream configuration{engine.cache_configuration};
+                configuration << "uwvm " << version.x << '.' << version.y << '.' << version.z << '.' << version.state << "\nllvm " << LLVM_VERSION_STRING
+                              << "\nformat " << details::code_cache_format_version << '\n'
+                              << target_machine_builder->getTargetTriple().str() << '\n'
+                              << target_machine_builder->getCPU() << '\n'
+                              << target_machine_builder->getFeatures().getString() << "\nosr " << engine.emit_osr << '\n';
+            }
+
+            // Functions are compiled on the thread that asks for them (the tier-up thread, or every worker of `llvm_jit_only`), which needs a
+            // target machine per compilation.
+            ::llvm::orc::LLJITBuilder builder{};
+            builder.setJITTargetMachineBuilder(::std::move(*target_machine_builder));
+            builder.setCompileFunctionCreator(
+                [](::llvm::orc::JITTargetMachineBuilder target_machine_builder) -> ::llvm::Expected<::std::unique_ptr<::llvm::orc::IRCompileLayer::IRCompiler>>
+                {
+                    auto& engine{details::llvm_jit_engine};
+                    return ::std::make_unique<::llvm::orc::ConcurrentIRCompiler>(::std::move(target_machine_builder),
+                                                                                 engine.cache_directory.empty() ? nullptr
+                                                                                                                : ::std::addressof(engine.cache_writer));
+                });
+            auto jit{builder.create()};
+            if(!jit) [[unlikely]]
+            {
+                ::llvm::consumeError(jit.takeError());
+                return false;
+            }
+
+            (*jit)->getIRTransformLayer().setTransform(
+                [](::llvm::orc::ThreadSafeModule module, ::llvm::orc::MaterializationResponsibility const&) -> ::llvm::Expected<::llvm::orc::ThreadSafeModule>
+                {
+                    module.withModuleDo([](::llvm::Module& ir) noexcept { details::optimize_module(ir); });
+                    return ::std::move(module);
+                });
+            engine.jit = ::std::move(*jit);
+        }
+
+        ::uwvm2::compiler::uwvm_int::tier_up_compiler.compile = details::compile_function;
+        return true;
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,1566 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <cmath>
+# include <limits>
+# include <memory>
+# include <string_view>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# include <llvm/ADT/APFloat.h>
+# include <llvm/ADT/APInt.h>
+# include <llvm/ADT/ArrayRef.h>
+# include <llvm/ADT/StringRef.h>
+# include <llvm/IR/Attributes.h>
+# include <llvm/IR/BasicBlock.h>
+# include <llvm/IR/Constants.h>
+# include <llvm/IR/DerivedTypes.h>
+# include <llvm/IR/Function.h>
+# include <llvm/IR/IRBuilder.h>
+# include <llvm/IR/Instructions.h>
+# include <llvm/IR/Intrinsics.h>
+# include <llvm/IR/LLVMContext.h>
+# include <llvm/IR/MDBuilder.h>
+# include <llvm/IR/Module.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+# include "runtime.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::jit::llvm_jit
+{
+    /// @brief      Lowering of wasm1 function bodies to LLVM IR.
+    /// @details    A body is lowered after uwvm-int has translated it, which already rejected malformed control flow, so the lowering only keeps the
+    ///             value types it needs to pick LLVM types and gives up (the function then stays interpreted) on anything it does not expect.
+    ///
+    ///             The generated code shares the frame layout of uwvm-int: parameters arrive at `local_base`, results are left there, and calls
+    ///             pass their arguments in the slots from `local_base + local_count` on, where the interpreter would have its operand stack. Locals
+    ///             live in allocas and operands in SSA values, the optimizer promotes both to registers. Linear memory is reached through
+    ///             `runtime::memory_begin`/`runtime::memory_length`, whose results are kept in allocas and reloaded after every call and
+    ///             `memory.grow`; every access is bounds checked against the length, except in memories whose guard region rejects out of bounds
+    ///             accesses (`memory_binding_t::elide_bounds_checks`). Nothing of this process is embedded: runtime functions and bindings are
+    ///             declared by their `runtime::symbol` names.
+    ///
+    ///             On-stack replacement: the lowered body takes the index of a loop header. The entry wrapper passes none and the inliner folds the
+    ///             dispatch away. The OSR wrapper reloads the locals and the operand stack of the interpreter frame and jumps to that loop header,
+    ///             which is why the operand values crossing a loop header are passed through allocas. Loops are numbered like the
+    ///             `op_tier_up_loop` ops of uwvm-int: reachable loops in body order.
+    namespace details
+    {
+        using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+        using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+        using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+        using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+        using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+
+        /// @brief      Passed as loop index by the entry wrapper.
+        inline constexpr ::std::uint_least32_t no_osr_loop{::std::numeric_limits<::std::uint_least32_t>::max()};
+
+        inline constexpr ::std::size_t trap_kind_count{static_cast<::std::size_t>(::uwvm2::compiler::uwvm_int::trap_kind::call_stack_exhausted) + 1uz};
+
+        inline constexpr bool is_value_type(wasm_byte type) noexcept
+        {
+            switch(static_cast<value_type>(type))
+            {
+                case value_type::i32: [[fallthrough]];
+                case value_type::i64: [[fallthrough]];
+                case value_type::f32: [[fallthrough]];
+                case value_type::f64: return true;
+                default: return false;
+            }
+        }
+
+        inline constexpr ::std::size_t get_value_type_index(value_type type) noexcept
+        {
+            switch(type)
+            {
+                case value_type::i32: return 0uz;
+                case value_type::i64: return 1uz;
+                case value_type::f32: return 2uz;
+                default: return 3uz;
+            }
+        }
+
+        enum class control_frame_kind : unsigned
+        {
+            function,
+            block,
+            loop,
+            if_,
+            else_
+        };
+
+        struct control_frame_t
+        {
+            // Continuation after `end`, also the target of branches to a block, an `if` or the function.
+            ::llvm::BasicBlock* end_block{};
+            // Target of branches to a loop.
+            ::llvm::BasicBlock* loop_header{};
+            // False edge of an `if` that has not met its `else` yet.
+            ::llvm::BasicBlock* else_block{};
+            // Result of a block with a value type, merged in `end_block`.
+            ::llvm::PHINode* result{};
+            // Operand stack height when the frame was entered.
+            ::std::size_t entry_height{};
+            value_type result_type{};
+            bool has_result{};
+            control_frame_kind kind{};
+            // The rest of the frame is dead code (after br, br_table, return or unreachable).
+            bool unreachable{};
+        };
+
+        struct stack_value_t
+        {
+            ::llvm::Value* value{};
+            value_type type{};
+        };
+
+        /// @brief      A loop header the OSR wrapper can enter. The operand stack below the loop is `osr_stack_types[first_type, first_type + height)`.
+        struct osr_entry_point_t
+        {
+            ::llvm::BasicBlock* header{};
+            ::std::size_t first_type{};
+            ::std::size_t height{};
+        };
+
+        using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = wasm_byte const*;
+
+        struct function_lowering_t
+        {
+            ::uwvm2::compiler::uwvm_int::compiled_module_t const& module;
+            ::uwvm2::compiler::uwvm_int::compiled_function_t const& function;
+            ::llvm::Module& ir;
+            ::llvm::LLVMContext& context;
+            ::llvm::IRBuilder<> builder;
+            // Allocas go to the entry block, which only gets its terminator once the body is done.
+            ::llvm::IRBuilder<> alloca_builder;
+            bool emit_osr{};
+            bool big_endian{};
+
+            wasm_byte_const_may_alias_ptr curr{};
+            wasm_byte_const_may_alias_ptr end{};
+
+            ::llvm::Type* void_type{};
+            ::llvm::Type* i8_type{};
+            ::llvm::Type* i32_type{};
+            ::llvm::Type* i64_type{};
+            ::llvm::Type* f32_type{};
+            ::llvm::Type* f64_type{};
+            ::llvm::Type* ptr_type{};
+
+            ::llvm::Function* body{};
+            ::llvm::Value* local_base{};
+            ::llvm::Value* sp{};
+            ::llvm::Value* loop_index{};
+            ::llvm::Value* ctx{};
+            ::llvm::BasicBlock* entry_block{};
+
+            ::uwvm2::utils::container::vector<::llvm::AllocaInst*> locals{};
+            ::uwvm2::utils::container::vector<value_type> local_types{};
+            ::llvm::AllocaInst* memory_begin{};
+            ::llvm::AllocaInst* memory_length{};
+
+            ::uwvm2::utils::container::vector<stack_value_t> stack{};
+            ::uwvm2::utils::container::vector<control_frame_t> frames{};
+            // Nesting depth of blocks opened inside dead code.
+            ::std::size_t dead_depth{};
+
+            ::llvm::BasicBlock* trap_blocks[trap_kind_count]{};
+
+            // Allocas carrying operand values across loop headers, indexed by operand stack position and `get_value_type_index`.
+            ::uwvm2::utils::container::vector<::uwvm2::utils::container::array<::llvm::AllocaInst*, 4uz>> spill_slots{};
+            ::uwvm2::utils::container::vector<osr_entry_point_t> osr_entry_points{};
+            ::uwvm2::utils::container::vector<value_type> osr_stack_types{};
+
+            /// @brief decoding
+
+            [[nodiscard]] inline bool read_byte(wasm_byte& v) noexcept
+            {
+                if(curr == end) [[unlikely]] { return false; }
+                v = *curr++;
+                return true;
+            }
+
+            template <typename T>
+            [[nodiscard]] inline bool read_leb128(T& v) noexcept
+            {
+                using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+                auto const [next, err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                ::fast_io::mnp::leb128_get(v))};
+                if(err != ::fast_io::parse_code::ok) [[unlikely]] { return false; }
+                curr = reinterpret_cast<wasm_byte_const_may_alias_ptr>(next);
+                return true;
+            }
+
+            template <typename Bits>
+            [[nodiscard]] inline bool read_float_bits(Bits& bits) noexcept
+            {
+                if(static_cast<::std::size_t>(end - curr) < sizeof(Bits)) [[unlikely]] { return false; }
+                ::std::memcpy(::std::addressof(bits), curr, sizeof(Bits));
+                bits = ::fast_io::little_endian(bits);
+                curr += sizeof(Bits);
+                return true;
+            }
+
+            /// @brief      wasm1 block types are either empty (0x40) or a single value type.
+            [[nodiscard]] inline bool read_block_type(bool& has_result, value_type& result_type) noexcept
+            {
+                wasm_byte type;  // No initialization necessary
+                if(!read_byte(type)) [[unlikely]] { return false; }
+                if(type == static_cast<wasm_byte>(0x40u))
+                {
+                    has_result = false;
+                    return true;
+                }
+                if(!is_value_type(type)) [[unlikely]] { return false; }
+                has_result = true;
+                result_type = static_cast<value_type>(type);
+                return true;
+            }
+
+            [[nodiscard]] inline bool read_zero_byte() noexcept
+            {
+                wasm_byte v;  // No initialization necessary
+                return read_byte(v) && v == 0u;
+            }
+
+            [[nodiscard]] inline bool read_memarg(wasm_u32& offset) noexcept
+            {
+                wasm_u32 align;  // No initialization necessary
+                return module.has_memory && read_leb128(align) && read_leb128(offset);
+            }
+
+            /// @brief values
+
+            inline ::llvm::Type* get_llvm_type(value_type type) const noexcept
+            {
+                switch(type)
+                {
+                    case value_type::i32: return i32_type;
+                    case value_type::i64: return i64_type;
+                    case value_type::f32: return f32_type;
+                    default: return f64_type;
+                }
+            }
+
+            inline ::llvm::Value* get_zero(value_type type) const noexcept { return ::llvm::Constant::getNullValue(get_llvm_type(type)); }
+
+            [[nodiscard]] inline bool pop(value_type type, ::llvm::Value*& v) noexcept
+            {
+                if(stack.size() <= frames.back_unchecked().entry_height) [[unlikely]] { return false; }
+                auto const top{stack.back_unchecked()};
+                if(top.type != type) [[unlikely]] { return false; }
+                v = top.value;
+                stack.pop_back_unchecked();
+                return true;
+            }
+
+            [[nodiscard]] inline bool pop_any(stack_value_t& v) noexcept
+            {
+                if(stack.size() <= frames.back_unchecked().entry_height) [[unlikely]] { return false; }
+                v = stack.back_unchecked();
+                stack.pop_back_unchecked();
+                return true;
+            }
+
+            inline void push(value_type type, ::llvm::Value* v) noexcept { stack.push_back({v, type}); }
+
+            /// @brief      Pointer to the `index`-th slot from `base`.
+            inline ::llvm::Value* get_slot(::llvm::Value* base, ::std::size_t index) noexcept
+            { return builder.CreateConstInBoundsGEP1_64(i64_type, base, static_cast<::std::uint_least64_t>(index)); }
+
+            /// @brief      Address of a binding, see `runtime::symbol`.
+            inline ::llvm::Constant* get_binding(::llvm::StringRef name) noexcept { return ir.getOrInsertGlobal(name, i8_type); }
+
+            inline ::llvm::Constant* get_binding(::std::string_view prefix, ::std::size_t index) noexcept
+            { return get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::get_indexed(prefix, index)); }
+
+            inline ::llvm::CallInst* call_runtime(::llvm::StringRef name, ::llvm::FunctionType* type, ::llvm::ArrayRef<::llvm::Value*> args) noexcept
+            {
+                auto const call{builder.CreateCall(ir.getOrInsertFunction(name, type), args)};
+                call->setDoesNotThrow();
+                return call;
+            }
+
+            /// @brief traps
+
+            inline ::llvm::BasicBlock* get_trap_block(::uwvm2::compiler::uwvm_int::trap_kind kind) noexcept
+            {
+                auto& block{trap_blocks[static_cast<::std::size_t>(kind)]};
+                if(block != nullptr) { return block; }
+
+                block = ::llvm::BasicBlock::Create(context, "trap", body);
+                auto const saved{builder.GetInsertBlock()};
+                builder.SetInsertPoint(block);
+                auto const call{call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::trap,
+                                             ::llvm::FunctionType::get(void_type, {i32_type}, false),
+                                             {builder.getInt32(static_cast<::std::uint_least32_t>(kind))})};
+                call->setDoesNotReturn();
+                builder.CreateUnreachable();
+                builder.SetInsertPoint(saved);
+                return block;
+            }
+
+            /// @brief      Trap if `condition` holds, the trap is marked as unlikely.
+            inline void trap_if(::llvm::Value* condition, ::uwvm2::compiler::uwvm_int::trap_kind kind) noexcept
+            {
+                auto const next{::llvm::BasicBlock::Create(context, "", body)};
+                builder.CreateCondBr(condition, get_trap_block(kind), next, ::llvm::MDBuilder{context}.createBranchWeights(1u, 1u << 20u));
+                builder.SetInsertPoint(next);
+            }
+
+            /// @brief memory
+
+            inline void reload_memory() noexcept
+            {
+                if(!module.has_memory) { return; }
+                auto const binding{get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory)};
+                builder.CreateStore(call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory_begin,
+                                                 ::llvm::FunctionType::get(ptr_type, {ptr_type}, false),
+                                                 {binding}),
+                                    memory_begin);
+                if(module.memory.elide_bounds_checks) { return; }
+                builder.CreateStore(call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory_length,
+                                                 ::llvm::FunctionType::get(i64_type, {ptr_type}, false),
+                                                 {binding}),
+                                    memory_length);
+            }
+
+            /// @brief      Host address of `[address + offset, address + offset + size)`, trapping if it is out of bounds. Both operands are 32-bit, so
+            ///             the 64-bit sum cannot overflow. The check is left to the guard region of memories that elide bounds checks.
+            inline ::llvm::Value* get_memory_address(::llvm::Value* address, wasm_u32 offset, ::std::size_t size) noexcept
+            {
+                auto const effective_address{builder.CreateAdd(builder.CreateZExt(address, i64_type), builder.getInt64(offset))};
+                if(!module.memory.elide_bounds_checks)
+                {
+                    auto const access_end{builder.CreateAdd(effective_address, builder.getInt64(static_cast<::std::uint_least64_t>(size)))};
+                    trap_if(builder.CreateICmpUGT(access_end, builder.CreateLoad(i64_type, memory_length)),
+                            ::uwvm2::compiler::uwvm_int::trap_kind::out_of_bounds_memory_access);
+                }
+                return builder.CreateInBoundsGEP(i8_type, builder.CreateLoad(ptr_type, memory_begin), effective_address);
+            }
+
+            /// @brief      Swap an integer between host and wasm (little-endian) byte order.
+            inline ::llvm::Value* to_little_endian(::llvm::Value* v) noexcept
+            {
+                if(!big_endian || v->getType()->getIntegerBitWidth() == 8u) { return v; }
+                return builder.CreateUnaryIntrinsic(::llvm::Intrinsic::bswap, v);
+            }
+
+            /// @param      mem_type    In-memory type, an integer type for integer accesses.
+            [[nodiscard]] inline bool lower_load(value_type type, ::llvm::Type* mem_type, bool is_signed) noexcept
+            {
+                wasm_u32 offset;  // No initialization necessary
+                ::llvm::Value* address;  // No initialization necessary
+                if(!read_memarg(offset) || !pop(value_type::i32, address)) [[unlikely]] { return false; }
+
+                auto const result_type{get_llvm_type(type)};
+                auto const bits_type{mem_type->isFloatingPointTy() ? ::llvm::Type::getIntNTy(context, mem_type->getScalarSizeInBits()) : mem_type};
+                auto const size{static_cast<::std::size_t>(bits_type->getIntegerBitWidth() / 8u)};
+
+                ::llvm::Value* v{to_little_endian(builder.CreateAlignedLoad(bits_type, get_memory_address(address, offset, size), ::llvm::MaybeAlign{1u}))};
+                if(mem_type->isFloatingPointTy()) { v = builder.CreateBitCast(v, result_type); }
+                else if(bits_type != result_type) { v = is_signed ? builder.CreateSExt(v, result_type) : builder.CreateZExt(v, result_type); }
+                push(type, v);
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_store(value_type type, ::llvm::Type* mem_type) noexcept
+            {
+                wasm_u32 offset;  // No initialization necessary
+                ::llvm::Value* v;  // No initialization necessary
+                ::llvm::Value* address;  // No initialization necessary
+                if(!read_memarg(offset) || !pop(type, v) || !pop(value_type::i32, address)) [[unlikely]] { return false; }
+
+                auto const bits_type{mem_type->isFloatingPointTy() ? ::llvm::Type::getIntNTy(context, mem_type->getScalarSizeInBits()) : mem_type};
+                auto const size{static_cast<::std::size_t>(bits_type->getIntegerBitWidth() / 8u)};
+
+                if(mem_type->isFloatingPointTy()) { v = builder.CreateBitCast(v, bits_type); }
+                else if(bits_type != v->getType()) { v = builder.CreateTrunc(v, bits_type); }
+                builder.CreateAlignedStore(to_little_endian(v), get_memory_address(address, offset, size), ::llvm::MaybeAlign{1u});
+                return true;
+            }
+
+            /// @brief control
+
+            inline ::llvm::PHINode* create_result(::llvm::BasicBlock* block, bool has_result, value_type type) noexcept
+            {
+                if(!has_result) { return nullptr; }
+                return ::llvm::PHINode::Create(get_llvm_type(type), 2u, "", block);
+            }
+
+            inline void push_frame(control_frame_kind kind, bool has_result, value_type result_type) noexcept
+            {
+                control_frame_t frame{};
+                frame.end_block = ::llvm::BasicBlock::Create(context, "", body);
+                frame.result = create_result(frame.end_block, has_result, result_type);
+                frame.entry_height = stack.size();
+                frame.result_type = result_type;
+                frame.has_result = has_result;
+                frame.kind = kind;
+                frames.push_back(::std::move(frame));
+            }
+
+            [[nodiscard]] inline bool get_label(wasm_u32 depth, ::std::size_t& index) noexcept
+            {
+                if(static_cast<::std::size_t>(depth) >= frames.size()) [[unlikely]] { return false; }
+                index = frames.size() - 1uz - static_cast<::std::size_t>(depth);
+                return true;
+            }
+
+            /// @brief      Branch from the current block to the label of `frames[index]`, passing the top value if the label takes one.
+            [[nodiscard]] inline bool branch_to(::std::size_t index) noexcept
+            {
+                auto& label{frames.index_unchecked(index)};
+                if(label.kind == control_frame_kind::loop)
+                {
+                    // A loop label takes no values in wasm1.
+                    builder.CreateBr(label.loop_header);
+                    return true;
+                }
+                if(label.has_result)
+                {
+                    if(stack.size() <= frames.back_unchecked().entry_height) [[unlikely]] { return false; }
+                    auto const top{stack.back_unchecked()};
+                    if(top.type != label.result_type) [[unlikely]] { return false; }
+                    label.result->addIncoming(top.value, builder.GetInsertBlock());
+                }
+                builder.CreateBr(label.end_block);
+                return true;
+            }
+
+            /// @brief      Everything up to the matching `else`/`end` is dead.
+            inline void set_unreachable() noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                frame.unreachable = true;
+                stack.resize(frame.entry_height);
+                dead_depth = 0uz;
+            }
+
+            /// @brief      The values of the current frame must match its block type at `else`/`end`.
+            [[nodiscard]] inline bool check_frame_results(control_frame_t const& frame) const noexcept
+            {
+                if(frame.unreachable) { return true; }
+                if(stack.size() != frame.entry_height + (frame.has_result ? 1uz : 0uz)) [[unlikely]] { return false; }
+                return !frame.has_result || stack.back_unchecked().type == frame.result_type;
+            }
+
+            inline ::llvm::AllocaInst* get_spill_slot(::std::size_t position, value_type type) noexcept
+            {
+                if(spill_slots.size() <= position) { spill_slots.resize(position + 1uz); }
+                auto& slot{spill_slots.index_unchecked(position)[get_value_type_index(type)]};
+                if(slot == nullptr) { slot = alloca_builder.CreateAlloca(get_llvm_type(type)); }
+                return slot;
+            }
+
+            [[nodiscard]] inline bool lower_loop() noexcept
+            {
+                bool has_result;  // No initialization necessary
+                value_type result_type{};
+                if(!read_block_type(has_result, result_type)) [[unlikely]] { return false; }
+
+                auto const header{::llvm::BasicBlock::Create(context, "loop", body)};
+                if(emit_osr)
+                {
+                    // The OSR wrapper also enters the header, so the operands below the loop cannot be plain SSA values of the blocks before it.
+                    for(::std::size_t i{}; i != stack.size(); ++i)
+                    {
+                        auto const& v{stack.index_unchecked(i)};
+                        builder.CreateStore(v.value, get_spill_slot(i, v.type));
+                    }
+                }
+                builder.CreateBr(header);
+                builder.SetInsertPoint(header);
+                if(emit_osr)
+                {
+                    osr_entry_points.push_back({header, osr_stack_types.size(), stack.size()});
+                    for(::std::size_t i{}; i != stack.size(); ++i)
+                    {
+                        auto& v{stack.index_unchecked(i)};
+                        osr_stack_types.push_back(v.type);
+                        v.value = builder.CreateLoad(get_llvm_type(v.type), get_spill_slot(i, v.type));
+                    }
+                }
+
+                push_frame(control_frame_kind::loop, has_result, result_type);
+                frames.back_unchecked().loop_header = header;
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_if() noexcept
+            {
+                bool has_result;  // No initialization necessary
+                value_type result_type{};
+                ::llvm::Value* condition;  // No initialization necessary
+                if(!read_block_type(has_result, result_type) || !pop(value_type::i32, condition)) [[unlikely]] { return false; }
+
+                auto const then_block{::llvm::BasicBlock::Create(context, "then", body)};
+                auto const else_block{::llvm::BasicBlock::Create(context, "else", body)};
+                builder.CreateCondBr(builder.CreateICmpNE(condition, builder.getInt32(0u)), then_block, else_block);
+                builder.SetInsertPoint(then_block);
+
+                push_frame(control_frame_kind::if_, has_result, result_type);
+                frames.back_unchecked().else_block = else_block;
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_else() noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                if(frame.kind != control_frame_kind::if_ || !check_frame_results(frame)) [[unlikely]] { return false; }
+                if(!frame.unreachable && !branch_to(frames.size() - 1uz)) [[unlikely]] { return false; }
+
+                stack.resize(frame.entry_height);
+                frame.kind = control_frame_kind::else_;
+                frame.unreachable = false;
+                builder.SetInsertPoint(frame.else_block);
+                frame.else_block = nullptr;
+                return true;
+            }
+
+            /// @return     Whether the function frame has been closed.
+            [[nodiscard]] inline bool lower_end(bool& function_end) noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                if(!check_frame_results(frame)) [[unlikely]] { return false; }
+                if(!frame.unreachable && !branch_to_end(frame)) [[unlikely]] { return false; }
+
+                if(frame.kind == control_frame_kind::if_)
+                {
+                    // Without an else arm the false edge goes straight to the end, which needs the block to have no result.
+                    if(frame.has_result) [[unlikely]] { return false; }
+                    builder.SetInsertPoint(frame.else_block);
+                    builder.CreateBr(frame.end_block);
+                }
+
+                stack.resize(frame.entry_height);
+                builder.SetInsertPoint(frame.end_block);
+                if(frame.has_result)
+                {
+                    ::llvm::Value* result{frame.result};
+                    if(frame.result->getNumIncomingValues() == 0u)
+                    {
+                        // Nothing reaches the end, the code after it is dead.
+                        result = ::llvm::UndefValue::get(get_llvm_type(frame.result_type));
+                        frame.result->eraseFromParent();
+                    }
+                    push(frame.result_type, result);
+                }
+
+                function_end = frame.kind == control_frame_kind::function;
+                frames.pop_back_unchecked();
+                return true;
+            }
+
+            /// @brief      Fall through to the end of `frame`, which, unlike a branch, also ends loops.
+            [[nodiscard]] inline bool branch_to_end(control_frame_t& frame) noexcept
+            {
+                if(frame.has_result) { frame.result->addIncoming(stack.back_unchecked().value, builder.GetInsertBlock()); }
+                builder.CreateBr(frame.end_block);
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_br_if() noexcept
+            {
+                wasm_u32 depth;  // No initialization necessary
+                ::std::size_t index;  // No initialization necessary
+                ::llvm::Value* condition;  // No initialization necessary
+                if(!read_leb128(depth) || !get_label(depth, index) || !pop(value_type::i32, condition)) [[unlikely]] { return false; }
+
+                auto const taken{::llvm::BasicBlock::Create(context, "", body)};
+                auto const next{::llvm::BasicBlock::Create(context, "", body)};
+                builder.CreateCondBr(builder.CreateICmpNE(condition, builder.getInt32(0u)), taken, next);
+                builder.SetInsertPoint(taken);
+                if(!branch_to(index)) [[unlikely]] { return false; }
+                builder.SetInsertPoint(next);
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_br_table() noexcept
+            {
+                wasm_u32 count;  // No initialization necessary
+                ::llvm::Value* selector;  // No initialization necessary
+                if(!read_leb128(count) || static_cast<::std::size_t>(count) >= static_cast<::std::size_t>(end - curr)) [[unlikely]] { return false; }
+                if(!pop(value_type::i32, selector)) [[unlikely]] { return false; }
+
+                // One block per distinct label, each adds its own incoming value to the label's result.
+                ::uwvm2::utils::container::vector<::llvm::BasicBlock*> label_blocks{};
+                label_blocks.resize(frames.size());
+                auto const switch_block{builder.GetInsertBlock()};
+
+                ::llvm::SwitchInst* switch_inst{};
+                for(wasm_u32 i{}; i <= count; ++i)
+                {
+                    wasm_u32 depth;  // No initialization necessary
+                    ::std::size_t index;  // No initialization necessary
+                    if(!read_leb128(depth) || !get_label(depth, index)) [[unlikely]] { return false; }
+
+                    auto& block{label_blocks.index_unchecked(index)};
+                    if(block == nullptr)
+                    {
+                        block = ::llvm::BasicBlock::Create(context, "", body);
+                        builder.SetInsertPoint(block);
+                        if(!branch_to(index)) [[unlikely]] { return false; }
+                        builder.SetInsertPoint(switch_block);
+                    }
+
+                    if(i == count)
+                    {
+                        if(switch_inst == nullptr) { switch_inst = builder.CreateSwitch(selector, block, 0u); }
+                        else
+                        {
+                            switch_inst->setDefaultDest(block);
+                        }
+                    }
+                    else
+                    {
+                        if(switch_inst == nullptr) { switch_inst = builder.CreateSwitch(selector, block, static_cast<unsigned>(count)); }
+                        switch_inst->addCase(builder.getInt32(i), block);
+                    }
+                }
+
+                set_unreachable();
+                return true;
+            }
+
+            /// @brief calls
+
+            /// @brief      Pass the arguments in the slots above the locals, call, and push the results left there.
+            template <typename Call>
+            [[nodiscard]] inline bool lower_call_with_frame(::uwvm2::compiler::uwvm_int::function_type_t const* function_type_ptr, Call&& emit_call) noexcept
+            {
+                auto const param_count{::uwvm2::compiler::uwvm_int::get_param_count(function_type_ptr)};
+                auto const result_count{::uwvm2::compiler::uwvm_int::get_result_count(function_type_ptr)};
+                if(result_count > 1uz) [[unlikely]] { return false; }
+                if(stack.size() < frames.back_unchecked().entry_height + param_count) [[unlikely]] { return false; }
+
+                auto const frame_base{get_slot(local_base, function.local_count)};
+                auto const first_arg{stack.size() - param_count};
+                for(::std::size_t i{}; i != param_count; ++i)
+                {
+                    auto const& arg{stack.index_unchecked(first_arg + i)};
+                    if(static_cast<wasm_byte>(arg.type) != static_cast<wasm_byte>(function_type_ptr->parameter.begin[i])) [[unlikely]] { return false; }
+                    builder.CreateStore(arg.value, get_slot(frame_base, i));
+                }
+                stack.resize(first_arg);
+
+                emit_call(frame_base);
+
+                if(result_count != 0uz)
+                {
+                    auto const type{static_cast<value_type>(static_cast<wasm_byte>(function_type_ptr->result.begin[0]))};
+                    push(type, builder.CreateLoad(get_llvm_type(type), frame_base));
+                }
+                reload_memory();
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_call() noexcept
+            {
+                wasm_u32 callee_index;  // No initialization necessary
+                if(!read_leb128(callee_index) || static_cast<::std::size_t>(callee_index) >= module.function_index_space.size()) [[unlikely]]
+                {
+                    return false;
+                }
+                auto const& callee{module.function_index_space.index_unchecked(static_cast<::std::size_t>(callee_index))};
+
+                auto const callee_binding{get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::function, static_cast<::std::size_t>(callee_index))};
+                auto const call_type{::llvm::FunctionType::get(void_type, {ptr_type, ptr_type, ptr_type}, false)};
+                return lower_call_with_frame(callee.function_type_ptr,
+                                             [&](::llvm::Value* frame_base) noexcept
+                                             {
+                                                 if(callee.kind == ::uwvm2::compiler::uwvm_int::callable_kind::compiled)
+                                                 {
+                                                     call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::invoke_compiled,
+                                                                  call_type,
+                                                                  {callee_binding, frame_base, ctx});
+                                                 }
+                                                 else
+                                                 {
+                                                     call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::invoke_host,
+                                                                  call_type,
+                                                                  {callee_binding, frame_base, ctx});
+                                                 }
+                                             });
+            }
+
+            [[nodiscard]] inline bool lower_call_indirect() noexcept
+            {
+                wasm_u32 type_index;  // No initialization necessary
+                ::llvm::Value* element_index;  // No initialization necessary
+                if(!read_leb128(type_index) || !read_zero_byte()) [[unlikely]] { return false; }
+                if(module.table == nullptr || static_cast<::std::size_t>(type_index) >= module.function_type_count) [[unlikely]] { return false; }
+                if(!pop(value_type::i32, element_index)) [[unlikely]] { return false; }
+                auto const function_type_ptr{module.function_types + type_index};
+
+                return lower_call_with_frame(function_type_ptr,
+                                             [&](::llvm::Value* frame_base) noexcept
+                                             {
+                                                 call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::call_indirect,
+                                                              ::llvm::FunctionType::get(void_type, {ptr_type, ptr_type, i32_type, ptr_type, ptr_type}, false),
+                                                              {get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::table),
+                                                               get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::function_type, type_index),
+                                                               element_index,
+                                                               frame_base,
+                                                               ctx});
+                                             });
+            }
+
+            /// @brief variables
+
+            [[nodiscard]] inline bool read_local(::std::size_t& index) noexcept
+            {
+                wasm_u32 v;  // No initialization necessary
+                if(!read_leb128(v) || static_cast<::std::size_t>(v) >= locals.size()) [[unlikely]] { return false; }
+                index = static_cast<::std::size_t>(v);
+                return true;
+            }
+
+            [[nodiscard]] inline bool read_global(::std::size_t& index, ::uwvm2::compiler::uwvm_int::global_binding_t const*& global, value_type& type) noexcept
+            {
+                wasm_u32 v;  // No initialization necessary
+                if(!read_leb128(v) || static_cast<::std::size_t>(v) >= module.globals.size()) [[unlikely]] { return false; }
+                index = static_cast<::std::size_t>(v);
+                global = ::std::addressof(module.globals.index_unchecked(index));
+
+                if(global->storage == nullptr)
+                {
+                    type = static_cast<value_type>(static_cast<wasm_byte>(global->host.module_ptr->global_value_type_from_index(global->host.index)));
+                    return is_value_type(static_cast<wasm_byte>(type));
+                }
+                switch(global->storage->kind)
+                {
+                    case ::uwvm2::object::global::global_type::wasm_i32: type = value_type::i32; return true;
+                    case ::uwvm2::object::global::global_type::wasm_i64: type = value_type::i64; return true;
+                    case ::uwvm2::object::global::global_type::wasm_f32: type = value_type::f32; return true;
+                    case ::uwvm2::object::global::global_type::wasm_f64: type = value_type::f64; return true;
+                    [[unlikely]] default: return false;
+                }
+            }
+
+            [[nodiscard]] inline bool lower_global_get() noexcept
+            {
+                ::std::size_t global_index;  // No initialization necessary
+                ::uwvm2::compiler::uwvm_int::global_binding_t const* global;  // No initialization necessary
+                value_type type;  // No initialization necessary
+                if(!read_global(global_index, global, type)) [[unlikely]] { return false; }
+
+                if(global->storage == nullptr)
+                {
+                    auto const slot{alloca_builder.CreateAlloca(i64_type)};
+                    call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::host_global_get,
+                                 ::llvm::FunctionType::get(void_type, {ptr_type, ptr_type}, false),
+                                 {get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::global, global_index), slot});
+                    push(type, builder.CreateLoad(get_llvm_type(type), slot));
+                    return true;
+                }
+                // The symbol is the first member of `wasm_global_storage_t::storage`, the value.
+                push(type, builder.CreateLoad(get_llvm_type(type), get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::global, global_index)));
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_global_set() noexcept
+            {
+                ::std::size_t global_index;  // No initialization necessary
+                ::uwvm2::compiler::uwvm_int::global_binding_t const* global;  // No initialization necessary
+                value_type type;  // No initialization necessary
+                ::llvm::Value* v;  // No initialization necessary
+                if(!read_global(global_index, global, type) || !global->is_mutable || !pop(type, v)) [[unlikely]] { return false; }
+
+                if(global->storage == nullptr)
+                {
+                    auto const slot{alloca_builder.CreateAlloca(i64_type)};
+                    builder.CreateStore(v, slot);
+                    call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::host_global_set,
+                                 ::llvm::FunctionType::get(void_type, {ptr_type, ptr_type}, false),
+                                 {get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::global, global_index), slot});
+                    return true;
+                }
+                builder.CreateStore(v, get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::global, global_index));
+                return true;
+            }
+
+            /// @brief numeric
+
+            template <typename Fn>
+            [[nodiscard]] inline bool lower_unary(value_type type, value_type result_type, Fn&& fn) noexcept
+            {
+                ::llvm::Value* a;  // No initialization necessary
+                if(!pop(type, a)) [[unlikely]] { return false; }
+                push(result_type, fn(a));
+                return true;
+            }
+
+            template <typename Fn>
+            [[nodiscard]] inline bool lower_binary(value_type type, value_type result_type, Fn&& fn) noexcept
+            {
+                ::llvm::Value* a;  // No initialization necessary
+                ::llvm::Value* b;  // No initialization necessary
+                if(!pop(type, b) || !pop(type, a)) [[unlikely]] { return false; }
+                push(result_type, fn(a, b));
+                return true;
+            }
+
+            [[nodiscard]] inline bool lower_compare(value_type type, ::llvm::CmpInst::Predicate predicate) noexcept
+            {
+                return lower_binary(type,
+                                    value_type::i32,
+                                    [&](::llvm::Value* a, ::llvm::Value* b) noexcept
+                                    { return builder.CreateZExt(builder.CreateCmp(predicate, a, b), i32_type); });
+            }
+
+            [[nodiscard]] inline bool lower_eqz(value_type type) noexcept
+            {
+                return lower_unary(type,
+                                   value_type::i32,
+                                   [&](::llvm::Value* a) noexcept
+                                   { return builder.CreateZExt(builder.CreateICmpEQ(a, ::llvm::Constant::getNullValue(a->getType())), i32_type); });
+            }
+
+            [[nodiscard]] inline bool lower_int_unary_intrinsic(value_type type, ::llvm::Intrinsic::ID id, bool has_zero_flag) noexcept
+            {
+                return lower_unary(type,
+                                   type,
+                                   [&](::llvm::Value* a) noexcept -> ::llvm::Value*
+                                   {
+                                       // clz/ctz of zero is the bit width in wasm.
+                                       if(has_zero_flag) { return builder.CreateIntrinsic(id, {a->getType()}, {a, builder.getFalse()}); }
+                                       return builder.CreateIntrinsic(id, {a->getType()}, {a});
+                                   });
+            }
+
+            template <typename Fn>
+            [[nodiscard]] inline bool lower_int_binary(value_type type, Fn&& fn) noexcept
+            {
+                return lower_binary(type, type, ::std::forward<Fn>(fn));
+            }
+
+            [[nodiscard]] inline bool lower_div(value_type type, bool is_signed, bool is_rem) noexcept
+            {
+                return lower_binary(type,
+                                    type,
+                                    [&](::llvm::Value* a, ::llvm::Value* b) noexcept -> ::llvm::Value*
+                                    {
+                                        auto const int_type{a->getType()};
+                                        auto const zero{::llvm::ConstantInt::get(int_type, 0u)};
+                                        auto const minus_one{::llvm::ConstantInt::getSigned(int_type, -1)};
+                                        trap_if(builder.CreateICmpEQ(b, zero), ::uwvm2::compiler::uwvm_int::trap_kind::integer_divide_by_zero);
+                                        if(!is_signed) { return is_rem ? builder.CreateURem(a, b) : builder.CreateUDiv(a, b); }
+
+                                        auto const min{::llvm::ConstantInt::get(int_type, ::llvm::APInt::getSignedMinValue(int_type->getIntegerBitWidth()))};
+                                        if(!is_rem)
+                                        {
+                                            trap_if(builder.CreateAnd(builder.CreateICmpEQ(a, min), builder.CreateICmpEQ(b, minus_one)),
+                                                    ::uwvm2::compiler::uwvm_int::trap_kind::integer_overflow);
+                                            return builder.CreateSDiv(a, b);
+                                        }
+                                        // x rem -1 is 0 in wasm, but min srem -1 overflows in LLVM. x srem 1 is 0 as well.
+                                        auto const divisor{builder.CreateSelect(builder.CreateICmpEQ(b, minus_one), ::llvm::ConstantInt::get(int_type, 1u), b)};
+                                        return builder.CreateSRem(a, divisor);
+                                    });
+            }
+
+            /// @brief      Shift counts are taken modulo the bit width.
+            inline ::llvm::Value* mask_shift_count(::llvm::Value* b) noexcept
+            { return builder.CreateAnd(b, ::llvm::ConstantInt::get(b->getType(), b->getType()->getIntegerBitWidth() - 1u)); }
+
+            [[nodiscard]] inline bool lower_rotate(value_type type, ::llvm::Intrinsic::ID id) noexcept
+            {
+                return lower_int_binary(type,
+                                        [&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateIntrinsic(id, {a->getType()}, {a, a, b}); });
+            }
+
+            [[nodiscard]] inline bool lower_float_unary_intrinsic(value_type type, ::llvm::Intrinsic::ID id) noexcept
+            {
+                return lower_unary(type, type, [&](::llvm::Value* a) noexcept { return builder.CreateUnaryIntrinsic(id, a); });
+            }
+
+            [[nodiscard]] inline bool lower_float_binary_intrinsic(value_type type, ::llvm::Intrinsic::ID id) noexcept
+            {
+                return lower_binary(type, type, [&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateBinaryIntrinsic(id, a, b); });
+            }
+
+            /// @brief      float -> integer, trapping on NaN and on results that are not representable, like `trunc_s`/`trunc_u` of uwvm-int.
+            /// @details    The bounds are powers of two and therefore exact in both f32 and f64.
+            [[nodiscard]] inline bool lower_trunc(value_type type, value_type result_type, bool is_signed) noexcept
+            {
+                return lower_unary(type,
+                                   result_type,
+                                   [&](::llvm::Value* a) noexcept -> ::llvm::Value*
+                                   {
+                                       auto const float_type{a->getType()};
+                                       auto const int_type{get_llvm_type(result_type)};
+                                       auto const bits{static_cast<int>(int_type->getIntegerBitWidth())};
+
+                                       trap_if(builder.CreateFCmpUNO(a, a), ::uwvm2::compiler::uwvm_int::trap_kind::invalid_conversion_to_integer);
+
+                                       auto const t{builder.CreateUnaryIntrinsic(::llvm::Intrinsic::trunc, a)};
+                                       ::llvm::Value* in_range;  // No initialization necessary
+                                       if(is_signed)
+                                       {
+                                           auto const bound{::llvm::ConstantFP::get(float_type, ::std::ldexp(1.0, bits - 1))};
+                                           auto const lower{::llvm::ConstantFP::get(float_type, -::std::ldexp(1.0, bits - 1))};
+                                           in_range = builder.CreateAnd(builder.CreateFCmpOGE(t, lower), builder.CreateFCmpOLT(t, bound));
+                                       }
+                                       else
+                                       {
+                                           // -0.x truncates to -0, which compares equal to 0 and is accepted.
+                                           auto const bound{::llvm::ConstantFP::get(float_type, ::std::ldexp(1.0, bits))};
+                                           in_range = builder.CreateAnd(builder.CreateFCmpOGE(t, ::llvm::ConstantFP::get(float_type, 0.0)),
+                                                                        builder.CreateFCmpOLT(t, bound));
+                                       }
+                                       trap_if(builder.CreateNot(in_range), ::uwvm2::compiler::uwvm_int::trap_kind::integer_overflow);
+                                       return is_signed ? builder.CreateFPToSI(t, int_type) : builder.CreateFPToUI(t, int_type);
+                                   });
+            }
+
+            [[nodiscard]] inline bool lower_numeric(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+                using predicate = ::llvm::CmpInst::Predicate;
+
+                auto const add{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateAdd(a, b); }};
+                auto const sub{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateSub(a, b); }};
+                auto const mul{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateMul(a, b); }};
+                auto const and_{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateAnd(a, b); }};
+                auto const or_{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateOr(a, b); }};
+                auto const xor_{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateXor(a, b); }};
+                auto const shl{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateShl(a, mask_shift_count(b)); }};
+                auto const shr_s{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateAShr(a, mask_shift_count(b)); }};
+                auto const shr_u{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateLShr(a, mask_shift_count(b)); }};
+                auto const fadd{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateFAdd(a, b); }};
+                auto const fsub{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateFSub(a, b); }};
+                auto const fmul{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateFMul(a, b); }};
+                auto const fdiv{[&](::llvm::Value* a, ::llvm::Value* b) noexcept { return builder.CreateFDiv(a, b); }};
+                auto const fneg{[&](::llvm::Value* a) noexcept { return builder.CreateFNeg(a); }};
+
+                auto const convert{[&](value_type from, value_type to, ::llvm::Instruction::CastOps cast) noexcept
+                                   {
+                                       return lower_unary(from,
+                                                          to,
+                                                          [&](::llvm::Value* a) noexcept { return builder.CreateCast(cast, a, get_llvm_type(to)); });
+                                   }};
+
+                switch(op)
+                {
+                    case op_basic::i32_eqz: return lower_eqz(value_type::i32);
+                    case op_basic::i32_eq: return lower_compare(value_type::i32, predicate::ICMP_EQ);
+                    case op_basic::i32_ne: return lower_compare(value_type::i32, predicate::ICMP_NE);
+                    case op_basic::i32_lt_s: return lower_compare(value_type::i32, predicate::ICMP_SLT);
+                    case op_basic::i32_lt_u: return lower_compare(value_type::i32, predicate::ICMP_ULT);
+                    case op_basic::i32_gt_s: return lower_compare(value_type::i32, predicate::ICMP_SGT);
+                    case op_basic::i32_gt_u: return lower_compare(value_type::i32, predicate::ICMP_UGT);
+                    case op_basic::i32_le_s: return lower_compare(value_type::i32, predicate::ICMP_SLE);
+                    case op_basic::i32_le_u: return lower_compare(value_type::i32, predicate::ICMP_ULE);
+                    case op_basic::i32_ge_s: return lower_compare(value_type::i32, predicate::ICMP_SGE);
+                    case op_basic::i32_ge_u: return lower_compare(value_type::i32, predicate::ICMP_UGE);
+                    case op_basic::i64_eqz: return lower_eqz(value_type::i64);
+                    case op_basic::i64_eq: return lower_compare(value_type::i64, predicate::ICMP_EQ);
+                    case op_basic::i64_ne: return lower_compare(value_type::i64, predicate::ICMP_NE);
+                    case op_basic::i64_lt_s: return lower_compare(value_type::i64, predicate::ICMP_SLT);
+                    case op_basic::i64_lt_u: return lower_compare(value_type::i64, predicate::ICMP_ULT);
+                    case op_basic::i64_gt_s: return lower_compare(value_type::i64, predicate::ICMP_SGT);
+                    case op_basic::i64_gt_u: return lower_compare(value_type::i64, predicate::ICMP_UGT);
+                    case op_basic::i64_le_s: return lower_compare(value_type::i64, predicate::ICMP_SLE);
+                    case op_basic::i64_le_u: return lower_compare(value_type::i64, predicate::ICMP_ULE);
+                    case op_basic::i64_ge_s: return lower_compare(value_type::i64, predicate::ICMP_SGE);
+                    case op_basic::i64_ge_u: return lower_compare(value_type::i64, predicate::ICMP_UGE);
+                    // `ne` is the only unordered float comparison: it holds for NaN operands.
+                    case op_basic::f32_eq: return lower_compare(value_type::f32, predicate::FCMP_OEQ);
+                    case op_basic::f32_ne: return lower_compare(value_type::f32, predicate::FCMP_UNE);
+                    case op_basic::f32_lt: return lower_compare(value_type::f32, predicate::FCMP_OLT);
+                    case op_basic::f32_gt: return lower_compare(value_type::f32, predicate::FCMP_OGT);
+                    case op_basic::f32_le: return lower_compare(value_type::f32, predicate::FCMP_OLE);
+                    case op_basic::f32_ge: return lower_compare(value_type::f32, predicate::FCMP_OGE);
+                    case op_basic::f64_eq: return lower_compare(value_type::f64, predicate::FCMP_OEQ);
+                    case op_basic::f64_ne: return lower_compare(value_type::f64, predicate::FCMP_UNE);
+                    case op_basic::f64_lt: return lower_compare(value_type::f64, predicate::FCMP_OLT);
+                    case op_basic::f64_gt: return lower_compare(value_type::f64, predicate::FCMP_OGT);
+                    case op_basic::f64_le: return lower_compare(value_type::f64, predicate::FCMP_OLE);
+                    case op_basic::f64_ge: return lower_compare(value_type::f64, predicate::FCMP_OGE);
+                    case op_basic::i32_clz: return lower_int_unary_intrinsic(value_type::i32, ::llvm::Intrinsic::ctlz, true);
+                    case op_basic::i32_ctz: return lower_int_unary_intrinsic(value_type::i32, ::llvm::Intrinsic::cttz, true);
+                    case op_basic::i32_popcnt: return lower_int_unary_intrinsic(value_type::i32, ::llvm::Intrinsic::ctpop, false);
+                    case op_basic::i32_add: return lower_int_binary(value_type::i32, add);
+                    case op_basic::i32_sub: return lower_int_binary(value_type::i32, sub);
+                    case op_basic::i32_mul: return lower_int_binary(value_type::i32, mul);
+                    case op_basic::i32_div_s: return lower_div(value_type::i32, true, false);
+                    case op_basic::i32_div_u: return lower_div(value_type::i32, false, false);
+                    case op_basic::i32_rem_s: return lower_div(value_type::i32, true, true);
+                    case op_basic::i32_rem_u: return lower_div(value_type::i32, false, true);
+                    case op_basic::i32_and: return lower_int_binary(value_type::i32, and_);
+                    case op_basic::i32_or: return lower_int_binary(value_type::i32, or_);
+                    case op_basic::i32_xor: return lower_int_binary(value_type::i32, xor_);
+                    case op_basic::i32_shl: return lower_int_binary(value_type::i32, shl);
+                    case op_basic::i32_shr_s: return lower_int_binary(value_type::i32, shr_s);
+                    case op_basic::i32_shr_u: return lower_int_binary(value_type::i32, shr_u);
+                    case op_basic::i32_rotl: return lower_rotate(value_type::i32, ::llvm::Intrinsic::fshl);
+                    case op_basic::i32_rotr: return lower_rotate(value_type::i32, ::llvm::Intrinsic::fshr);
+                    case op_basic::i64_clz: return lower_int_unary_intrinsic(value_type::i64, ::llvm::Intrinsic::ctlz, true);
+                    case op_basic::i64_ctz: return lower_int_unary_intrinsic(value_type::i64, ::llvm::Intrinsic::cttz, true);
+                    case op_basic::i64_popcnt: return lower_int_unary_intrinsic(value_type::i64, ::llvm::Intrinsic::ctpop, false);
+                    case op_basic::i64_add: return lower_int_binary(value_type::i64, add);
+                    case op_basic::i64_sub: return lower_int_binary(value_type::i64, sub);
+                    case op_basic::i64_mul: return lower_int_binary(value_type::i64, mul);
+                    case op_basic::i64_div_s: return lower_div(value_type::i64, true, false);
+                    case op_basic::i64_div_u: return lower_div(value_type::i64, false, false);
+                    case op_basic::i64_rem_s: return lower_div(value_type::i64, true, true);
+                    case op_basic::i64_rem_u: return lower_div(value_type::i64, false, true);
+                    case op_basic::i64_and: return lower_int_binary(value_type::i64, and_);
+                    case op_basic::i64_or: return lower_int_binary(value_type::i64, or_);
+                    case op_basic::i64_xor: return lower_int_binary(value_type::i64, xor_);
+                    case op_basic::i64_shl: return lower_int_binary(value_type::i64, shl);
+                    case op_basic::i64_shr_s: return lower_int_binary(value_type::i64, shr_s);
+                    case op_basic::i64_shr_u: return lower_int_binary(value_type::i64, shr_u);
+                    case op_basic::i64_rotl: return lower_rotate(value_type::i64, ::llvm::Intrinsic::fshl);
+                    case op_basic::i64_rotr: return lower_rotate(value_type::i64, ::llvm::Intrinsic::fshr);
+                    case op_basic::f32_abs: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::fabs);
+                    case op_basic::f32_neg: return lower_unary(value_type::f32, value_type::f32, fneg);
+                    case op_basic::f32_ceil: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::ceil);
+                    case op_basic::f32_floor: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::floor);
+                    case op_basic::f32_trunc: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::trunc);
+                    case op_basic::f32_nearest: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::roundeven);
+                    case op_basic::f32_sqrt: return lower_float_unary_intrinsic(value_type::f32, ::llvm::Intrinsic::sqrt);
+                    case op_basic::f32_add: return lower_binary(value_type::f32, value_type::f32, fadd);
+                    case op_basic::f32_sub: return lower_binary(value_type::f32, value_type::f32, fsub);
+                    case op_basic::f32_mul: return lower_binary(value_type::f32, value_type::f32, fmul);
+                    case op_basic::f32_div: return lower_binary(value_type::f32, value_type::f32, fdiv);
+                    // minimum/maximum propagate NaN and order -0 below +0, like wasm.
+                    case op_basic::f32_min: return lower_float_binary_intrinsic(value_type::f32, ::llvm::Intrinsic::minimum);
+                    case op_basic::f32_max: return lower_float_binary_intrinsic(value_type::f32, ::llvm::Intrinsic::maximum);
+                    case op_basic::f32_copysign: return lower_float_binary_intrinsic(value_type::f32, ::llvm::Intrinsic::copysign);
+                    case op_basic::f64_abs: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::fabs);
+                    case op_basic::f64_neg: return lower_unary(value_type::f64, value_type::f64, fneg);
+                    case op_basic::f64_ceil: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::ceil);
+                    case op_basic::f64_floor: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::floor);
+                    case op_basic::f64_trunc: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::trunc);
+                    case op_basic::f64_nearest: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::roundeven);
+                    case op_basic::f64_sqrt: return lower_float_unary_intrinsic(value_type::f64, ::llvm::Intrinsic::sqrt);
+                    case op_basic::f64_add: return lower_binary(value_type::f64, value_type::f64, fadd);
+                    case op_basic::f64_sub: return lower_binary(value_type::f64, value_type::f64, fsub);
+                    case op_basic::f64_mul: return lower_binary(value_type::f64, value_type::f64, fmul);
+                    case op_basic::f64_div: return lower_binary(value_type::f64, value_type::f64, fdiv);
+                    case op_basic::f64_min: return lower_float_binary_intrinsic(value_type::f64, ::llvm::Intrinsic::minimum);
+                    case op_basic::f64_max: return lower_float_binary_intrinsic(value_type::f64, ::llvm::Intrinsic::maximum);
+                    case op_basic::f64_copysign: return lower_float_binary_intrinsic(value_type::f64, ::llvm::Intrinsic::copysign);
+                    case op_basic::i32_wrap_i64: return convert(value_type::i64, value_type::i32, ::llvm::Instruction::Trunc);
+                    case op_basic::i32_trunc_f32_s: return lower_trunc(value_type::f32, value_type::i32, true);
+                    case op_basic::i32_trunc_f32_u: return lower_trunc(value_type::f32, value_type::i32, false);
+                    case op_basic::i32_trunc_f64_s: return lower_trunc(value_type::f64, value_type::i32, true);
+                    case op_basic::i32_trunc_f64_u: return lower_trunc(value_type::f64, value_type::i32, false);
+                    case op_basic::i64_extend_i32_s: return convert(value_type::i32, value_type::i64, ::llvm::Instruction::SExt);
+                    case op_basic::i64_extend_i32_u: return convert(value_type::i32, value_type::i64, ::llvm::Instruction::ZExt);
+                    case op_basic::i64_trunc_f32_s: return lower_trunc(value_type::f32, value_type::i64, true);
+                    case op_basic::i64_trunc_f32_u: return lower_trunc(value_type::f32, value_type::i64, false);
+                    case op_basic::i64_trunc_f64_s: return lower_trunc(value_type::f64, value_type::i64, true);
+                    case op_basic::i64_trunc_f64_u: return lower_trunc(value_type::f64, value_type::i64, false);
+                    case op_basic::f32_convert_i32_s: return convert(value_type::i32, value_type::f32, ::llvm::Instruction::SIToFP);
+                    case op_basic::f32_convert_i32_u: return convert(value_type::i32, value_type::f32, ::llvm::Instruction::UIToFP);
+                    case op_basic::f32_convert_i64_s: return convert(value_type::i64, value_type::f32, ::llvm::Instruction::SIToFP);
+                    case op_basic::f32_convert_i64_u: return convert(value_type::i64, value_type::f32, ::llvm::Instruction::UIToFP);
+                    case op_basic::f32_demote_f64: return convert(value_type::f64, value_type::f32, ::llvm::Instruction::FPTrunc);
+                    case op_basic::f64_convert_i32_s: return convert(value_type::i32, value_type::f64, ::llvm::Instruction::SIToFP);
+                    case op_basic::f64_convert_i32_u: return convert(value_type::i32, value_type::f64, ::llvm::Instruction::UIToFP);
+                    case op_basic::f64_convert_i64_s: return convert(value_type::i64, value_type::f64, ::llvm::Instruction::SIToFP);
+                    case op_basic::f64_convert_i64_u: return convert(value_type::i64, value_type::f64, ::llvm::Instruction::UIToFP);
+                    case op_basic::f64_promote_f32: return convert(value_type::f32, value_type::f64, ::llvm::Instruction::FPExt);
+                    case op_basic::i32_reinterpret_f32: return convert(value_type::f32, value_type::i32, ::llvm::Instruction::BitCast);
+                    case op_basic::i64_reinterpret_f64: return convert(value_type::f64, value_type::i64, ::llvm::Instruction::BitCast);
+                    case op_basic::f32_reinterpret_i32: return convert(value_type::i32, value_type::f32, ::llvm::Instruction::BitCast);
+                    case op_basic::f64_reinterpret_i64: return convert(value_type::i64, value_type::f64, ::llvm::Instruction::BitCast);
+                    [[unlikely]] default: return false;
+                }
+            }
+
+            /// @brief      Skip one instruction in dead code, keeping track of nested blocks. Mirrors `skip_dead_instruction` of uwvm-int, which
+            ///             decides which loops are numbered.
+            /// @return     Whether the instruction must still be processed (the `else`/`end` closing the dead region).
+            [[nodiscard]] inline bool skip_dead_instruction(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op, bool& process) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+
+                process = false;
+                switch(op)
+                {
+                    case op_basic::block: [[fallthrough]];
+                    case op_basic::loop: [[fallthrough]];
+                    case op_basic::if_:
+                    {
+                        bool has_result;  // No initialization necessary
+                        value_type result_type;  // No initialization necessary
+                        if(!read_block_type(has_result, result_type)) [[unlikely]] { return false; }
+                        ++dead_depth;
+                        return true;
+                    }
+                    case op_basic::else_:
+                    {
+                        process = dead_depth == 0uz;
+                        return true;
+                    }
+                    case op_basic::end:
+                    {
+                        if(dead_depth == 0uz) { process = true; }
+                        else
+                        {
+                            --dead_depth;
+                        }
+                        return true;
+                    }
+                    case op_basic::unreachable: [[fallthrough]];
+                    case op_basic::nop: [[fallthrough]];
+                    case op_basic::return_: [[fallthrough]];
+                    case op_basic::drop: [[fallthrough]];
+                    case op_basic::select: return true;
+                    case op_basic::br: [[fallthrough]];
+                    case op_basic::br_if: [[fallthrough]];
+                    case op_basic::call: [[fallthrough]];
+                    case op_basic::local_get: [[fallthrough]];
+                    case op_basic::local_set: [[fallthrough]];
+                    case op_basic::local_tee: [[fallthrough]];
+                    case op_basic::global_get: [[fallthrough]];
+                    case op_basic::global_set:
+                    {
+                        wasm_u32 v;  // No initialization necessary
+                        return read_leb128(v);
+                    }
+                    case op_basic::br_table:
+                    {
+                        wasm_u32 count;  // No initialization necessary
+                        if(!read_leb128(count)) [[unlikely]] { return false; }
+                        for(wasm_u32 i{}; i <= count; ++i)
+                        {
+                            wasm_u32 v;  // No initialization necessary
+                            if(!read_leb128(v)) [[unlikely]] { return false; }
+                        }
+                        return true;
+                    }
+                    case op_basic::call_indirect:
+                    {
+                        wasm_u32 v;  // No initialization necessary
+                        return read_leb128(v) && read_zero_byte();
+                    }
+                    case op_basic::memory_size: [[fallthrough]];
+                    case op_basic::memory_grow: return read_zero_byte();
+                    case op_basic::i32_const:
+                    {
+                        wasm_i32 v;  // No initialization necessary
+                        return read_leb128(v);
+                    }
+                    case op_basic::i64_const:
+                    {
+                        wasm_i64 v;  // No initialization necessary
+                        return read_leb128(v);
+                    }
+                    case op_basic::f32_const:
+                    {
+                        ::std::uint_least32_t bits;  // No initialization necessary
+                        return read_float_bits(bits);
+                    }
+                    case op_basic::f64_const:
+                    {
+                        ::std::uint_least64_t bits;  // No initialization necessary
+                        return read_float_bits(bits);
+                    }
+                    default:
+                    {
+                        if(op >= op_basic::i32_load && op <= op_basic::i64_store32)
+                        {
+                            wasm_u32 align;  // No initialization necessary
+                            wasm_u32 offset;  // No initialization necessary
+                            return read_leb128(align) && read_leb128(offset);
+                        }
+                        // numeric instructions
+                        return op >= op_basic::i32_eqz && op <= op_basic::f64_reinterpret_i64;
+                    }
+                }
+            }
+
+            [[nodiscard]] inline bool lower_instruction(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op, bool& function_end) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+
+                switch(op)
+                {
+                    case op_basic::unreachable:
+                    {
+                        builder.CreateBr(get_trap_block(::uwvm2::compiler::uwvm_int::trap_kind::unreachable));
+                        set_unreachable();
+                        return true;
+                    }
+                    case op_basic::nop: return true;
+                    case op_basic::block:
+                    {
+                        bool has_result;  // No initialization necessary
+                        value_type result_type{};
+                        if(!read_block_type(has_result, result_type)) [[unlikely]] { return false; }
+                        push_frame(control_frame_kind::block, has_result, result_type);
+                        return true;
+                    }
+                    case op_basic::loop: return lower_loop();
+                    case op_basic::if_: return lower_if();
+                    case op_basic::else_: return lower_else();
+                    case op_basic::end: return lower_end(function_end);
+                    case op_basic::br:
+                    {
+                        wasm_u32 depth;  // No initialization necessary
+                        ::std::size_t index;  // No initialization necessary
+                        if(!read_leb128(depth) || !get_label(depth, index) || !branch_to(index)) [[unlikely]] { return false; }
+                        set_unreachable();
+                        return true;
+                    }
+                    case op_basic::br_if: return lower_br_if();
+                    case op_basic::br_table: return lower_br_table();
+                    case op_basic::return_:
+                    {
+                        if(!branch_to(0uz)) [[unlikely]] { return false; }
+                        set_unreachable();
+                        return true;
+                    }
+                    case op_basic::call: return lower_call();
+                    case op_basic::call_indirect: return lower_call_indirect();
+                    case op_basic::drop:
+                    {
+                        stack_value_t v;  // No initialization necessary
+                        return pop_any(v);
+                    }
+                    case op_basic::select:
+                    {
+                        ::llvm::Value* condition;  // No initialization necessary
+                        stack_value_t b;  // No initialization necessary
+                        ::llvm::Value* a;  // No initialization necessary
+                        if(!pop(value_type::i32, condition) || !pop_any(b) || !pop(b.type, a)) [[unlikely]] { return false; }
+                        push(b.type, builder.CreateSelect(builder.CreateICmpNE(condition, builder.getInt32(0u)), a, b.value));
+                        return true;
+                    }
+                    case op_basic::local_get:
+                    {
+                        ::std::size_t index;  // No initialization necessary
+                        if(!read_local(index)) [[unlikely]] { return false; }
+                        auto const type{local_types.index_unchecked(index)};
+                        push(type, builder.CreateLoad(get_llvm_type(type), locals.index_unchecked(index)));
+                        return true;
+                    }
+                    case op_basic::local_set: [[fallthrough]];
+                    case op_basic::local_tee:
+                    {
+                        ::std::size_t index;  // No initialization necessary
+                        ::llvm::Value* v;  // No initialization necessary
+                        if(!read_local(index) || !pop(local_types.index_unchecked(index), v)) [[unlikely]] { return false; }
+                        builder.CreateStore(v, locals.index_unchecked(index));
+                        if(op == op_basic::local_tee) { push(local_types.index_unchecked(index), v); }
+                        return true;
+                    }
+                    case op_basic::global_get: return lower_global_get();
+                    case op_basic::global_set: return lower_global_set();
+                    case op_basic::i32_load: return lower_load(value_type::i32, i32_type, false);
+                    case op_basic::i64_load: return lower_load(value_type::i64, i64_type, false);
+                    case op_basic::f32_load: return lower_load(value_type::f32, f32_type, false);
+                    case op_basic::f64_load: return lower_load(value_type::f64, f64_type, false);
+                    case op_basic::i32_load8_s: return lower_load(value_type::i32, i8_type, true);
+                    case op_basic::i32_load8_u: return lower_load(value_type::i32, i8_type, false);
+                    case op_basic::i32_load16_s: return lower_load(value_type::i32, ::llvm::Type::getInt16Ty(context), true);
+                    case op_basic::i32_load16_u: return lower_load(value_type::i32, ::llvm::Type::getInt16Ty(context), false);
+                    case op_basic::i64_load8_s: return lower_load(value_type::i64, i8_type, true);
+                    case op_basic::i64_load8_u: return lower_load(value_type::i64, i8_type, false);
+                    case op_basic::i64_load16_s: return lower_load(value_type::i64, ::llvm::Type::getInt16Ty(context), true);
+                    case op_basic::i64_load16_u: return lower_load(value_type::i64, ::llvm::Type::getInt16Ty(context), false);
+                    case op_basic::i64_load32_s: return lower_load(value_type::i64, i32_type, true);
+                    case op_basic::i64_load32_u: return lower_load(value_type::i64, i32_type, false);
+                    case op_basic::i32_store: return lower_store(value_type::i32, i32_type);
+                    case op_basic::i64_store: return lower_store(value_type::i64, i64_type);
+                    case op_basic::f32_store: return lower_store(value_type::f32, f32_type);
+                    case op_basic::f64_store: return lower_store(value_type::f64, f64_type);
+                    case op_basic::i32_store8: return lower_store(value_type::i32, i8_type);
+                    case op_basic::i32_store16: return lower_store(value_type::i32, ::llvm::Type::getInt16Ty(context));
+                    case op_basic::i64_store8: return lower_store(value_type::i64, i8_type);
+                    case op_basic::i64_store16: return lower_store(value_type::i64, ::llvm::Type::getInt16Ty(context));
+                    case op_basic::i64_store32: return lower_store(value_type::i64, i32_type);
+                    case op_basic::memory_size:
+                    {
+                        if(!read_zero_byte() || !module.has_memory) [[unlikely]] { return false; }
+                        push(value_type::i32,
+                             call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory_size,
+                                          ::llvm::FunctionType::get(i32_type, {ptr_type}, false),
+                                          {get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory)}));
+                        return true;
+                    }
+                    case op_basic::memory_grow:
+                    {
+                        ::llvm::Value* delta;  // No initialization necessary
+                        if(!read_zero_byte() || !module.has_memory || !pop(value_type::i32, delta)) [[unlikely]] { return false; }
+                        push(value_type::i32,
+                             call_runtime(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory_grow,
+                                          ::llvm::FunctionType::get(i32_type, {ptr_type, i32_type}, false),
+                                          {get_binding(::uwvm2::compiler::jit::llvm_jit::runtime::symbol::memory), delta}));
+                        reload_memory();
+                        return true;
+                    }
+                    case op_basic::i32_const:
+                    {
+                        wasm_i32 v;  // No initialization necessary
+                        if(!read_leb128(v)) [[unlikely]] { return false; }
+                        push(value_type::i32, builder.getInt32(static_cast<::std::uint_least32_t>(v)));
+                        return true;
+                    }
+                    case op_basic::i64_const:
+                    {
+                        wasm_i64 v;  // No initialization necessary
+                        if(!read_leb128(v)) [[unlikely]] { return false; }
+                        push(value_type::i64, builder.getInt64(static_cast<::std::uint_least64_t>(v)));
+                        return true;
+                    }
+                    case op_basic::f32_const:
+                    {
+                        // Built from the bits so that NaN payloads are kept.
+                        ::std::uint_least32_t bits;  // No initialization necessary
+                        if(!read_float_bits(bits)) [[unlikely]] { return false; }
+                        push(value_type::f32, ::llvm::ConstantFP::get(context, ::llvm::APFloat{::llvm::APFloat::IEEEsingle(), ::llvm::APInt{32u, bits}}));
+                        return true;
+                    }
+                    case op_basic::f64_const:
+                    {
+                        ::std::uint_least64_t bits;  // No initialization necessary
+                        if(!read_float_bits(bits)) [[unlikely]] { return false; }
+                        push(value_type::f64, ::llvm::ConstantFP::get(context, ::llvm::APFloat{::llvm::APFloat::IEEEdouble(), ::llvm::APInt{64u, bits}}));
+                        return true;
+                    }
+                    default: return lower_numeric(op);
+                }
+            }
+
+            /// @brief      Types of the locals, params first.
+            [[nodiscard]] inline bool collect_local_types() noexcept
+            {
+                auto const function_type_ptr{function.function_type_ptr};
+                for(auto curr_param{function_type_ptr->parameter.begin}; curr_param != function_type_ptr->parameter.end; ++curr_param)
+                {
+                    auto const type{static_cast<wasm_byte>(*curr_param)};
+                    if(!is_value_type(type)) [[unlikely]] { return false; }
+                    local_types.push_back(static_cast<value_type>(type));
+                }
+                for(auto const& entry: function.function_ptr->wasm_code_ptr->locals)
+                {
+                    auto const type{static_cast<wasm_byte>(entry.type)};
+                    if(!is_value_type(type)) [[unlikely]] { return false; }
+                    for(wasm_u32 i{}; i != entry.count; ++i) { local_types.push_back(static_cast<value_type>(type)); }
+                }
+                return local_types.size() == function.local_count;
+            }
+
+            /// @brief      Enter every recorded loop header from the interpreter frame: locals from their slots, the operand stack below `sp`.
+            inline void emit_osr_entries(::llvm::BasicBlock* normal_entry) noexcept
+            {
+                builder.SetInsertPoint(entry_block);
+                auto const dispatch{builder.CreateSwitch(loop_index, normal_entry, static_cast<unsigned>(osr_entry_points.size()))};
+
+                for(::std::size_t k{}; k != osr_entry_points.size(); ++k)
+                {
+                    auto const& point{osr_entry_points.index_unchecked(k)};
+                    auto const block{::llvm::BasicBlock::Create(context, "osr", body)};
+                    dispatch->addCase(builder.getInt32(static_cast<::std::uint_least32_t>(k)), block);
+                    builder.SetInsertPoint(block);
+
+                    for(::std::size_t i{}; i != locals.size(); ++i)
+                    {
+                        auto const type{local_types.index_unchecked(i)};
+                        builder.CreateStore(builder.CreateLoad(get_llvm_type(type), get_slot(local_base, i)), locals.index_unchecked(i));
+                    }
+                    // `sp` is one past the top of the operand stack.
+                    auto const stack_begin{
+                        builder.CreateConstInBoundsGEP1_64(i64_type, sp, static_cast<::std::uint_least64_t>(-static_cast<::std::int_least64_t>(point.height)))};
+                    for(::std::size_t i{}; i != point.height; ++i)
+                    {
+                        auto const type{osr_stack_types.index_unchecked(point.first_type + i)};
+                        builder.CreateStore(builder.CreateLoad(get_llvm_type(type), get_slot(stack_begin, i)), get_spill_slot(i, type));
+                    }
+                    reload_memory();
+                    builder.CreateBr(point.header);
+                }
+            }
+
+            [[nodiscard]] inline bool lower(::llvm::StringRef name) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+
+                if(!collect_local_types()) [[unlikely]] { return false; }
+                if(function.result_count > 1uz) [[unlikely]] { return false; }
+
+                // void body(local_base, sp, loop_index, ctx)
+                body = ::llvm::Function::Create(::llvm::FunctionType::get(void_type, {ptr_type, ptr_type, i32_type, ptr_type}, false),
+                                                ::llvm::GlobalValue::InternalLinkage,
+                                                name + ".body",
+                                                ir);
+                body->addFnAttr(::llvm::Attribute::NoUnwind);
+                body->addFnAttr(::llvm::Attribute::AlwaysInline);
+                local_base = body->getArg(0u);
+                sp = body->getArg(1u);
+                loop_index = body->getArg(2u);
+                ctx = body->getArg(3u);
+
+                entry_block = ::llvm::BasicBlock::Create(context, "entry", body);
+                alloca_builder.SetInsertPoint(entry_block);
+                auto const normal_entry{::llvm::BasicBlock::Create(context, "start", body)};
+                builder.SetInsertPoint(normal_entry);
+
+                locals.reserve(local_types.size());
+                for(::std::size_t i{}; i != local_types.size(); ++i)
+                {
+                    auto const type{local_types.index_unchecked(i)};
+                    auto const local{alloca_builder.CreateAlloca(get_llvm_type(type))};
+                    locals.push_back(local);
+                    // Declared locals start zeroed.
+                    builder.CreateStore(i < function.param_count ? builder.CreateLoad(get_llvm_type(type), get_slot(local_base, i)) : get_zero(type), local);
+                }
+                if(module.has_memory)
+                {
+                    memory_begin = alloca_builder.CreateAlloca(ptr_type);
+                    if(!module.memory.elide_bounds_checks) { memory_length = alloca_builder.CreateAlloca(i64_type); }
+                }
+                reload_memory();
+
+                control_frame_t function_frame{};
+                function_frame.end_block = ::llvm::BasicBlock::Create(context, "return", body);
+                function_frame.has_result = function.result_count != 0uz;
+                if(function_frame.has_result)
+                {
+                    function_frame.result_type = static_cast<value_type>(static_cast<wasm_byte>(function.function_type_ptr->result.begin[0]));
+                    if(!is_value_type(static_cast<wasm_byte>(function_frame.result_type))) [[unlikely]] { return false; }
+                }
+                function_frame.result = create_result(function_frame.end_block, function_frame.has_result, function_frame.result_type);
+                function_frame.kind = control_frame_kind::function;
+                frames.push_back(::std::move(function_frame));
+
+                for(;;)
+                {
+                    wasm_byte byte;  // No initialization necessary
+                    if(!read_byte(byte)) [[unlikely]] { return false; }
+                    auto const op{static_cast<op_basic>(byte)};
+
+                    if(frames.back_unchecked().unreachable)
+                    {
+                        bool process;  // No initialization necessary
+                        if(!skip_dead_instruction(op, process)) [[unlikely]] { return false; }
+                        if(!process) { continue; }
+                    }
+
+                    bool function_end{};
+                    if(!lower_instruction(op, function_end)) [[unlikely]] { return false; }
+                    if(function_end) { break; }
+                }
+                if(curr != end) [[unlikely]] { return false; }
+
+                // `lower_end` left the builder in the return block with the result on the stack.
+                if(function.result_count != 0uz) { builder.CreateStore(stack.back_unchecked().value, local_base); }
+                builder.CreateRetVoid();
+
+                if(emit_osr && !osr_entry_points.empty()) { emit_osr_entries(normal_entry); }
+                else
+                {
+                    builder.SetInsertPoint(entry_block);
+                    builder.CreateBr(normal_entry);
+                }
+                return true;
+            }
+        };
+    }  // namespace details
+
+    /// @brief      Lower the body of `function` (already translated by uwvm-int) into `ir`.
+    /// @details    Defines `entry_name` as `tier2_code_t::entry` and, if `osr_name` is not empty, `osr_name` as `tier2_code_t::osr_entry`.
+    /// @return     Whether the body could be lowered. `ir` must be discarded otherwise.
+    inline bool lower_function(::uwvm2::compiler::uwvm_int::compiled_module_t const& module,
+                               ::uwvm2::compiler::uwvm_int::compiled_function_t const& function,
+                               ::llvm::Module& ir,
+                               ::llvm::StringRef entry_name,
+                               ::llvm::StringRef osr_name) noexcept
+    {
+        auto& context{ir.getContext()};
+        details::function_lowering_t lowering{module, function, ir, context, ::llvm::IRBuilder<>{context}, ::llvm::IRBuilder<>{context}};
+        lowering.emit_osr = !osr_name.empty();
+        lowering.big_endian = ir.getDataLayout().isBigEndian();
+
+        auto const code_ptr{function.function_ptr->wasm_code_ptr};
+        lowering.curr = code_ptr->body.expr_begin;
+        lowering.end = code_ptr->body.code_end;
+
+        lowering.void_type = ::llvm::Type::getVoidTy(context);
+        lowering.i8_type = ::llvm::Type::getInt8Ty(context);
+        lowering.i32_type = ::llvm::Type::getInt32Ty(context);
+        lowering.i64_type = ::llvm::Type::getInt64Ty(context);
+        lowering.f32_type = ::llvm::Type::getFloatTy(context);
+        lowering.f64_type = ::llvm::Type::getDoubleTy(context);
+        lowering.ptr_type = ::llvm::PointerType::get(context, 0u);
+
+        if(!lowering.lower(entry_name)) { return false; }
+
+        auto const ptr_type{lowering.ptr_type};
+        auto const i32_type{lowering.i32_type};
+        auto const void_type{lowering.void_type};
+        ::llvm::IRBuilder<> builder{context};
+
+        // void entry(local_base, ctx)
+        auto const entry{::llvm::Function::Create(::llvm::FunctionType::get(void_type, {ptr_type, ptr_type}, false),
+                                                  ::llvm::GlobalValue::ExternalLinkage,
+                                                  entry_name,
+                                                  ir)};
+        entry->addFnAttr(::llvm::Attribute::NoUnwind);
+        builder.SetInsertPoint(::llvm::BasicBlock::Create(context, "", entry));
+        builder.CreateCall(lowering.body,
+                           {entry->getArg(0u), ::llvm::ConstantPointerNull::get(::llvm::PointerType::get(context, 0u)),
+                            builder.getInt32(details::no_osr_loop), entry->getArg(1u)});
+        builder.CreateRetVoid();
+
+        if(!osr_name.empty())
+        {
+            // void osr_entry(local_base, sp, loop_index, ctx)
+            auto const osr{::llvm::Function::Create(lowering.body->getFunctionType(), ::llvm::GlobalValue::ExternalLinkage, osr_name, ir)};
+            osr->addFnAttr(::llvm::Attribute::NoUnwind);
+            builder.SetInsertPoint(::llvm::BasicBlock::Create(context, "", osr));
+            builder.CreateCall(lowering.body, {osr->getArg(0u), osr->getArg(1u), osr->getArg(2u), osr->getArg(3u)});
+            builder.CreateRetVoid();
+        }
+        return true;
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
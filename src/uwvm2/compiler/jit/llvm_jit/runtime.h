@@ -0,0 +1,171 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <string>
+# include <string_view>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::jit::llvm_jit
+{
+    /// @brief      Functions called by the generated code.
+    /// @details    The generated code refers to them and to the bindings of its module by the names in `runtime::symbol`, which the engine defines
+    ///             as absolute symbols when the code is linked. The object code therefore does not depend on where anything lives in this process
+    ///             and can be cached across runs. Everything that depends on the kind of a binding (vm-owned or local-imported memory, wasm or host
+    ///             callee) is decided here rather than in the generated code, apart from the callee and global kinds that the cache key covers.
+    namespace runtime
+    {
+        namespace symbol
+        {
+            inline constexpr ::std::string_view trap{"uwvm_trap"};
+            inline constexpr ::std::string_view invoke_compiled{"uwvm_invoke_compiled"};
+            inline constexpr ::std::string_view invoke_host{"uwvm_invoke_host"};
+            inline constexpr ::std::string_view call_indirect{"uwvm_call_indirect"};
+            inline constexpr ::std::string_view memory_begin{"uwvm_memory_begin"};
+            inline constexpr ::std::string_view memory_length{"uwvm_memory_length"};
+            inline constexpr ::std::string_view memory_size{"uwvm_memory_size"};
+            inline constexpr ::std::string_view memory_grow{"uwvm_memory_grow"};
+            inline constexpr ::std::string_view host_global_get{"uwvm_host_global_get"};
+            inline constexpr ::std::string_view host_global_set{"uwvm_host_global_set"};
+
+            // `memory_binding_t` of memory 0.
+            inline constexpr ::std::string_view memory{"uwvm_memory"};
+            // `table_binding_t` of table 0.
+            inline constexpr ::std::string_view table{"uwvm_table"};
+            // Indexed by function index: the `compiled_function_t` or `host_function_t` of the callee.
+            inline constexpr ::std::string_view function{"uwvm_function_"};
+            // Indexed by type index: the `function_type_t`.
+            inline constexpr ::std::string_view function_type{"uwvm_type_"};
+            // Indexed by global index: the value of a wasm-defined global, or the `host_global_binding_t` of a local-imported one.
+            inline constexpr ::std::string_view global{"uwvm_global_"};
+            // Indexed by defined function index: the entry and OSR entry of the generated code.
+            inline constexpr ::std::string_view entry{"uwvm_jit_"};
+            inline constexpr ::std::string_view osr_entry_suffix{"_osr"};
+
+            inline ::std::string get_indexed(::std::string_view prefix, ::std::size_t index) noexcept
+            {
+                ::std::string name{prefix};
+                name.append(::std::to_string(index));
+                return name;
+            }
+        }  // namespace symbol
+
+        /// @brief      Base address of memory 0. The allocator backends may move it when the memory grows, so the generated code reloads it after
+        ///             every call and `memory.grow`.
+        inline ::std::byte* memory_begin(::uwvm2::compiler::uwvm_int::memory_binding_t const* binding) noexcept
+        {
+            if(binding->native_memory != nullptr) { return ::uwvm2::compiler::uwvm_int::native_memory_accessor::view(binding).begin; }
+            return ::uwvm2::compiler::uwvm_int::local_imported_memory_accessor::view(binding).begin;
+        }
+
+        /// @brief      Accessible length of memory 0, in bytes.
+        inline ::std::uint_least64_t memory_length(::uwvm2::compiler::uwvm_int::memory_binding_t const* binding) noexcept
+        {
+            if(binding->native_memory != nullptr)
+            {
+                return static_cast<::std::uint_least64_t>(::uwvm2::compiler::uwvm_int::native_memory_accessor::view(binding).length);
+            }
+            return static_cast<::std::uint_least64_t>(::uwvm2::compiler::uwvm_int::local_imported_memory_accessor::view(binding).length);
+        }
+
+        inline ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 memory_size(::uwvm2::compiler::uwvm_int::memory_binding_t const* binding) noexcept
+        {
+            if(binding->native_memory != nullptr)
+            {
+                return static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(
+                    ::uwvm2::compiler::uwvm_int::native_memory_accessor::page_count(binding));
+            }
+            return static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(
+                ::uwvm2::compiler::uwvm_int::local_imported_memory_accessor::page_count(binding));
+        }
+
+        inline ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 memory_grow(::uwvm2::compiler::uwvm_int::memory_binding_t const* binding,
+                                                                                 ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 delta) noexcept
+        {
+            if(binding->native_memory != nullptr) { return ::uwvm2::compiler::uwvm_int::native_memory_accessor::grow(binding, delta); }
+            return ::uwvm2::compiler::uwvm_int::local_imported_memory_accessor::grow(binding, delta);
+        }
+
+        /// @brief      Globals of local-imported modules, read and written in the layout of a slot.
+        inline void host_global_get(::uwvm2::compiler::uwvm_int::host_global_binding_t const* host_global,
+                                    ::uwvm2::compiler::uwvm_int::wasm_value_slot_t* out) noexcept
+        { host_global->module_ptr->global_get_from_index(host_global->index, out->storage); }
+
+        inline void host_global_set(::uwvm2::compiler::uwvm_int::host_global_binding_t const* host_global,
+                                    ::uwvm2::compiler::uwvm_int::wasm_value_slot_t const* in) noexcept
+        {
+            if(!host_global->module_ptr->global_set_from_index(host_global->index, in->storage)) [[unlikely]]
+            {
+                // Mutability has been checked during lowering.
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+            }
+        }
+
+        /// @brief      `call_indirect` with the arguments at `frame_base`, checked like `op_call_indirect`. Results are left at `frame_base`.
+        inline void call_indirect(::uwvm2::compiler::uwvm_int::table_binding_t const* table,
+                                  ::uwvm2::compiler::uwvm_int::function_type_t const* function_type_ptr,
+                                  ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index,
+                                  ::uwvm2::compiler::uwvm_int::wasm_value_slot_t* frame_base,
+                                  ::uwvm2::compiler::uwvm_int::execution_context_t* ctx) noexcept
+        {
+            auto const& elems{table->elems};
+            if(static_cast<::std::size_t>(index) >= elems.size()) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::undefined_element);
+            }
+
+            auto const& callee{elems.index_unchecked(static_cast<::std::size_t>(index))};
+            if(callee.kind == ::uwvm2::compiler::uwvm_int::callable_kind::null_ref) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::uninitialized_element);
+            }
+            if(!::uwvm2::compiler::uwvm_int::function_type_equal(callee.function_type_ptr, function_type_ptr)) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::indirect_call_type_mismatch);
+            }
+
+            ::uwvm2::compiler::uwvm_int::invoke_callable(callee, frame_base, ctx);
+        }
+    }  // namespace runtime
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,165 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))  // posix mmap
+#  include <sys/mman.h>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/object/memory/platform_page/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      One block holding the translated code (ops and `br_table` targets) of every eagerly translated function of a module.
+    /// @details    It is filled once after translation and then sealed. With POSIX mmap the pages become read-only, so a stray write into the
+    ///             translated code faults instead of changing what runs. Elsewhere the arena is an aligned heap block and sealing does nothing.
+    struct code_arena_t
+    {
+        inline static constexpr ::std::size_t alignment{64uz};
+
+        using allocator_t = ::fast_io::native_global_allocator;
+
+        ::std::byte* memory_begin{};
+        ::std::size_t memory_length{};
+
+        inline constexpr code_arena_t() noexcept = default;
+
+        inline constexpr code_arena_t(code_arena_t const&) noexcept = delete;
+        inline constexpr code_arena_t& operator= (code_arena_t const&) noexcept = delete;
+
+        inline constexpr code_arena_t(code_arena_t&& other) noexcept :
+            memory_begin{::std::exchange(other.memory_begin, nullptr)}, memory_length{::std::exchange(other.memory_length, 0uz)}
+        {
+        }
+
+        inline code_arena_t& operator= (code_arena_t&& other) noexcept
+        {
+            if(::std::addressof(other) == this) [[unlikely]] { return *this; }
+            this->clear();
+            this->memory_begin = ::std::exchange(other.memory_begin, nullptr);
+            this->memory_length = ::std::exchange(other.memory_length, 0uz);
+            return *this;
+        }
+
+        inline ~code_arena_t() { this->clear(); }
+
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))
+        inline static ::std::size_t round_up_to_page(::std::size_t length) noexcept
+        {
+            auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+            if(!success || page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            auto const page_size_minus_1{page_size - 1uz};
+            if(length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { ::fast_io::fast_terminate(); }
+            return (length + page_size_minus_1) & ~page_size_minus_1;
+        }
+#endif
+
+        /// @brief      Allocate `length` writable bytes, releasing the previous block.
+        inline void allocate(::std::size_t length) noexcept
+        {
+            this->clear();
+            if(length == 0uz) { return; }
+
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))
+            auto const mapping_length{round_up_to_page(length)};
+
+            // sys_mmap may throw ::fast_io::error
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                this->memory_begin = ::fast_io::details::sys_mmap(nullptr, mapping_length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0u);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                ::fast_io::fast_terminate();
+            }
+# endif
+#else
+            this->memory_begin = static_cast<::std::byte*>(allocator_t::allocate_aligned(alignment, length));
+#endif
+            this->memory_length = length;
+        }
+
+        /// @brief      Make the arena read-only, it must not be written afterwards.
+        inline void seal() noexcept
+        {
+            if(this->memory_begin == nullptr) { return; }
+
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))
+            // sys_mprotect may throw ::fast_io::error
+# ifdef UWVM_CPP_EXCEPTIONS
+            try
+# endif
+            {
+                ::fast_io::details::sys_mprotect(this->memory_begin, round_up_to_page(this->memory_length), PROT_READ);
+            }
+# ifdef UWVM_CPP_EXCEPTIONS
+            catch(::fast_io::error)
+            {
+                ::fast_io::fast_terminate();
+            }
+# endif
+#endif
+        }
+
+        inline void clear() noexcept
+        {
+            if(this->memory_begin == nullptr) { return; }
+
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__))
+            // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
+            if(::fast_io::details::sys_munmap_nothrow(this->memory_begin, round_up_to_page(this->memory_length))) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+#else
+            allocator_t::deallocate_aligned_n(this->memory_begin, alignment, this->memory_length);
+#endif
+            this->memory_begin = nullptr;
+            this->memory_length = 0uz;
+        }
+    };
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
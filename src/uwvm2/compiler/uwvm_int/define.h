@@ -0,0 +1,422 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <atomic>
+# include <limits>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/compiler/checker/impl.h>
+# include "arena.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      uwvm-int: a direct-threaded interpreter for wasm1 function bodies.
+    /// @details    Every defined function is translated once into a flat array of `op_t`. Each `op_t` holds the address of its handler and the already
+    ///             decoded immediates (constants, local indices, resolved globals/memories/callees and absolute branch targets). A handler executes its
+    ///             operation and then tail-calls the handler of the next op, so dispatching costs exactly one indirect jump per op and the raw wasm bytes
+    ///             are never looked at again after translation.
+    ///
+    ///             Frame layout (one contiguous slot array per thread):
+    ///             ```
+    ///             [ params | declared locals | operand stack ... ]
+    ///               ^^ local_base                               ^^ sp (one past the top)
+    ///             ```
+    ///             Arguments of a call are already the top `param_count` slots of the caller's operand stack, so the callee frame starts there and no
+    ///             copy is needed. Results are written back starting at `local_base`.
+    ///
+    ///             The height of the operand stack is known at every instruction, so every operand has a fixed slot in the frame. Numeric
+    ///             instructions are therefore translated into register ops (`register_immediate_t`) that name their source and destination slots
+    ///             directly: `local.get a; local.get b; i32.add; local.set c` becomes one op reading locals `a`/`b` and writing local `c`.
+    ///
+    ///             Frequent instruction sequences are further fused into superinstructions (`local.get; i32.load`, `i32.const; i32.add`, a
+    ///             compare followed by `br_if`, `local.tee; br_if`, ...). A superinstruction whose immediates do not fit into one `op_t` spills
+    ///             the rest into the following op, which is never dispatched (`op_immediate_extension`).
+    ///
+    ///             Top-of-stack caching: the result of a register op that is consumed by the next register op does not go through its slot. It is
+    ///             passed in the `ti` (i32/i64) or `tf` (f32/f64) handler argument instead, which the calling convention keeps in a machine
+    ///             register. Which values are cached is decided at translation time, every register handler exists in variants for a cached
+    ///             source and/or a cached result. A value that ends up not being consumed by a register op (a block boundary, a call, ...) is
+    ///             spilled by switching its producer back to the variant that writes the slot, so spilling costs nothing at run time.
+    ///
+    ///             Lazy translation (`runtime_mode_t::lazy_compile`): a defined function starts as a stub without ops. Its first call translates the
+    ///             body and publishes the ops through `compiled_function_t::entry`, later calls (from any thread) only load that pointer.
+
+    using function_type_t = ::uwvm2::uwvm::runtime::storage::wasm_binfmt1_final_function_type_t;
+    using local_imported_t = ::uwvm2::uwvm::wasm::type::local_imported_t;
+
+    /// @brief      One operand-stack or local slot. Every wasm1 value (i32/i64/f32/f64) occupies exactly one slot and is stored at the beginning of it
+    ///             in native byte order. Values are always accessed through `slot_load`/`slot_store` (memcpy), so no union punning is involved.
+    struct wasm_value_slot_t
+    {
+        alignas(8) ::std::byte storage[8];
+    };
+
+    static_assert(sizeof(wasm_value_slot_t) == 8uz);
+
+    template <typename T>
+    UWVM_ALWAYS_INLINE inline T slot_load(wasm_value_slot_t const* slot) noexcept
+    {
+        static_assert(::std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(wasm_value_slot_t));
+        T v;  // No initialization necessary
+        ::std::memcpy(::std::addressof(v), slot->storage, sizeof(T));
+        return v;
+    }
+
+    template <typename T>
+    UWVM_ALWAYS_INLINE inline void slot_store(wasm_value_slot_t* slot, T v) noexcept
+    {
+        static_assert(::std::is_trivially_copyable_v<T> && sizeof(T) <= sizeof(wasm_value_slot_t));
+        ::std::memcpy(slot->storage, ::std::addressof(v), sizeof(T));
+    }
+
+    struct op_t;
+    struct execution_context_t;
+    struct compiled_function_t;
+    struct compiled_module_t;
+
+    /// @brief      Top-of-stack cache registers. f32 values are kept as their bits in the low half of `tos_float_t`.
+    using tos_int_t = ::std::uint_least64_t;
+    using tos_float_t = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+    /// @brief      Signature shared by all handlers. Keeping it identical for every handler is what allows `UWVM_MUSTTAIL` dispatch.
+    using op_handler_t = void (*)(op_t const* ip,
+                                  wasm_value_slot_t* sp,
+                                  wasm_value_slot_t* local_base,
+                                  execution_context_t* ctx,
+                                  tos_int_t ti,
+                                  tos_float_t tf) noexcept;
+
+    /// @brief      A resolved branch.
+    /// @details    Taking the branch keeps the top `arity` values, discards the `drop` values below them and continues at `target`.
+    struct branch_target_t
+    {
+        op_t const* target{};
+        ::std::uint_least32_t drop{};
+        ::std::uint_least32_t arity{};
+    };
+
+    /// @brief      Memory 0 of a module, resolved through the import chain.
+    /// @details    Exactly one of `native_memory` / `local_imported_module` is set for a module that has a memory.
+    struct memory_binding_t
+    {
+        ::uwvm2::object::memory::linear::native_memory_t* native_memory{};
+
+        local_imported_t* local_imported_module{};
+        ::std::size_t local_imported_index{};
+
+        // `memory.grow` upper bound in pages (declared maximum, or the whole wasm32 address space).
+        ::std::uint_least64_t max_page_count{};
+
+        // The native memory rejects every out of bounds access by page protection, loads and stores are emitted without bounds checks.
+        bool elide_bounds_checks{};
+    };
+
+    /// @brief      A global that lives in a local-imported (host) module and can only be reached through its accessors.
+    struct host_global_binding_t
+    {
+        local_imported_t* module_ptr{};
+        ::std::size_t index{};
+    };
+
+    /// @brief      Global index space entry.
+    struct global_binding_t
+    {
+        // Set for wasm-defined globals (possibly owned by another module).
+        ::uwvm2::object::global::wasm_global_storage_t* storage{};
+        // Set for local-imported globals.
+        host_global_binding_t host{};
+        bool is_mutable{};
+    };
+
+    enum class host_function_kind : unsigned
+    {
+        none,
+        local_imported,
+#if defined(UWVM_SUPPORT_PRELOAD_DL) || defined(UWVM_SUPPORT_WEAK_SYMBOL)
+        capi,
+#endif
+    };
+
+    /// @brief      A function implemented by the host. Both `local_imported_t::call_func_index` and the C-API take packed parameter/result buffers.
+    struct host_function_t
+    {
+        function_type_t const* function_type_ptr{};
+
+        local_imported_t* module_ptr{};
+        ::std::size_t index{};
+#if defined(UWVM_SUPPORT_PRELOAD_DL) || defined(UWVM_SUPPORT_WEAK_SYMBOL)
+        ::uwvm2::uwvm::wasm::type::capi_function_t const* capi_ptr{};
+#endif
+
+        ::std::size_t param_count{};
+        ::std::size_t result_count{};
+        ::std::size_t param_bytes{};
+        ::std::size_t result_bytes{};
+
+        host_function_kind kind{};
+    };
+
+    enum class callable_kind : unsigned
+    {
+        null_ref,
+        compiled,
+        host
+    };
+
+    /// @brief      A fully resolved function reference (function index space entry / table element).
+    struct callable_t
+    {
+        compiled_function_t const* compiled{};
+        host_function_t const* host{};
+        function_type_t const* function_type_ptr{};
+        callable_kind kind{};
+    };
+
+    /// @brief      Table 0 of a module, with every element already resolved to a `callable_t`.
+    /// @note       wasm1 tables are only written by active element segments, which have been applied by the initializer before binding.
+    struct table_binding_t
+    {
+        ::uwvm2::utils::container::vector<callable_t> elems{};
+        ::uwvm2::uwvm::runtime::storage::local_defined_table_storage_t const* table_ptr{};
+    };
+
+    struct memarg_immediate_t
+    {
+        memory_binding_t* memory{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 offset{};
+    };
+
+    struct br_table_immediate_t
+    {
+        // `count` case targets followed by the default target.
+        branch_target_t const* targets{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 count{};
+    };
+
+    /// @brief      Operands of a register op, as slot indices relative to `local_base` (locals first, operand stack slots from `local_count` on).
+    struct register_immediate_t
+    {
+        ::std::uint_least32_t src1{};
+        // Second operand, or the bits of the `i32.const` right operand of a `*_reg_const` superinstruction.
+        ::std::uint_least32_t src2{};
+        ::std::uint_least32_t dst{};
+        // Change of the materialized operand stack height, `sp` is only kept in sync for the stack ops around the register op.
+        ::std::int_least32_t sp_delta{};
+    };
+
+    /// @brief      Memory access whose address is read from a local (`local.get; *.load`).
+    struct local_memarg_immediate_t
+    {
+        memory_binding_t* memory{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 offset{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 local{};
+    };
+
+    struct call_indirect_immediate_t
+    {
+        table_binding_t const* table{};
+        function_type_t const* function_type_ptr{};
+    };
+
+    /// @brief      Loop header of a function in tiered execution.
+    struct tier_up_loop_immediate_t
+    {
+        compiled_function_t const* function{};
+        // Index of the loop among the reachable `loop` instructions of the body, in body order.
+        ::std::uint_least32_t loop_index{};
+    };
+
+    union op_immediate_u
+    {
+        // The default member initializer keeps the union default-constructible although some variant members carry their own initializers.
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index{};
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32 i32;
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64 i64;
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32 f32;
+        ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64 f64;
+        ::uwvm2::object::global::wasm_global_storage_t* global;
+        host_global_binding_t const* host_global;
+        memarg_immediate_t memarg;
+        memory_binding_t* memory;
+        branch_target_t branch;
+        br_table_immediate_t br_table;
+        compiled_function_t const* callee;
+        host_function_t const* host;
+        call_indirect_immediate_t call_indirect;
+        register_immediate_t reg;
+        local_memarg_immediate_t local_memarg;
+        tier_up_loop_immediate_t tier_up_loop;
+    };
+
+    /// @brief      One translated operation.
+    struct op_t
+    {
+        op_handler_t handler{};
+        op_immediate_u imm{};
+    };
+
+    enum class lazy_translation_state : unsigned
+    {
+        stub,
+        translating,
+        translated
+    };
+
+    /// @brief      Native code built for a hot function by the tier-up compiler, see `tier_up_compiler_t`.
+    /// @details    Both entries use the frame layout of the interpreter and leave the results at `local_base`, like a return op.
+    struct tier2_code_t
+    {
+        // Runs the whole function, whose parameters and zeroed locals are in place.
+        void (*entry)(wasm_value_slot_t* local_base, execution_context_t* ctx) noexcept {};
+        // Continues the function at the header of its `loop_index`-th loop, with the operand stack ending at `sp`. May be null.
+        void (*osr_entry)(wasm_value_slot_t* local_base, wasm_value_slot_t* sp, ::std::uint_least32_t loop_index, execution_context_t* ctx) noexcept {};
+    };
+
+    enum class tier_up_state : unsigned
+    {
+        interpreted,
+        queued,
+        compiled,
+        failed
+    };
+
+    /// @brief      Translated form of a defined function.
+    struct compiled_function_t
+    {
+        // Emptied once eager translation has moved the body into `compiled_module_t::code_arena`.
+        ::uwvm2::utils::container::vector<op_t> ops{};
+        ::uwvm2::utils::container::vector<branch_target_t> br_table_targets{};
+
+        // First op of the translated body, null while the function is a lazy stub. Only accessed through `::std::atomic_ref` after
+        // instantiation; the body and the frame sizes below are published by its release store.
+        mutable op_t const* entry{};
+        // Guards the translation of a lazy stub so that only one thread translates it, see `translate_on_first_call`.
+        mutable lazy_translation_state lazy_state{};
+
+        // Hotness counters of tiered execution, only written by the thread running the function.
+        mutable ::std::uint_least32_t call_count{};
+        mutable ::std::uint_least32_t loop_count{};
+        // Native code once the tier-up compiler has built it, published by a release store. Only accessed through `::std::atomic_ref`.
+        mutable tier2_code_t const* tier2_code{};
+        mutable tier_up_state tier_state{};
+
+        ::uwvm2::uwvm::runtime::storage::local_defined_function_storage_t const* function_ptr{};
+        function_type_t const* function_type_ptr{};
+        compiled_module_t* module_ptr{};
+
+        ::std::size_t param_count{};
+        ::std::size_t result_count{};
+        // params + declared locals
+        ::std::size_t local_count{};
+        ::std::size_t max_operand_height{};
+        // local_count + max_operand_height
+        ::std::size_t frame_slot_count{};
+    };
+
+    /// @brief      Per-module interpreter state built from `::uwvm2::uwvm::runtime::storage::wasm_module_storage_t`.
+    struct compiled_module_t
+    {
+        ::uwvm2::utils::container::u8string_view module_name{};
+        ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t* runtime_module_ptr{};
+
+        // Type section, used by `call_indirect`.
+        function_type_t const* function_types{};
+        ::std::size_t function_type_count{};
+
+        // Index spaces as seen by the validator, every body is validated against them before it is translated.
+        ::uwvm2::compiler::checker::module_context_t validation_context{};
+
+        // Indexed by defined function index (function index - imported function count).
+        ::uwvm2::utils::container::vector<compiled_function_t> functions{};
+        // Indexed by imported function index. Only entries whose import finally resolves to a host function are used.
+        ::uwvm2::utils::container::vector<host_function_t> host_functions{};
+        // Function index space.
+        ::uwvm2::utils::container::vector<callable_t> function_index_space{};
+        // Global index space.
+        ::uwvm2::utils::container::vector<global_binding_t> globals{};
+
+        memory_binding_t memory{};
+        table_binding_t const* table{};
+        bool has_memory{};
+
+        // Start section, in the function index space.
+        ::std::size_t start_function_index{};
+        bool has_start_function{};
+
+        // Bytes of the wasm file, verification errors are reported at their offset in it.
+        ::std::byte const* module_begin{};
+        ::std::byte const* module_end{};
+        // Report bodies that fail to translate as verification errors, see `verification_error`.
+        bool report_verification_errors{};
+        // Translate with the hotness counters and loop headers of tiered execution.
+        bool tier_up{};
+        // Per-module state of the tier-up compiler, owned and synchronized by it.
+        mutable void* tier2_state{};
+
+        // Code of the eagerly translated functions, their `entry` points into it.
+        code_arena_t code_arena{};
+    };
+
+    /// @brief      Per-thread execution state.
+    struct execution_context_t
+    {
+        ::uwvm2::utils::container::vector<wasm_value_slot_t> stack{};
+        wasm_value_slot_t* stack_end{};
+
+        ::std::size_t call_depth{};
+        ::std::size_t max_call_depth{};
+
+        // Scratch space for packing host call parameters and results.
+        ::uwvm2::utils::container::vector<::std::byte> host_call_buffer{};
+    };
+
+    /// @brief      Default operand stack size, in slots (8 MiB).
+    inline constexpr ::std::size_t default_stack_slot_count{1uz << 20u};
+
+    /// @brief      Default maximum wasm call depth. Each wasm call costs one native frame of the caller's call handler.
+    inline constexpr ::std::size_t default_max_call_depth{1uz << 14u};
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,56 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <memory>
+#include <type_traits>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+export module uwvm2.compiler.uwvm_int:handler;
+
+import fast_io;
+import uwvm2.utils.container;
+import uwvm2.utils.debug;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.object;
+import :define;
+import :tier;
+import :trap;
+import :memory;
+import :numeric;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "handler.h"
@@ -0,0 +1,893 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <atomic>
+# include <bit>
+# include <concepts>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/object/impl.h>
+# include "define.h"
+# include "tier.h"
+# include "trap.h"
+# include "memory.h"
+# include "numeric.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+/// @brief      Handlers of the direct-threaded interpreter.
+/// @details    Every handler has the `op_handler_t` signature. It performs its operation, advances `ip` and tail-calls the next handler through
+///             `UWVM_MUSTTAIL`, so a function body runs as one chain of jumps without returning to a dispatch loop. The chain ends at a return op, which
+///             returns to the native caller (`invoke_compiled`).
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+    using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+    using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+    using wasm_f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+    using wasm_f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+    /// @brief      Size of a value in the packed host-call layout.
+    inline constexpr ::std::size_t get_value_type_size(::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte type) noexcept
+    {
+        switch(type)
+        {
+            case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::i32):
+                [[fallthrough]];
+            case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::f32):
+            {
+                return 4uz;
+            }
+            case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::i64):
+                [[fallthrough]];
+            case static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(::uwvm2::parser::wasm::standard::wasm1::type::value_type::f64):
+            {
+                return 8uz;
+            }
+            [[unlikely]] default:
+            {
+                // Only wasm1 value types reach the interpreter.
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+                return 0uz;
+            }
+        }
+    }
+
+    inline constexpr ::std::size_t get_param_count(function_type_t const* function_type_ptr) noexcept
+    { return static_cast<::std::size_t>(function_type_ptr->parameter.end - function_type_ptr->parameter.begin); }
+
+    inline constexpr ::std::size_t get_result_count(function_type_t const* function_type_ptr) noexcept
+    { return static_cast<::std::size_t>(function_type_ptr->result.end - function_type_ptr->result.begin); }
+
+    /// @brief      Structural equality of two function types. Types from different modules (or duplicated entries of one type section) are distinct
+    ///             objects, so pointer equality is only the fast path.
+    inline constexpr bool function_type_equal(function_type_t const* lhs, function_type_t const* rhs) noexcept
+    {
+        if(lhs == rhs) { return true; }
+
+        auto const lhs_param_count{get_param_count(lhs)};
+        auto const lhs_result_count{get_result_count(lhs)};
+        if(lhs_param_count != get_param_count(rhs) || lhs_result_count != get_result_count(rhs)) { return false; }
+
+        for(::std::size_t i{}; i != lhs_param_count; ++i)
+        {
+            if(lhs->parameter.begin[i] != rhs->parameter.begin[i]) { return false; }
+        }
+        for(::std::size_t i{}; i != lhs_result_count; ++i)
+        {
+            if(lhs->result.begin[i] != rhs->result.begin[i]) { return false; }
+        }
+        return true;
+    }
+
+    /// @brief      Translate a lazy stub (or wait for the thread translating it) and return its published entry op. Defined in `translate.h`.
+#if defined(UWVM_MODULE)
+    extern "C++"
+#else
+    inline
+#endif
+        op_t const* translate_on_first_call(compiled_function_t const* function) noexcept;
+
+    /// @brief      Run a compiled function whose frame (arguments already in place) starts at `frame_base`. Results are left at `frame_base`.
+    inline void invoke_compiled(compiled_function_t const* function, wasm_value_slot_t* frame_base, execution_context_t* ctx) noexcept
+    {
+        auto ops{::std::atomic_ref<op_t const*>{function->entry}.load(::std::memory_order_acquire)};
+        if(ops == nullptr) [[unlikely]] { ops = translate_on_first_call(function); }
+
+        // The frame size is only known once the body has been translated.
+        if(static_cast<::std::size_t>(ctx->stack_end - frame_base) < function->frame_slot_count || ctx->call_depth >= ctx->max_call_depth) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::call_stack_exhausted);
+        }
+
+        // Declared locals start zeroed, an all-zero slot is 0 / +0.0 for every value type.
+        ::std::memset(frame_base + function->param_count, 0, (function->local_count - function->param_count) * sizeof(wasm_value_slot_t));
+
+        ++ctx->call_depth;
+        ops->handler(ops, frame_base + function->local_count, frame_base, ctx, tos_int_t{}, tos_float_t{});
+        --ctx->call_depth;
+    }
+
+    /// @brief      Call a host function with the arguments at `frame_base`. Results are left at `frame_base`.
+    /// @details    Host functions take tightly packed parameters and results, which differ from the one-slot-per-value layout of the stack.
+    inline void invoke_host(host_function_t const* host, wasm_value_slot_t* frame_base, execution_context_t* ctx) noexcept
+    {
+        auto const para{ctx->host_call_buffer.data()};
+        auto const res{para + host->param_bytes};
+
+        auto para_curr{para};
+        auto slot_curr{frame_base};
+        for(auto curr{host->function_type_ptr->parameter.begin}; curr != host->function_type_ptr->parameter.end; ++curr)
+        {
+            auto const size{get_value_type_size(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(*curr))};
+            ::std::memcpy(para_curr, slot_curr->storage, size);
+            para_curr += size;
+            ++slot_curr;
+        }
+
+        // A fault inside the host must not unwind through its frames, see `try_call_function`.
+        auto const trap_frame{current_trap_frame};
+        current_trap_frame = nullptr;
+
+        switch(host->kind)
+        {
+            case host_function_kind::local_imported:
+            {
+                host->module_ptr->call_func_index(host->index, res, para);
+                break;
+            }
+#if defined(UWVM_SUPPORT_PRELOAD_DL) || defined(UWVM_SUPPORT_WEAK_SYMBOL)
+            case host_function_kind::capi:
+            {
+                host->capi_ptr->func_ptr(res, para);
+                break;
+            }
+#endif
+            [[unlikely]] default:
+            {
+                // Unresolved imports are rejected at instantiation.
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+                break;
+            }
+        }
+
+        current_trap_frame = trap_frame;
+
+        auto res_curr{res};
+        slot_curr = frame_base;
+        for(auto curr{host->function_type_ptr->result.begin}; curr != host->function_type_ptr->result.end; ++curr)
+        {
+            auto const size{get_value_type_size(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(*curr))};
+            ::std::memcpy(slot_curr->storage, res_curr, size);
+            res_curr += size;
+            ++slot_curr;
+        }
+    }
+
+    /// @brief      Run any callable with the arguments at `frame_base`.
+    inline void invoke_callable(callable_t const& callee, wasm_value_slot_t* frame_base, execution_context_t* ctx) noexcept
+    {
+        if(callee.kind == callable_kind::compiled) [[likely]] { invoke_compiled(callee.compiled, frame_base, ctx); }
+        else
+        {
+            if(ctx->call_depth >= ctx->max_call_depth) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::call_stack_exhausted);
+            }
+            invoke_host(callee.host, frame_base, ctx);
+        }
+    }
+
+    /// @brief      Keep the top `arity` values and discard the `drop` values below them.
+    UWVM_ALWAYS_INLINE inline wasm_value_slot_t* unwind_operand_stack(wasm_value_slot_t* sp, branch_target_t const& branch) noexcept
+    {
+        if(branch.drop != 0u)
+        {
+            auto src{sp - branch.arity};
+            auto dst{src - branch.drop};
+            // dst < src, so copying forwards is safe even if the ranges overlap.
+            for(::std::uint_least32_t i{}; i != branch.arity; ++i) { *dst++ = *src++; }
+            sp -= branch.drop;
+        }
+        return sp;
+    }
+
+    /// @brief control
+
+    inline void op_unreachable(op_t const*, wasm_value_slot_t*, wasm_value_slot_t*, execution_context_t*, tos_int_t, tos_float_t) noexcept
+    { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::unreachable); }
+
+    /// @brief      Unconditional branch that does not need to touch the operand stack.
+    inline void op_jump(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        ip = ip->imm.branch.target;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_br(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        sp = unwind_operand_stack(sp, ip->imm.branch);
+        ip = ip->imm.branch.target;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_br_if(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        --sp;
+        if(slot_load<wasm_i32>(sp) != 0)
+        {
+            sp = unwind_operand_stack(sp, ip->imm.branch);
+            ip = ip->imm.branch.target;
+        }
+        else
+        {
+            ++ip;
+        }
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `br_if` whose target needs no stack adjustment.
+    inline void op_br_if_jump(op_t const* ip,
+                              wasm_value_slot_t* sp,
+                              wasm_value_slot_t* local_base,
+                              execution_context_t* ctx,
+                              tos_int_t ti,
+                              tos_float_t tf) noexcept
+    {
+        --sp;
+        if(slot_load<wasm_i32>(sp) != 0) { ip = ip->imm.branch.target; }
+        else
+        {
+            ++ip;
+        }
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      Branch if the condition is zero, used for `if` (the target is the `else` arm or the end).
+    inline void op_br_if_eqz_jump(op_t const* ip,
+                                  wasm_value_slot_t* sp,
+                                  wasm_value_slot_t* local_base,
+                                  execution_context_t* ctx,
+                                  tos_int_t ti,
+                                  tos_float_t tf) noexcept
+    {
+        --sp;
+        if(slot_load<wasm_i32>(sp) == 0) { ip = ip->imm.branch.target; }
+        else
+        {
+            ++ip;
+        }
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_br_table(op_t const* ip,
+                            wasm_value_slot_t* sp,
+                            wasm_value_slot_t* local_base,
+                            execution_context_t* ctx,
+                            tos_int_t ti,
+                            tos_float_t tf) noexcept
+    {
+        --sp;
+        auto const index{slot_load<wasm_u32>(sp)};
+        auto const& table{ip->imm.br_table};
+        auto const& branch{table.targets[index < table.count ? index : table.count]};
+        sp = unwind_operand_stack(sp, branch);
+        ip = branch.target;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_return_0(op_t const*, wasm_value_slot_t*, wasm_value_slot_t*, execution_context_t*, tos_int_t, tos_float_t) noexcept {}
+
+    inline void op_return_1(op_t const*,
+                            wasm_value_slot_t* sp,
+                            wasm_value_slot_t* local_base,
+                            execution_context_t*,
+                            tos_int_t,
+                            tos_float_t) noexcept { *local_base = sp[-1]; }
+
+    /// @brief tiered execution
+
+    /// @brief      First op of a function translated for tiered execution: runs the native code once it exists, counts the call otherwise.
+    inline void op_tier_up_entry(op_t const* ip,
+                                 wasm_value_slot_t* sp,
+                                 wasm_value_slot_t* local_base,
+                                 execution_context_t* ctx,
+                                 tos_int_t ti,
+                                 tos_float_t tf) noexcept
+    {
+        auto const function{ip->imm.callee};
+        auto const code{::std::atomic_ref<tier2_code_t const*>{function->tier2_code}.load(::std::memory_order_acquire)};
+        if(code != nullptr) [[unlikely]]
+        {
+            code->entry(local_base, ctx);
+            return;
+        }
+        if(++function->call_count == ::uwvm2::compiler::uwvm_int::tier_up_call_threshold) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::request_tier_up(function);
+        }
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      Loop header of a function translated for tiered execution, reached on loop entry and on every back-edge.
+    /// @details    Transfers the running frame to the native code once it exists (on-stack replacement), counts the pass otherwise. The
+    ///             translator spills every cached value before a loop, so the whole frame is in memory here.
+    inline void op_tier_up_loop(op_t const* ip,
+                                wasm_value_slot_t* sp,
+                                wasm_value_slot_t* local_base,
+                                execution_context_t* ctx,
+                                tos_int_t ti,
+                                tos_float_t tf) noexcept
+    {
+        auto const& header{ip->imm.tier_up_loop};
+        auto const function{header.function};
+        auto const code{::std::atomic_ref<tier2_code_t const*>{function->tier2_code}.load(::std::memory_order_acquire)};
+        if(code != nullptr && code->osr_entry != nullptr) [[unlikely]]
+        {
+            code->osr_entry(local_base, sp, header.loop_index, ctx);
+            return;
+        }
+        if(++function->loop_count == ::uwvm2::compiler::uwvm_int::tier_up_loop_threshold) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::request_tier_up(function);
+        }
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief call
+
+    inline void op_call_compiled(op_t const* ip,
+                                 wasm_value_slot_t* sp,
+                                 wasm_value_slot_t* local_base,
+                                 execution_context_t* ctx,
+                                 tos_int_t ti,
+                                 tos_float_t tf) noexcept
+    {
+        auto const callee{ip->imm.callee};
+        auto const frame_base{sp - callee->param_count};
+        invoke_compiled(callee, frame_base, ctx);
+        sp = frame_base + callee->result_count;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_call_host(op_t const* ip,
+                             wasm_value_slot_t* sp,
+                             wasm_value_slot_t* local_base,
+                             execution_context_t* ctx,
+                             tos_int_t ti,
+                             tos_float_t tf) noexcept
+    {
+        auto const host{ip->imm.host};
+        auto const frame_base{sp - host->param_count};
+        invoke_host(host, frame_base, ctx);
+        sp = frame_base + host->result_count;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_call_indirect(op_t const* ip,
+                                 wasm_value_slot_t* sp,
+                                 wasm_value_slot_t* local_base,
+                                 execution_context_t* ctx,
+                                 tos_int_t ti,
+                                 tos_float_t tf) noexcept
+    {
+        --sp;
+        auto const index{slot_load<wasm_u32>(sp)};
+        auto const& immediate{ip->imm.call_indirect};
+        auto const& elems{immediate.table->elems};
+
+        if(static_cast<::std::size_t>(index) >= elems.size()) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::undefined_element);
+        }
+
+        auto const& callee{elems.index_unchecked(static_cast<::std::size_t>(index))};
+
+        if(callee.kind == callable_kind::null_ref) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::uninitialized_element);
+        }
+
+        if(!function_type_equal(callee.function_type_ptr, immediate.function_type_ptr)) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::indirect_call_type_mismatch);
+        }
+
+        auto const frame_base{sp - get_param_count(immediate.function_type_ptr)};
+        invoke_callable(callee, frame_base, ctx);
+        sp = frame_base + get_result_count(immediate.function_type_ptr);
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief parametric
+
+    inline void op_drop(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        --sp;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_select(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        sp -= 2;
+        // sp[-1]: val1, sp[0]: val2, sp[1]: condition
+        if(slot_load<wasm_i32>(sp + 1) == 0) { sp[-1] = sp[0]; }
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief variable
+
+    inline void op_local_get(op_t const* ip,
+                             wasm_value_slot_t* sp,
+                             wasm_value_slot_t* local_base,
+                             execution_context_t* ctx,
+                             tos_int_t ti,
+                             tos_float_t tf) noexcept
+    {
+        *sp++ = local_base[ip->imm.index];
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_local_set(op_t const* ip,
+                             wasm_value_slot_t* sp,
+                             wasm_value_slot_t* local_base,
+                             execution_context_t* ctx,
+                             tos_int_t ti,
+                             tos_float_t tf) noexcept
+    {
+        local_base[ip->imm.index] = *--sp;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_local_tee(op_t const* ip,
+                             wasm_value_slot_t* sp,
+                             wasm_value_slot_t* local_base,
+                             execution_context_t* ctx,
+                             tos_int_t ti,
+                             tos_float_t tf) noexcept
+    {
+        local_base[ip->imm.index] = sp[-1];
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      Globals defined by a wasm module: the value is the first member of `wasm_global_storage_t::storage`.
+    template <typename T>
+    inline void op_global_get(op_t const* ip,
+                              wasm_value_slot_t* sp,
+                              wasm_value_slot_t* local_base,
+                              execution_context_t* ctx,
+                              tos_int_t ti,
+                              tos_float_t tf) noexcept
+    {
+        T v;  // No initialization necessary
+        ::std::memcpy(::std::addressof(v), ::std::addressof(ip->imm.global->storage), sizeof(T));
+        slot_store<T>(sp++, v);
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename T>
+    inline void op_global_set(op_t const* ip,
+                              wasm_value_slot_t* sp,
+                              wasm_value_slot_t* local_base,
+                              execution_context_t* ctx,
+                              tos_int_t ti,
+                              tos_float_t tf) noexcept
+    {
+        auto const v{slot_load<T>(--sp)};
+        ::std::memcpy(::std::addressof(ip->imm.global->storage), ::std::addressof(v), sizeof(T));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      Globals of local-imported modules are only reachable through the module's accessors, which use the same native layout as a slot.
+    inline void op_host_global_get(op_t const* ip,
+                                   wasm_value_slot_t* sp,
+                                   wasm_value_slot_t* local_base,
+                                   execution_context_t* ctx,
+                                   tos_int_t ti,
+                                   tos_float_t tf) noexcept
+    {
+        auto const host_global{ip->imm.host_global};
+        host_global->module_ptr->global_get_from_index(host_global->index, sp->storage);
+        ++sp;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    inline void op_host_global_set(op_t const* ip,
+                                   wasm_value_slot_t* sp,
+                                   wasm_value_slot_t* local_base,
+                                   execution_context_t* ctx,
+                                   tos_int_t ti,
+                                   tos_float_t tf) noexcept
+    {
+        auto const host_global{ip->imm.host_global};
+        --sp;
+        if(!host_global->module_ptr->global_set_from_index(host_global->index, sp->storage)) [[unlikely]]
+        {
+            // Mutability has been checked during translation.
+            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+        }
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief memory
+
+    template <typename Accessor, typename MemT, typename ResT>
+    inline void op_load(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        auto const& memarg{ip->imm.memarg};
+        auto const address{checked_memory_address<sizeof(MemT), Accessor>(memarg.memory, slot_load<wasm_u32>(sp - 1), memarg.offset)};
+        slot_store<ResT>(sp - 1, static_cast<ResT>(load_little_endian<MemT>(address)));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename Accessor, typename ValT, typename MemT>
+    inline void op_store(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        auto const& memarg{ip->imm.memarg};
+        auto const v{slot_load<ValT>(sp - 1)};
+        auto const address{checked_memory_address<sizeof(MemT), Accessor>(memarg.memory, slot_load<wasm_u32>(sp - 2), memarg.offset)};
+        sp -= 2;
+        store_little_endian<MemT>(address, static_cast<MemT>(v));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename Accessor>
+    inline void op_memory_size(op_t const* ip,
+                               wasm_value_slot_t* sp,
+                               wasm_value_slot_t* local_base,
+                               execution_context_t* ctx,
+                               tos_int_t ti,
+                               tos_float_t tf) noexcept
+    {
+        slot_store<wasm_i32>(sp++, static_cast<wasm_i32>(Accessor::page_count(ip->imm.memory)));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename Accessor>
+    inline void op_memory_grow(op_t const* ip,
+                               wasm_value_slot_t* sp,
+                               wasm_value_slot_t* local_base,
+                               execution_context_t* ctx,
+                               tos_int_t ti,
+                               tos_float_t tf) noexcept
+    {
+        auto const delta{slot_load<wasm_u32>(sp - 1)};
+        slot_store<wasm_i32>(sp - 1, static_cast<wasm_i32>(Accessor::grow(ip->imm.memory, delta)));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief numeric
+
+    template <typename T>
+    UWVM_ALWAYS_INLINE inline T get_const_immediate(op_immediate_u const& imm) noexcept
+    {
+        if constexpr(::std::same_as<T, wasm_i32>) { return imm.i32; }
+        else if constexpr(::std::same_as<T, wasm_i64>) { return imm.i64; }
+        else if constexpr(::std::same_as<T, wasm_f32>) { return imm.f32; }
+        else
+        {
+            static_assert(::std::same_as<T, wasm_f64>);
+            return imm.f64;
+        }
+    }
+
+    template <typename T>
+    inline void op_const(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        slot_store<T>(sp++, get_const_immediate<T>(ip->imm));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename T, typename R, R (*Fn)(T) noexcept>
+    inline void op_unary(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        slot_store<R>(sp - 1, Fn(slot_load<T>(sp - 1)));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename T, typename R, R (*Fn)(T, T) noexcept>
+    inline void op_binary(op_t const* ip, wasm_value_slot_t* sp, wasm_value_slot_t* local_base, execution_context_t* ctx, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        auto const rhs{slot_load<T>(sp - 1)};
+        auto const lhs{slot_load<T>(sp - 2)};
+        --sp;
+        slot_store<R>(sp - 1, Fn(lhs, rhs));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief register
+
+    /// @brief      Which source operand of a register op is held in the top-of-stack cache.
+    enum class tos_source : unsigned
+    {
+        none,
+        src1,
+        src2
+    };
+
+    template <typename T>
+    UWVM_ALWAYS_INLINE inline T tos_load(tos_int_t ti, tos_float_t tf) noexcept
+    {
+        if constexpr(::std::same_as<T, wasm_f64>) { return tf; }
+        else if constexpr(::std::same_as<T, wasm_f32>)
+        {
+            return ::std::bit_cast<wasm_f32>(static_cast<::std::uint_least32_t>(::std::bit_cast<::std::uint_least64_t>(tf)));
+        }
+        else
+        {
+            static_assert(::std::same_as<T, wasm_i32> || ::std::same_as<T, wasm_i64>);
+            return static_cast<T>(ti);
+        }
+    }
+
+    template <typename T>
+    UWVM_ALWAYS_INLINE inline void tos_store(tos_int_t& ti, tos_float_t& tf, T v) noexcept
+    {
+        if constexpr(::std::same_as<T, wasm_f64>) { tf = v; }
+        else if constexpr(::std::same_as<T, wasm_f32>)
+        {
+            tf = ::std::bit_cast<tos_float_t>(static_cast<::std::uint_least64_t>(::std::bit_cast<::std::uint_least32_t>(v)));
+        }
+        else
+        {
+            static_assert(::std::same_as<T, wasm_i32> || ::std::same_as<T, wasm_i64>);
+            ti = static_cast<tos_int_t>(v);
+        }
+    }
+
+    /// @brief      Source operand `Src` of a register op: the cache if `Cached == Src`, otherwise slot `index`.
+    template <typename T, tos_source Src, tos_source Cached>
+    UWVM_ALWAYS_INLINE inline T load_register_operand(wasm_value_slot_t const* local_base, ::std::uint_least32_t index, tos_int_t ti, tos_float_t tf) noexcept
+    {
+        if constexpr(Src == Cached) { return tos_load<T>(ti, tf); }
+        else
+        {
+            return slot_load<T>(local_base + index);
+        }
+    }
+
+    /// @brief      Result of a register op: the cache if `Cached`, otherwise slot `index`.
+    template <typename R, bool Cached>
+    UWVM_ALWAYS_INLINE inline void store_register_result(wasm_value_slot_t* local_base,
+                                                         ::std::uint_least32_t index,
+                                                         tos_int_t& ti,
+                                                         tos_float_t& tf,
+                                                         R v) noexcept
+    {
+        if constexpr(Cached) { tos_store<R>(ti, tf, v); }
+        else
+        {
+            slot_store<R>(local_base + index, v);
+        }
+    }
+
+    /// @brief      Copy slot `src1` to slot `dst` (`local.get a; local.set b` and operands forwarded into locals).
+    inline void op_copy_reg(op_t const* ip,
+                            wasm_value_slot_t* sp,
+                            wasm_value_slot_t* local_base,
+                            execution_context_t* ctx,
+                            tos_int_t ti,
+                            tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        local_base[reg.dst] = local_base[reg.src1];
+        sp += reg.sp_delta;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename T, typename R, R (*Fn)(T) noexcept, tos_source CachedSrc, bool CachedDst>
+    inline void op_unary_reg(op_t const* ip,
+                             wasm_value_slot_t* sp,
+                             wasm_value_slot_t* local_base,
+                             execution_context_t* ctx,
+                             tos_int_t ti,
+                             tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        auto const v{Fn(load_register_operand<T, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf))};
+        store_register_result<R, CachedDst>(local_base, reg.dst, ti, tf, v);
+        sp += reg.sp_delta;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    template <typename T, typename R, R (*Fn)(T, T) noexcept, tos_source CachedSrc, bool CachedDst>
+    inline void op_binary_reg(op_t const* ip,
+                              wasm_value_slot_t* sp,
+                              wasm_value_slot_t* local_base,
+                              execution_context_t* ctx,
+                              tos_int_t ti,
+                              tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        // Both operands are read before the result is written, `dst` may be one of the sources.
+        auto const lhs{load_register_operand<T, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf)};
+        auto const rhs{load_register_operand<T, tos_source::src2, CachedSrc>(local_base, reg.src2, ti, tf)};
+        store_register_result<R, CachedDst>(local_base, reg.dst, ti, tf, Fn(lhs, rhs));
+        sp += reg.sp_delta;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief superinstruction
+
+    /// @brief      Holds the immediates that did not fit into the preceding superinstruction. Never dispatched.
+    inline void op_immediate_extension(op_t const*, wasm_value_slot_t*, wasm_value_slot_t*, execution_context_t*, tos_int_t, tos_float_t) noexcept
+    {
+        // vm bug
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+        ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+        ::fast_io::fast_terminate();
+    }
+
+    /// @brief      Take the branch stored in the extension op if `cond` is set, otherwise skip the extension op.
+    UWVM_ALWAYS_INLINE inline op_t const* br_if_extension(op_t const* ip, wasm_value_slot_t*& sp, bool cond) noexcept
+    {
+        if(cond)
+        {
+            auto const& branch{ip[1].imm.branch};
+            sp = unwind_operand_stack(sp, branch);
+            return branch.target;
+        }
+        return ip + 2;
+    }
+
+    /// @brief      `local.get; *.load`: the address is read from a local.
+    template <typename Accessor, typename MemT, typename ResT>
+    inline void op_load_local(op_t const* ip,
+                              wasm_value_slot_t* sp,
+                              wasm_value_slot_t* local_base,
+                              execution_context_t* ctx,
+                              tos_int_t ti,
+                              tos_float_t tf) noexcept
+    {
+        auto const& memarg{ip->imm.local_memarg};
+        auto const address{checked_memory_address<sizeof(MemT), Accessor>(memarg.memory, slot_load<wasm_u32>(local_base + memarg.local), memarg.offset)};
+        slot_store<ResT>(sp++, static_cast<ResT>(load_little_endian<MemT>(address)));
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `i32.const; <i32 binop>`: the right operand is the constant held in `src2`.
+    template <typename R, R (*Fn)(wasm_i32, wasm_i32) noexcept, tos_source CachedSrc, bool CachedDst>
+    inline void op_binary_reg_const(op_t const* ip,
+                                    wasm_value_slot_t* sp,
+                                    wasm_value_slot_t* local_base,
+                                    execution_context_t* ctx,
+                                    tos_int_t ti,
+                                    tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        auto const lhs{load_register_operand<wasm_i32, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf)};
+        store_register_result<R, CachedDst>(local_base, reg.dst, ti, tf, Fn(lhs, static_cast<wasm_i32>(reg.src2)));
+        sp += reg.sp_delta;
+        ++ip;
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `<unop>; br_if`, the branch lives in the extension op.
+    template <typename T, wasm_i32 (*Fn)(T) noexcept, tos_source CachedSrc>
+    inline void op_br_if_unary_reg(op_t const* ip,
+                                   wasm_value_slot_t* sp,
+                                   wasm_value_slot_t* local_base,
+                                   execution_context_t* ctx,
+                                   tos_int_t ti,
+                                   tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        auto const cond{Fn(load_register_operand<T, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf)) != 0};
+        sp += reg.sp_delta;
+        ip = br_if_extension(ip, sp, cond);
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `<binop>; br_if` (typically a compare), the branch lives in the extension op.
+    template <typename T, wasm_i32 (*Fn)(T, T) noexcept, tos_source CachedSrc>
+    inline void op_br_if_binary_reg(op_t const* ip,
+                                    wasm_value_slot_t* sp,
+                                    wasm_value_slot_t* local_base,
+                                    execution_context_t* ctx,
+                                    tos_int_t ti,
+                                    tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        auto const lhs{load_register_operand<T, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf)};
+        auto const rhs{load_register_operand<T, tos_source::src2, CachedSrc>(local_base, reg.src2, ti, tf)};
+        auto const cond{Fn(lhs, rhs) != 0};
+        sp += reg.sp_delta;
+        ip = br_if_extension(ip, sp, cond);
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `i32.const; <i32 binop>; br_if`, the branch lives in the extension op.
+    template <wasm_i32 (*Fn)(wasm_i32, wasm_i32) noexcept, tos_source CachedSrc>
+    inline void op_br_if_binary_reg_const(op_t const* ip,
+                                          wasm_value_slot_t* sp,
+                                          wasm_value_slot_t* local_base,
+                                          execution_context_t* ctx,
+                                          tos_int_t ti,
+                                          tos_float_t tf) noexcept
+    {
+        auto const& reg{ip->imm.reg};
+        auto const cond{Fn(load_register_operand<wasm_i32, tos_source::src1, CachedSrc>(local_base, reg.src1, ti, tf), static_cast<wasm_i32>(reg.src2)) != 0};
+        sp += reg.sp_delta;
+        ip = br_if_extension(ip, sp, cond);
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+
+    /// @brief      `local.get; br_if` and `local.tee; br_if`: the condition is read from a local, the branch lives in the extension op.
+    inline void op_br_if_local(op_t const* ip,
+                               wasm_value_slot_t* sp,
+                               wasm_value_slot_t* local_base,
+                               execution_context_t* ctx,
+                               tos_int_t ti,
+                               tos_float_t tf) noexcept
+    {
+        auto const cond{slot_load<wasm_i32>(local_base + ip->imm.index) != 0};
+        ip = br_if_extension(ip, sp, cond);
+        UWVM_MUSTTAIL return ip->handler(ip, sp, local_base, ctx, ti, tf);
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
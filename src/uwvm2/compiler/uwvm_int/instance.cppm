@@ -0,0 +1,69 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <csetjmp>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+#include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+
+export module uwvm2.compiler.uwvm_int:instance;
+
+import fast_io;
+import uwvm2.utils.container;
+import uwvm2.utils.debug;
+import uwvm2.utils.thread;
+import uwvm2.parser.wasm.concepts;
+import uwvm2.parser.wasm.standard.wasm1.type;
+import uwvm2.parser.wasm.standard.wasm1.features;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+import uwvm2.object;
+import uwvm2.object.memory.signal;
+import uwvm2.uwvm.io;
+import uwvm2.uwvm.utils.ansies;
+import uwvm2.uwvm.wasm;
+import uwvm2.uwvm.runtime.storage;
+import uwvm2.uwvm.runtime.runtime_mode;
+import uwvm2.compiler.checker;
+import uwvm2.compiler.uwvm_int.flags;
+import :define;
+import :arena;
+import :tier;
+import :trap;
+import :handler;
+import :translate;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "instance.h"
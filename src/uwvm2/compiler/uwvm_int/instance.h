@@ -0,0 +1,956 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <algorithm>
+# include <memory>
+# include <type_traits>
+# include <csetjmp>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/utils/thread/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/object/memory/signal/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
+# include <uwvm2/compiler/checker/impl.h>
+# include <uwvm2/compiler/uwvm_int/flags/impl.h>
+# include "define.h"
+# include "arena.h"
+# include "tier.h"
+# include "trap.h"
+# include "handler.h"
+# include "translate.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      All instantiated wasm modules.
+    /// @note       Reserved before it is filled, translated ops keep raw pointers into it.
+    inline ::uwvm2::utils::container::vector<compiled_module_t> compiled_modules{};  // [global]
+
+    /// @brief      One binding per defined table, shared by every module that (re-)exports or imports that table.
+    inline ::uwvm2::utils::container::vector<table_binding_t> table_bindings{};  // [global]
+
+    /// @brief      Execution state of the main thread.
+    inline execution_context_t main_execution_context{};  // [global]
+
+    /// @brief      Verifies the bodies of `runtime_mode_t::lazy_compile_with_full_code_verification` while the modules already run.
+    inline ::uwvm2::utils::thread::background_work_stealing_t background_verification{};  // [global]
+
+    [[noreturn]] UWVM_GNU_COLD inline void instantiate_error(::uwvm2::utils::container::u8string_view module_name,
+                                                             ::uwvm2::utils::container::u8string_view message) noexcept
+    {
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                            u8"[fatal] ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"uwvm-int: Cannot instantiate module \"",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            module_name,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"\": ",
+                            message,
+                            u8".\n\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        ::fast_io::fast_terminate();
+    }
+
+    namespace details
+    {
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline constexpr void
+            get_module_sections_from_binfmt_ver1(::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_extensible_storage_t<Fs...> const& module_storage,
+                                                 compiled_module_t& module) noexcept
+        {
+            using type_section_storage_t = ::uwvm2::parser::wasm::standard::wasm1::features::type_section_storage_t<Fs...>;
+            using start_section_storage_t = ::uwvm2::parser::wasm::standard::wasm1::features::start_section_storage_t;
+
+            auto const& typesec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<type_section_storage_t>(module_storage.sections)};
+            module.function_types = typesec.types.data();
+            module.function_type_count = typesec.types.size();
+
+            auto const& startsec{::uwvm2::parser::wasm::concepts::operation::get_first_type_in_tuple<start_section_storage_t>(module_storage.sections)};
+            if(startsec.sec_span.sec_begin != nullptr)
+            {
+                module.has_start_function = true;
+                module.start_function_index = static_cast<::std::size_t>(startsec.start_idx);
+            }
+        }
+
+        inline void get_module_sections(::uwvm2::uwvm::wasm::type::wasm_file_t const& wf, compiled_module_t& module) noexcept
+        {
+            switch(wf.binfmt_ver)
+            {
+                case 1u:
+                {
+                    get_module_sections_from_binfmt_ver1(wf.wasm_module_storage.wasm_binfmt_ver1_storage, module);
+                    break;
+                }
+                [[unlikely]] default:
+                {
+                    static_assert(::uwvm2::uwvm::wasm::feature::max_binfmt_version == 1u, "missing implementation of other binfmt version");
+                    instantiate_error(module.module_name, u8"unsupported binary format version");
+                }
+            }
+        }
+
+        /// @brief      Find the translated form of a defined function, which may belong to any module.
+        inline compiled_function_t* find_compiled_function(::uwvm2::uwvm::runtime::storage::local_defined_function_storage_t const* defined_ptr) noexcept
+        {
+            for(auto& module: compiled_modules)
+            {
+                auto const& defined_vec{module.runtime_module_ptr->local_defined_function_vec_storage};
+                auto const defined_begin{defined_vec.data()};
+                if(defined_ptr >= defined_begin && defined_ptr < defined_begin + defined_vec.size())
+                {
+                    return module.functions.data() + (defined_ptr - defined_begin);
+                }
+            }
+            return nullptr;
+        }
+
+        /// @brief      Find the function index space entry of an imported function, which may belong to any module.
+        inline callable_t const* find_imported_callable(::uwvm2::uwvm::runtime::storage::imported_function_storage_t const* imported_ptr) noexcept
+        {
+            for(auto const& module: compiled_modules)
+            {
+                auto const& imported_vec{module.runtime_module_ptr->imported_function_vec_storage};
+                auto const imported_begin{imported_vec.data()};
+                if(imported_ptr >= imported_begin && imported_ptr < imported_begin + imported_vec.size())
+                {
+                    return module.function_index_space.data() + (imported_ptr - imported_begin);
+                }
+            }
+            return nullptr;
+        }
+
+        inline void fill_host_function(host_function_t& host, function_type_t const* function_type_ptr) noexcept
+        {
+            host.function_type_ptr = function_type_ptr;
+            host.param_count = get_param_count(function_type_ptr);
+            host.result_count = get_result_count(function_type_ptr);
+
+            host.param_bytes = 0uz;
+            for(auto curr{function_type_ptr->parameter.begin}; curr != function_type_ptr->parameter.end; ++curr)
+            {
+                host.param_bytes += get_value_type_size(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(*curr));
+            }
+
+            host.result_bytes = 0uz;
+            for(auto curr{function_type_ptr->result.begin}; curr != function_type_ptr->result.end; ++curr)
+            {
+                host.result_bytes += get_value_type_size(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte>(*curr));
+            }
+        }
+
+        /// @brief      Follow the link chain of imported function `import_index` down to a defined function or a host function.
+        inline callable_t resolve_imported_function(compiled_module_t& module, ::std::size_t import_index) noexcept
+        {
+            using func_link_kind = ::uwvm2::uwvm::runtime::storage::imported_function_link_kind;
+
+            auto const& imp{module.runtime_module_ptr->imported_function_vec_storage.index_unchecked(import_index)};
+            auto const function_type_ptr{imp.import_type_ptr->imports.storage.function};
+            auto& host{module.host_functions.index_unchecked(import_index)};
+
+            auto curr{::std::addressof(imp)};
+            for(;;)
+            {
+                switch(curr->link_kind)
+                {
+                    case func_link_kind::imported:
+                    {
+                        curr = curr->target.imported_ptr;
+                        if(curr == nullptr) [[unlikely]]
+                        {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                            ::fast_io::fast_terminate();
+                        }
+                        break;
+                    }
+                    case func_link_kind::defined:
+                    {
+                        auto const compiled{find_compiled_function(curr->target.defined_ptr)};
+                        if(compiled == nullptr) [[unlikely]]
+                        {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                            ::fast_io::fast_terminate();
+                        }
+                        return {compiled, nullptr, compiled->function_type_ptr, callable_kind::compiled};
+                    }
+                    case func_link_kind::local_imported:
+                    {
+                        fill_host_function(host, function_type_ptr);
+                        host.module_ptr = curr->target.local_imported.module_ptr;
+                        host.index = curr->target.local_imported.index;
+                        host.kind = host_function_kind::local_imported;
+                        return {nullptr, ::std::addressof(host), function_type_ptr, callable_kind::host};
+                    }
+#if defined(UWVM_SUPPORT_PRELOAD_DL)
+                    case func_link_kind::dl:
+                    {
+                        fill_host_function(host, function_type_ptr);
+                        host.capi_ptr = curr->target.dl_ptr;
+                        host.kind = host_function_kind::capi;
+                        return {nullptr, ::std::addressof(host), function_type_ptr, callable_kind::host};
+                    }
+#endif
+#if defined(UWVM_SUPPORT_WEAK_SYMBOL)
+                    case func_link_kind::weak_symbol:
+                    {
+                        fill_host_function(host, function_type_ptr);
+                        host.capi_ptr = curr->target.weak_symbol_ptr;
+                        host.kind = host_function_kind::capi;
+                        return {nullptr, ::std::addressof(host), function_type_ptr, callable_kind::host};
+                    }
+#endif
+                    [[unlikely]] default:
+                    {
+                        instantiate_error(module.module_name, u8"unresolved imported function");
+                    }
+                }
+            }
+        }
+
+#if defined(UWVM_SUPPORT_MMAP)
+        /// @brief      A fault in the reservation of a native memory is an out of bounds access whose bounds check was elided.
+        [[noreturn]] inline void report_guard_region_fault(::uwvm2::object::memory::signal::protected_memory_segment_t const&, ::std::byte const*) noexcept
+        {
+# if defined(_WIN32) && !defined(__CYGWIN__)
+            // `longjmp` cannot leave a vectored exception handler, the fault stays fatal.
+            current_trap_frame = nullptr;
+# endif
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::out_of_bounds_memory_access);
+        }
+#endif
+
+        inline void bind_native_memory(compiled_module_t& module, ::uwvm2::uwvm::runtime::storage::local_defined_memory_storage_t* memory_ptr) noexcept
+        {
+            auto const& limits{memory_ptr->memory_type_ptr->limits};
+
+            module.memory.native_memory = ::std::addressof(memory_ptr->memory);
+            // Without a declared maximum the memory can grow up to the end of the wasm32 address space.
+            module.memory.max_page_count = limits.present_max ? static_cast<::std::uint_least64_t>(limits.max)
+                                                              : (static_cast<::std::uint_least64_t>(1u) << 32u) >> memory_ptr->memory.custom_page_size_log2;
+            module.memory.elide_bounds_checks = ::uwvm2::object::memory::linear::native_memory_t::can_elide_wasm32_bounds_checks &&
+                                                memory_ptr->memory.can_elide_bounds_checks();
+            module.has_memory = true;
+        }
+
+        inline void bind_memory(compiled_module_t& module) noexcept
+        {
+            using memory_link_kind = ::uwvm2::uwvm::runtime::storage::imported_memory_storage_t::imported_memory_link_kind;
+
+            auto& rt{*module.runtime_module_ptr};
+
+            // wasm1 allows at most one memory, imported or defined.
+            if(!rt.imported_memory_vec_storage.empty())
+            {
+                auto curr{::std::addressof(rt.imported_memory_vec_storage.index_unchecked(0uz))};
+                for(;;)
+                {
+                    switch(curr->link_kind)
+                    {
+                        case memory_link_kind::imported:
+                        {
+                            curr = curr->target.imported_ptr;
+                            if(curr == nullptr) [[unlikely]]
+                            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                                ::fast_io::fast_terminate();
+                            }
+                            break;
+                        }
+                        case memory_link_kind::defined:
+                        {
+                            bind_native_memory(module, curr->target.defined_ptr);
+                            return;
+                        }
+                        case memory_link_kind::local_imported:
+                        {
+                            auto const module_ptr{curr->target.local_imported.module_ptr};
+                            auto const index{curr->target.local_imported.index};
+                            auto const page_size{module_ptr->memory_page_size_from_index(index)};
+                            if(page_size == 0u) [[unlikely]] { instantiate_error(module.module_name, u8"local imported memory has a zero page size"); }
+
+                            module.memory.local_imported_module = module_ptr;
+                            module.memory.local_imported_index = index;
+                            module.memory.max_page_count = (static_cast<::std::uint_least64_t>(1u) << 32u) / page_size;
+                            module.has_memory = true;
+                            return;
+                        }
+                        [[unlikely]] default:
+                        {
+                            instantiate_error(module.module_name, u8"unresolved imported memory");
+                        }
+                    }
+                }
+            }
+            else if(!rt.local_defined_memory_vec_storage.empty())
+            {
+                bind_native_memory(module, ::std::addressof(rt.local_defined_memory_vec_storage.index_unchecked(0uz)));
+            }
+        }
+
+        inline void bind_globals(compiled_module_t& module) noexcept
+        {
+            using global_link_kind = ::uwvm2::uwvm::runtime::storage::imported_global_storage_t::imported_global_link_kind;
+
+            auto& rt{*module.runtime_module_ptr};
+
+            module.globals.reserve(rt.imported_global_vec_storage.size() + rt.local_defined_global_vec_storage.size());
+
+            for(auto const& imp: rt.imported_global_vec_storage)
+            {
+                auto curr{::std::addressof(imp)};
+                for(;;)
+                {
+                    if(curr->link_kind == global_link_kind::imported)
+                    {
+                        curr = curr->target.imported_ptr;
+                        if(curr == nullptr) [[unlikely]]
+                        {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                            ::fast_io::fast_terminate();
+                        }
+                        continue;
+                    }
+                    break;
+                }
+
+                switch(curr->link_kind)
+                {
+                    case global_link_kind::defined:
+                    {
+                        auto const defined_ptr{curr->target.defined_ptr};
+                        module.globals.push_back_unchecked({::std::addressof(defined_ptr->global), {}, defined_ptr->global.is_mutable});
+                        break;
+                    }
+                    case global_link_kind::local_imported:
+                    {
+                        auto const module_ptr{curr->target.local_imported.module_ptr};
+                        auto const index{curr->target.local_imported.index};
+                        module.globals.push_back_unchecked({nullptr, {module_ptr, index}, module_ptr->global_is_mutable_from_index(index)});
+                        break;
+                    }
+                    [[unlikely]] default:
+                    {
+                        instantiate_error(module.module_name, u8"unresolved imported global");
+                    }
+                }
+            }
+
+            for(auto& global: rt.local_defined_global_vec_storage)
+            {
+                module.globals.push_back_unchecked({::std::addressof(global.global), {}, global.global.is_mutable});
+            }
+        }
+
+        inline table_binding_t const* find_table_binding(::uwvm2::uwvm::runtime::storage::local_defined_table_storage_t const* table_ptr) noexcept
+        {
+            for(auto const& binding: table_bindings)
+            {
+                if(binding.table_ptr == table_ptr) { return ::std::addressof(binding); }
+            }
+            return nullptr;
+        }
+
+        /// @brief      Resolve every element of a defined table to a `callable_t`. Requires the function index spaces of all modules.
+        inline void build_table_binding(::uwvm2::uwvm::runtime::storage::local_defined_table_storage_t const& table) noexcept
+        {
+            using elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
+
+            table_bindings.emplace_back();
+            auto& binding{table_bindings.back_unchecked()};
+            binding.table_ptr = ::std::addressof(table);
+            binding.elems.resize(table.elems.size());
+
+            auto binding_elem_curr{binding.elems.data()};
+            for(auto const& elem: table.elems)
+            {
+                switch(elem.type)
+                {
+                    case elem_type::func_ref_imported:
+                    {
+                        // Elements not written by any element segment are zero-initialized, i.e. a null `imported_ptr`.
+                        if(elem.storage.imported_ptr != nullptr)
+                        {
+                            auto const callable{find_imported_callable(elem.storage.imported_ptr)};
+                            if(callable == nullptr) [[unlikely]]
+                            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                                ::fast_io::fast_terminate();
+                            }
+                            *binding_elem_curr = *callable;
+                        }
+                        break;
+                    }
+                    case elem_type::func_ref_defined:
+                    {
+                        if(elem.storage.defined_ptr != nullptr)
+                        {
+                            auto const compiled{find_compiled_function(elem.storage.defined_ptr)};
+                            if(compiled == nullptr) [[unlikely]]
+                            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                                ::fast_io::fast_terminate();
+                            }
+                            *binding_elem_curr = {compiled, nullptr, compiled->function_type_ptr, callable_kind::compiled};
+                        }
+                        break;
+                    }
+                    [[unlikely]] default:
+                    {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                        ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                        ::fast_io::fast_terminate();
+                    }
+                }
+                ++binding_elem_curr;
+            }
+        }
+
+        inline void bind_table(compiled_module_t& module) noexcept
+        {
+            using table_link_kind = ::uwvm2::uwvm::runtime::storage::imported_table_storage_t::imported_table_link_kind;
+
+            auto& rt{*module.runtime_module_ptr};
+
+            ::uwvm2::uwvm::runtime::storage::local_defined_table_storage_t const* table_ptr{};
+
+            // wasm1 allows at most one table, imported or defined.
+            if(!rt.imported_table_vec_storage.empty())
+            {
+                auto curr{::std::addressof(rt.imported_table_vec_storage.index_unchecked(0uz))};
+                while(curr->link_kind == table_link_kind::imported)
+                {
+                    curr = curr->target.imported_ptr;
+                    if(curr == nullptr) [[unlikely]]
+                    {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                        ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                        ::fast_io::fast_terminate();
+                    }
+                }
+
+                if(curr->link_kind != table_link_kind::defined) [[unlikely]] { instantiate_error(module.module_name, u8"unresolved imported table"); }
+                table_ptr = curr->target.defined_ptr;
+            }
+            else if(!rt.local_defined_table_vec_storage.empty()) { table_ptr = ::std::addressof(rt.local_defined_table_vec_storage.index_unchecked(0uz)); }
+            else
+            {
+                return;
+            }
+
+            module.table = find_table_binding(table_ptr);
+            if(module.table == nullptr) [[unlikely]]
+            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                ::fast_io::fast_terminate();
+            }
+        }
+
+        struct translation_task_t
+        {
+            compiled_module_t* module{};
+            compiled_function_t* function{};
+            ::std::size_t function_index{};
+            ::std::size_t body_size{};
+            function_links_t links{};
+            // Set if the body failed validation, see `report_lowest_validation_failure`.
+            ::uwvm2::compiler::checker::validation_error_t error{};
+            bool invalid{};
+            // Where the body lives in `compiled_module_t::code_arena`.
+            op_t* arena_ops{};
+            branch_target_t* arena_br_table_targets{};
+        };
+
+        struct arena_cursor_t
+        {
+            op_t* ops{};
+            branch_target_t* br_table_targets{};
+        };
+
+        /// @brief      One task per defined function of every module, largest bodies first: they head the queues of the workers, and what is left to
+        ///             steal at the end is small.
+        inline ::uwvm2::utils::container::vector<translation_task_t> get_translation_tasks() noexcept
+        {
+            ::uwvm2::utils::container::vector<translation_task_t> tasks{};
+            for(auto& module: compiled_modules)
+            {
+                auto const imported_count{module.runtime_module_ptr->imported_function_vec_storage.size()};
+                ::std::size_t defined_index{};
+                for(auto& function: module.functions)
+                {
+                    auto const& body{function.function_ptr->wasm_code_ptr->body};
+                    tasks.push_back({::std::addressof(module),
+                                     ::std::addressof(function),
+                                     imported_count + defined_index++,
+                                     static_cast<::std::size_t>(body.code_end - body.expr_begin)});
+                }
+            }
+
+            ::std::ranges::sort(tasks, [](translation_task_t const& a, translation_task_t const& b) noexcept { return a.body_size > b.body_size; });
+            return tasks;
+        }
+
+        /// @brief      Report the invalid body with the lowest function index, of the first module that has one.
+        /// @details    The bodies are validated in an order that depends on the threads, reporting the lowest one keeps the diagnostic of an invalid
+        ///             module the same from one run (and one machine) to the next.
+        inline void report_lowest_validation_failure(::uwvm2::utils::container::vector<translation_task_t> const& tasks) noexcept
+        {
+            translation_task_t const* lowest{};
+            for(auto const& task: tasks)
+            {
+                if(!task.invalid) { continue; }
+                // The modules are elements of `compiled_modules`, their addresses are in module order.
+                if(lowest == nullptr || task.module < lowest->module || (task.module == lowest->module && task.function_index < lowest->function_index))
+                {
+                    lowest = ::std::addressof(task);
+                }
+            }
+
+            if(lowest != nullptr) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::validation_error(*lowest->module, *lowest->function, lowest->function_index, lowest->error);
+            }
+        }
+
+        /// @brief      Validate and translate every defined function of every module, spread over the hardware threads, and move the bodies of each
+        ///             module into its sealed code arena.
+        /// @details    Every body is a task of its own, dealt to the threads by decreasing byte size (`get_translation_tasks`). A body that fails
+        ///             validation does not stop the others, the failures are merged once all bodies are done.
+        inline void translate_all_functions() noexcept
+        {
+            auto tasks{get_translation_tasks()};
+
+            // The superinstruction census is not synchronized.
+            auto const thread_count{::uwvm2::compiler::uwvm_int::flags::show_superinst_census ? 1uz : ::uwvm2::utils::thread::get_hardware_concurrency()};
+
+            auto translate_task{[&tasks](::std::size_t index) noexcept
+                                {
+                                    auto& task{tasks.index_unchecked(index)};
+                                    task.invalid = !try_translate_function_unlinked(*task.module, *task.function, task.function_index, task.links, task.error);
+                                }};
+            ::uwvm2::utils::thread::parallel_for_work_stealing(tasks.size(), thread_count, translate_task);
+
+            report_lowest_validation_failure(tasks);
+
+            // Lay out each arena: the ops of all functions, then all `br_table` targets.
+            static_assert(::std::is_trivially_copyable_v<op_t> && ::std::is_trivially_copyable_v<branch_target_t>);
+            static_assert(alignof(op_t) <= code_arena_t::alignment && alignof(branch_target_t) <= alignof(op_t));
+
+            ::uwvm2::utils::container::vector<arena_cursor_t> cursors{};
+            cursors.reserve(compiled_modules.size());
+            for(auto& module: compiled_modules)
+            {
+                ::std::size_t op_count{};
+                ::std::size_t br_table_target_count{};
+                for(auto const& function: module.functions)
+                {
+                    op_count += function.ops.size();
+                    br_table_target_count += function.br_table_targets.size();
+                }
+
+                module.code_arena.allocate(op_count * sizeof(op_t) + br_table_target_count * sizeof(branch_target_t));
+                auto const arena_ops{reinterpret_cast<op_t*>(module.code_arena.memory_begin)};
+                cursors.push_back_unchecked({arena_ops, reinterpret_cast<branch_target_t*>(arena_ops + op_count)});
+            }
+
+            for(auto& task: tasks)
+            {
+                auto& cursor{cursors.index_unchecked(static_cast<::std::size_t>(task.module - compiled_modules.data()))};
+                task.arena_ops = cursor.ops;
+                task.arena_br_table_targets = cursor.br_table_targets;
+                cursor.ops += task.function->ops.size();
+                cursor.br_table_targets += task.function->br_table_targets.size();
+            }
+
+            auto link_task{[&tasks](::std::size_t index) noexcept
+                           {
+                               auto& task{tasks.index_unchecked(index)};
+                               auto& function{*task.function};
+
+                               if(!function.ops.empty()) { ::std::memcpy(task.arena_ops, function.ops.data(), function.ops.size() * sizeof(op_t)); }
+                               if(!function.br_table_targets.empty())
+                               {
+                                   ::std::memcpy(task.arena_br_table_targets,
+                                                 function.br_table_targets.data(),
+                                                 function.br_table_targets.size() * sizeof(branch_target_t));
+                               }
+                               link_function(task.links, task.arena_ops, task.arena_br_table_targets);
+
+                               // Nothing runs yet, no other thread can observe the function.
+                               function.entry = task.arena_ops;
+                               function.lazy_state = lazy_translation_state::translated;
+                               function.ops.clear_destroy();
+                               function.br_table_targets.clear_destroy();
+                               task.links = {};
+                           }};
+            ::uwvm2::utils::thread::parallel_for_work_stealing(tasks.size(), thread_count, link_task);
+
+            for(auto& module: compiled_modules) { module.code_arena.seal(); }
+        }
+
+        /// @brief      Compile every (already translated) defined function with the tier-up compiler, spread over the hardware threads.
+        inline void compile_all_functions() noexcept
+        {
+            auto tasks{get_translation_tasks()};
+            auto compile_task{[&tasks](::std::size_t index) noexcept
+                              { ::uwvm2::compiler::uwvm_int::details::compile_tier2(tasks.index_unchecked(index).function); }};
+            ::uwvm2::utils::thread::parallel_for_work_stealing(tasks.size(), ::uwvm2::utils::thread::get_hardware_concurrency(), compile_task);
+        }
+
+        /// @brief      Verify every defined function on background threads, leaving one hardware thread to the modules.
+        /// @details    A body is verified by translating it through its lazy stub, so the first call of the function either finds the body translated
+        ///             or translates (and thereby verifies) it itself. A body is only published once all of it has passed. The first failure rejects
+        ///             the module, see `verification_error`.
+        inline void start_background_verification() noexcept
+        {
+            for(auto& module: compiled_modules) { module.report_verification_errors = true; }
+
+            auto const hardware_concurrency{::uwvm2::utils::thread::get_hardware_concurrency()};
+            auto const thread_count{hardware_concurrency > 1uz ? hardware_concurrency - 1uz : 1uz};
+
+            auto tasks{get_translation_tasks()};
+            auto const task_count{tasks.size()};
+            background_verification.start(task_count,
+                                          thread_count,
+                                          [tasks = ::std::move(tasks)](::std::size_t index) noexcept
+                                          { translate_on_first_call(tasks.index_unchecked(index).function); });
+        }
+    }  // namespace details
+
+    /// @brief      Build the interpreter state of every wasm module and translate its defined functions.
+    /// @details    Must be called after `::uwvm2::uwvm::runtime::initializer::initialize_runtime()`, which resolves imports and applies element/data
+    ///             segments. The runtime storage is not modified afterwards, so the pointers taken here stay valid.
+    ///
+    ///             With `runtime_mode_t::lazy_compile` the defined functions are left as stubs that translate themselves on their first call.
+    ///             `runtime_mode_t::lazy_compile_with_full_code_verification` also verifies every body on background threads while the modules run,
+    ///             see `wait_for_background_verification`. `runtime_mode_t::full_compile` translates every body here, on all hardware threads, into
+    ///             one read-only code arena per module, which rejects invalid code before anything runs.
+    ///
+    ///             With `runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered` and an installed `tier_up_compiler`, the functions are translated
+    ///             with hotness counters and the tier-up thread is started, see `request_tier_up`. Without a tier-up compiler the modules are
+    ///             only interpreted. With `runtime_compiler_t::llvm_jit_only` every function is translated and then compiled here, on all hardware
+    ///             threads; a function the compiler rejects stays interpreted.
+    inline void instantiate(::uwvm2::uwvm::runtime::runtime_mode::runtime_mode_t mode,
+                            ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t compiler) noexcept
+    {
+        // The previous verification and tier-up compilation still refer to the modules.
+        background_verification.join();
+        ::uwvm2::compiler::uwvm_int::stop_tier_up_thread();
+
+        bool const tier_up{compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_llvm_jit_tiered &&
+                           ::uwvm2::compiler::uwvm_int::tier_up_compiler.compile != nullptr};
+        bool const jit_only{compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::llvm_jit_only &&
+                            ::uwvm2::compiler::uwvm_int::tier_up_compiler.compile != nullptr};
+
+        compiled_modules.clear();
+        table_bindings.clear();
+
+#if defined(UWVM_SUPPORT_MMAP)
+        ::uwvm2::object::memory::signal::protected_fault_handler = details::report_guard_region_fault;
+#endif
+
+        compiled_modules.reserve(::uwvm2::uwvm::wasm::storage::all_module.size());
+
+        // Function shells, so that imports of any module can be resolved to them.
+        for(auto const& [module_name, mod]: ::uwvm2::uwvm::wasm::storage::all_module)
+        {
+            if(mod.type != ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm && mod.type != ::uwvm2::uwvm::wasm::type::module_type_t::preloaded_wasm)
+            {
+                // Host modules are only reached through the imports of wasm modules.
+                continue;
+            }
+
+            auto const rt_it{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.find(module_name)};
+            if(rt_it == ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage.end() || mod.module_storage_ptr.wf == nullptr) [[unlikely]]
+            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                ::fast_io::fast_terminate();
+            }
+
+            compiled_modules.emplace_back();
+            auto& module{compiled_modules.back_unchecked()};
+            module.module_name = module_name;
+            // The native code of `llvm_jit_only` is entered through the same ops.
+            module.tier_up = tier_up || jit_only;
+            module.runtime_module_ptr = ::std::addressof(rt_it->second);
+            module.module_begin = reinterpret_cast<::std::byte const*>(mod.module_storage_ptr.wf->wasm_file.cbegin());
+            module.module_end = reinterpret_cast<::std::byte const*>(mod.module_storage_ptr.wf->wasm_file.cend());
+            details::get_module_sections(*mod.module_storage_ptr.wf, module);
+
+            auto& rt{rt_it->second};
+            module.host_functions.resize(rt.imported_function_vec_storage.size());
+            module.functions.resize(rt.local_defined_function_vec_storage.size());
+
+            auto function_curr{module.functions.data()};
+            for(auto const& defined: rt.local_defined_function_vec_storage)
+            {
+                if(defined.function_type_ptr == nullptr || defined.wasm_code_ptr == nullptr) [[unlikely]]
+                {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                    ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                    ::fast_io::fast_terminate();
+                }
+
+                function_curr->function_ptr = ::std::addressof(defined);
+                function_curr->function_type_ptr = defined.function_type_ptr;
+                function_curr->module_ptr = ::std::addressof(module);
+                function_curr->param_count = get_param_count(defined.function_type_ptr);
+                function_curr->result_count = get_result_count(defined.function_type_ptr);
+                function_curr->local_count = function_curr->param_count + static_cast<::std::size_t>(defined.wasm_code_ptr->all_local_count);
+                ++function_curr;
+            }
+        }
+
+        // Function index spaces, memories and globals.
+        ::std::size_t table_count{};
+        for(auto& module: compiled_modules)
+        {
+            auto& rt{*module.runtime_module_ptr};
+            auto const imported_count{rt.imported_function_vec_storage.size()};
+
+            module.function_index_space.reserve(imported_count + module.functions.size());
+            for(::std::size_t i{}; i != imported_count; ++i) { module.function_index_space.push_back_unchecked(details::resolve_imported_function(module, i)); }
+            for(auto const& function: module.functions)
+            {
+                module.function_index_space.push_back_unchecked({::std::addressof(function), nullptr, function.function_type_ptr, callable_kind::compiled});
+            }
+
+            ::uwvm2::compiler::checker::build_module_context(rt, module.function_types, module.function_type_count, module.validation_context);
+
+            if(module.has_start_function && module.start_function_index >= module.function_index_space.size()) [[unlikely]]
+            {
+                instantiate_error(module.module_name, u8"invalid start function index");
+            }
+
+            details::bind_memory(module);
+            details::bind_globals(module);
+
+            table_count += rt.local_defined_table_vec_storage.size();
+        }
+
+        // Tables, whose elements refer to the function index spaces built above.
+        table_bindings.reserve(table_count);
+        for(auto const& module: compiled_modules)
+        {
+            for(auto const& table: module.runtime_module_ptr->local_defined_table_vec_storage) { details::build_table_binding(table); }
+        }
+        for(auto& module: compiled_modules) { details::bind_table(module); }
+
+        // Translation, which needs all of the above to resolve immediates. The superinstruction census covers whole modules, so it needs every body,
+        // and so does `llvm_jit_only`, which compiles the bodies the translation has validated.
+        if(mode == ::uwvm2::uwvm::runtime::runtime_mode::runtime_mode_t::full_compile || ::uwvm2::compiler::uwvm_int::flags::show_superinst_census || jit_only)
+        {
+            details::translate_all_functions();
+        }
+        else if(mode == ::uwvm2::uwvm::runtime::runtime_mode::runtime_mode_t::lazy_compile_with_full_code_verification)
+        {
+            details::start_background_verification();
+        }
+
+        ::std::size_t host_call_buffer_size{};
+        for(auto const& module: compiled_modules)
+        {
+            for(auto const& host: module.host_functions)
+            {
+                auto const size{host.param_bytes + host.result_bytes};
+                if(size > host_call_buffer_size) { host_call_buffer_size = size; }
+            }
+        }
+
+        auto& ctx{main_execution_context};
+        ctx.stack.clear();
+        ctx.stack.resize(default_stack_slot_count);
+        ctx.stack_end = ctx.stack.data() + ctx.stack.size();
+        ctx.call_depth = 0uz;
+        ctx.max_call_depth = default_max_call_depth;
+        ctx.host_call_buffer.clear();
+        ctx.host_call_buffer.resize(host_call_buffer_size);
+
+        if(tier_up) { ::uwvm2::compiler::uwvm_int::start_tier_up_thread(); }
+        if(jit_only) { details::compile_all_functions(); }
+    }
+
+    /// @brief      Wait until the background verification of `runtime_mode_t::lazy_compile_with_full_code_verification` is done. A module that
+    ///             finished running is still rejected if one of its bodies turns out to be invalid.
+    /// @note       Called on every way out of the modules: after `_start` returns, before a trap terminates the process in `call_function` and
+    ///             before WASI `proc_exit` (`wasip1_proc_exit_prepare_func_ptr`).
+    inline void wait_for_background_verification() noexcept { background_verification.join(); }
+
+    /// @brief      Whether `instantiate` can honor `compiler`. Both JIT modes need an installed `tier_up_compiler`.
+    inline bool is_runtime_compiler_available(::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t compiler) noexcept
+    {
+        return compiler == ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_only ||
+               ::uwvm2::compiler::uwvm_int::tier_up_compiler.compile != nullptr;
+    }
+
+    /// @brief      Find an instantiated module by name.
+    inline compiled_module_t const* find_compiled_module(::uwvm2::utils::container::u8string_view module_name) noexcept
+    {
+        for(auto const& module: compiled_modules)
+        {
+            if(module.module_name == module_name) { return ::std::addressof(module); }
+        }
+        return nullptr;
+    }
+
+    namespace details
+    {
+        inline void invoke_function(compiled_module_t const& module,
+                                    ::std::size_t function_index,
+                                    wasm_value_slot_t const* args,
+                                    wasm_value_slot_t* results,
+                                    execution_context_t& ctx) noexcept
+        {
+            if(function_index >= module.function_index_space.size()) [[unlikely]]
+            {
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                ::fast_io::fast_terminate();
+            }
+
+            auto const& callee{module.function_index_space.index_unchecked(function_index)};
+            auto const param_count{get_param_count(callee.function_type_ptr)};
+            auto const result_count{get_result_count(callee.function_type_ptr)};
+
+            auto const frame_base{ctx.stack.data()};
+            if(ctx.stack.size() < param_count || ctx.stack.size() < result_count) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::call_stack_exhausted);
+            }
+
+            if(param_count != 0uz) { ::std::memcpy(frame_base, args, param_count * sizeof(wasm_value_slot_t)); }
+            invoke_callable(callee, frame_base, ::std::addressof(ctx));
+            if(result_count != 0uz) { ::std::memcpy(results, frame_base, result_count * sizeof(wasm_value_slot_t)); }
+        }
+    }  // namespace details
+
+    /// @brief      Outcome of `try_call_function`.
+    struct call_result_t
+    {
+        bool trapped{};
+        trap_kind trap{};
+    };
+
+    /// @brief      Call function `function_index` (function index space) of `module` from the host, returning its trap instead of terminating.
+    /// @details    `args` holds one slot per parameter and `results` receives one slot per result, it is left untouched after a trap. The call
+    ///             starts at the bottom of the stack, host functions never call back into wasm so there is no outer wasm frame to preserve.
+    ///
+    ///             Traps of the interpreter, of JIT code and faults in the guard region of a memory all unwind to this call. The memories, tables
+    ///             and globals keep the stores made before the trap, and the modules can be called again. Host functions run without a trap frame,
+    ///             so a fault inside one still terminates the process.
+    inline call_result_t try_call_function(compiled_module_t const& module,
+                                           ::std::size_t function_index,
+                                           wasm_value_slot_t const* args,
+                                           wasm_value_slot_t* results,
+                                           execution_context_t& ctx = main_execution_context) noexcept
+    {
+        trap_frame_t frame;  // The buffer is set below
+        frame.previous = current_trap_frame;
+        auto const call_depth{ctx.call_depth};
+
+#if defined(_WIN32) && !defined(__CYGWIN__)
+        if(setjmp(frame.buffer) != 0)
+#else
+        if(sigsetjmp(frame.buffer, 1) != 0)
+#endif
+        {
+            current_trap_frame = frame.previous;
+            ctx.call_depth = call_depth;
+            return {true, frame.kind};
+        }
+
+        current_trap_frame = ::std::addressof(frame);
+        details::invoke_function(module, function_index, args, results, ctx);
+        current_trap_frame = frame.previous;
+        return {};
+    }
+
+    /// @brief      Call function `function_index` (function index space) of `module` from the host, a trap is reported and terminates the process.
+    /// @details    See `try_call_function`.
+    inline void call_function(compiled_module_t const& module,
+                              ::std::size_t function_index,
+                              wasm_value_slot_t const* args,
+                              wasm_value_slot_t* results,
+                              execution_context_t& ctx = main_execution_context) noexcept
+    {
+        if(auto const result{try_call_function(module, function_index, args, results, ctx)}; result.trapped) [[unlikely]]
+        {
+            // An invalid body rejects the module rather than letting it trap.
+            ::uwvm2::compiler::uwvm_int::wait_for_background_verification();
+            ::uwvm2::compiler::uwvm_int::report_trap(result.trap);
+            ::fast_io::fast_terminate();
+        }
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,230 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <atomic>
+# include <bit>
+# include <limits>
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/object/impl.h>
+# include "define.h"
+# include "trap.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      Current accessible range of a linear memory, in bytes.
+    struct memory_view_t
+    {
+        ::std::byte* begin{};
+        ::std::size_t length{};
+    };
+
+    /// @brief      Accessor for memories owned by the vm (`native_memory_t`).
+    /// @details    The interpreter only runs on a single thread, so the memory is read directly without entering the allocator backends' operation
+    ///             guards. The mmap backend never moves its base address, the allocator backends may move it on grow, which is why the view is
+    ///             re-read by every access instead of being cached across ops.
+    struct native_memory_accessor
+    {
+        inline static constexpr bool elide_bounds_checks{false};
+
+        UWVM_ALWAYS_INLINE inline static memory_view_t view(memory_binding_t const* binding) noexcept
+        {
+            auto const& memory{*binding->native_memory};
+            if constexpr(requires { memory.memory_length_p; })
+            {
+                return {memory.memory_begin, memory.memory_length_p->load(::std::memory_order_acquire)};
+            }
+            else
+            {
+                return {memory.memory_begin, memory.memory_length};
+            }
+        }
+
+        inline static ::std::size_t page_count(memory_binding_t const* binding) noexcept { return binding->native_memory->get_page_size(); }
+
+        /// @return     The old page count, or -1 (as u32) if the memory cannot grow.
+        inline static ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 grow(memory_binding_t const* binding,
+                                                                                 ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 delta) noexcept
+        {
+            auto& memory{*binding->native_memory};
+            auto const old_page_count{memory.get_page_size()};
+
+            if(static_cast<::std::uint_least64_t>(delta) > binding->max_page_count - static_cast<::std::uint_least64_t>(old_page_count)) [[unlikely]]
+            {
+                return ::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max();
+            }
+
+            if(delta != 0u)
+            {
+                auto const max_limit_memory_length{static_cast<::std::size_t>(binding->max_page_count << memory.custom_page_size_log2)};
+
+                if(::uwvm2::object::memory::flags::grow_strict)
+                {
+                    if(!memory.grow_strictly(static_cast<::std::size_t>(delta), max_limit_memory_length)) [[unlikely]]
+                    {
+                        return ::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max();
+                    }
+                }
+                else
+                {
+                    memory.grow_silently(static_cast<::std::size_t>(delta), max_limit_memory_length);
+                }
+            }
+
+            return static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(old_page_count);
+        }
+    };
+
+    /// @brief      Accessor for native memories whose reservation guards every wasm32 effective address (`memory_binding_t::elide_bounds_checks`).
+    /// @details    Accesses are not bounds checked: an out of bounds access faults in the guard region and the protected segment of the memory
+    ///             reports it as an out of bounds trap.
+    struct guarded_native_memory_accessor : native_memory_accessor
+    {
+        inline static constexpr bool elide_bounds_checks{true};
+    };
+
+    /// @brief      Accessor for memories exported by a local-imported (host) module.
+    struct local_imported_memory_accessor
+    {
+        inline static constexpr bool elide_bounds_checks{false};
+
+        UWVM_ALWAYS_INLINE inline static memory_view_t view(memory_binding_t const* binding) noexcept
+        {
+            auto const module_ptr{binding->local_imported_module};
+            auto const index{binding->local_imported_index};
+            return {module_ptr->memory_begin_from_index(index),
+                    static_cast<::std::size_t>(module_ptr->memory_size_from_index(index) * module_ptr->memory_page_size_from_index(index))};
+        }
+
+        inline static ::std::size_t page_count(memory_binding_t const* binding) noexcept
+        { return static_cast<::std::size_t>(binding->local_imported_module->memory_size_from_index(binding->local_imported_index)); }
+
+        inline static ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 grow(memory_binding_t const* binding,
+                                                                                 ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 delta) noexcept
+        {
+            auto const module_ptr{binding->local_imported_module};
+            auto const index{binding->local_imported_index};
+            auto const old_page_count{module_ptr->memory_size_from_index(index)};
+
+            if(static_cast<::std::uint_least64_t>(delta) > binding->max_page_count - old_page_count) [[unlikely]]
+            {
+                return ::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max();
+            }
+
+            if(delta != 0u && !module_ptr->memory_grow_from_index(index, static_cast<::std::uint_least64_t>(delta))) [[unlikely]]
+            {
+                return ::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max();
+            }
+
+            return static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(old_page_count);
+        }
+    };
+
+    /// @brief      Compute the host address of `[addr + offset, addr + offset + Size)`, trapping if it is out of bounds.
+    /// @details    Both operands are 32-bit, so the 64-bit sum cannot overflow. Accessors that elide bounds checks leave the trap to the guard region.
+    template <::std::size_t Size, typename Accessor>
+    UWVM_ALWAYS_INLINE inline ::std::byte* checked_memory_address(memory_binding_t const* binding,
+                                                                  ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 addr,
+                                                                  ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 offset) noexcept
+    {
+        auto const effective_address{static_cast<::std::uint_least64_t>(addr) + static_cast<::std::uint_least64_t>(offset)};
+        if constexpr(Accessor::elide_bounds_checks)
+        {
+            // The base address of a guarded memory never moves, the length does not need to be read.
+            return binding->native_memory->memory_begin + static_cast<::std::size_t>(effective_address);
+        }
+        else
+        {
+            auto const mem{Accessor::view(binding)};
+            if(effective_address + Size > static_cast<::std::uint_least64_t>(mem.length)) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::out_of_bounds_memory_access);
+            }
+            return mem.begin + static_cast<::std::size_t>(effective_address);
+        }
+    }
+
+    /// @brief      Read a little-endian value of the in-memory type `MemT`.
+    template <typename MemT>
+    UWVM_ALWAYS_INLINE inline MemT load_little_endian(::std::byte const* p) noexcept
+    {
+        if constexpr(::std::is_floating_point_v<MemT> || !::std::is_integral_v<MemT>)
+        {
+            using bits_t = ::std::conditional_t<sizeof(MemT) == 4uz, ::std::uint_least32_t, ::std::uint_least64_t>;
+            bits_t bits;  // No initialization necessary
+            ::std::memcpy(::std::addressof(bits), p, sizeof(bits_t));
+            return ::std::bit_cast<MemT>(::fast_io::little_endian(bits));
+        }
+        else if constexpr(sizeof(MemT) == 1uz)
+        {
+            MemT v;  // No initialization necessary
+            ::std::memcpy(::std::addressof(v), p, sizeof(MemT));
+            return v;
+        }
+        else
+        {
+            using unsigned_t = ::std::make_unsigned_t<MemT>;
+            unsigned_t bits;  // No initialization necessary
+            ::std::memcpy(::std::addressof(bits), p, sizeof(unsigned_t));
+            return static_cast<MemT>(::fast_io::little_endian(bits));
+        }
+    }
+
+    /// @brief      Write a value of the in-memory type `MemT` in little-endian order.
+    template <typename MemT>
+    UWVM_ALWAYS_INLINE inline void store_little_endian(::std::byte* p, MemT v) noexcept
+    {
+        if constexpr(::std::is_floating_point_v<MemT> || !::std::is_integral_v<MemT>)
+        {
+            using bits_t = ::std::conditional_t<sizeof(MemT) == 4uz, ::std::uint_least32_t, ::std::uint_least64_t>;
+            auto const bits{::fast_io::little_endian(::std::bit_cast<bits_t>(v))};
+            ::std::memcpy(p, ::std::addressof(bits), sizeof(bits_t));
+        }
+        else if constexpr(sizeof(MemT) == 1uz) { ::std::memcpy(p, ::std::addressof(v), sizeof(MemT)); }
+        else
+        {
+            auto const bits{::fast_io::little_endian(static_cast<::std::make_unsigned_t<MemT>>(v))};
+            ::std::memcpy(p, ::std::addressof(bits), sizeof(bits));
+        }
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
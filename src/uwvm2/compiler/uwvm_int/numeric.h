@@ -0,0 +1,384 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cmath>
+# include <bit>
+# include <limits>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include "trap.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+/// @brief      wasm1 numeric semantics used by the interpreter handlers.
+/// @details    Integer arithmetic is carried out on the unsigned counterpart so that overflow wraps as required by the spec without invoking UB.
+///             Float operations that the spec defines bitwise (abs/neg/copysign) operate on the bit pattern, so NaN payloads are preserved.
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int::numeric
+{
+    using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+    using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+    using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+    using wasm_u64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u64;
+    using wasm_f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+    using wasm_f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+    template <typename F>
+    using float_bits_t = ::std::conditional_t<sizeof(F) == 4uz, ::std::uint_least32_t, ::std::uint_least64_t>;
+
+    template <typename F>
+    inline constexpr float_bits_t<F> float_sign_mask{static_cast<float_bits_t<F>>(static_cast<float_bits_t<F>>(1u) << (sizeof(F) * 8uz - 1uz))};
+
+    /// @brief integer
+
+    template <typename I>
+    inline constexpr wasm_i32 int_eqz(I a) noexcept
+    { return static_cast<wasm_i32>(a == static_cast<I>(0)); }
+
+    template <typename I>
+    inline constexpr I int_clz(I a) noexcept
+    { return static_cast<I>(::std::countl_zero(static_cast<::std::make_unsigned_t<I>>(a))); }
+
+    template <typename I>
+    inline constexpr I int_ctz(I a) noexcept
+    { return static_cast<I>(::std::countr_zero(static_cast<::std::make_unsigned_t<I>>(a))); }
+
+    template <typename I>
+    inline constexpr I int_popcnt(I a) noexcept
+    { return static_cast<I>(::std::popcount(static_cast<::std::make_unsigned_t<I>>(a))); }
+
+    template <typename I>
+    inline constexpr I int_add(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) + static_cast<unsigned_t>(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_sub(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) - static_cast<unsigned_t>(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_mul(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) * static_cast<unsigned_t>(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_div_s(I a, I b) noexcept
+    {
+        if(b == static_cast<I>(0)) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_divide_by_zero); }
+        if(a == ::std::numeric_limits<I>::min() && b == static_cast<I>(-1)) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_overflow);
+        }
+        return static_cast<I>(a / b);
+    }
+
+    template <typename I>
+    inline constexpr I int_div_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        if(b == static_cast<I>(0)) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_divide_by_zero); }
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) / static_cast<unsigned_t>(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_rem_s(I a, I b) noexcept
+    {
+        if(b == static_cast<I>(0)) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_divide_by_zero); }
+        // INT_MIN % -1 is UB in C++ but defined as 0 in wasm.
+        if(b == static_cast<I>(-1)) [[unlikely]] { return static_cast<I>(0); }
+        return static_cast<I>(a % b);
+    }
+
+    template <typename I>
+    inline constexpr I int_rem_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        if(b == static_cast<I>(0)) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_divide_by_zero); }
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) % static_cast<unsigned_t>(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_and(I a, I b) noexcept
+    { return static_cast<I>(a & b); }
+
+    template <typename I>
+    inline constexpr I int_or(I a, I b) noexcept
+    { return static_cast<I>(a | b); }
+
+    template <typename I>
+    inline constexpr I int_xor(I a, I b) noexcept
+    { return static_cast<I>(a ^ b); }
+
+    template <typename I>
+    inline constexpr unsigned int_shift_count(I b) noexcept
+    {
+        constexpr unsigned mask{static_cast<unsigned>(::std::numeric_limits<::std::make_unsigned_t<I>>::digits - 1)};
+        return static_cast<unsigned>(static_cast<::std::make_unsigned_t<I>>(b) & mask);
+    }
+
+    template <typename I>
+    inline constexpr I int_shl(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) << int_shift_count(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_shr_s(I a, I b) noexcept
+    {
+        // Since C++20, right shift of a negative signed value is an arithmetic shift.
+        return static_cast<I>(a >> int_shift_count(b));
+    }
+
+    template <typename I>
+    inline constexpr I int_shr_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<I>(static_cast<unsigned_t>(static_cast<unsigned_t>(a) >> int_shift_count(b)));
+    }
+
+    template <typename I>
+    inline constexpr I int_rotl(I a, I b) noexcept
+    { return static_cast<I>(::std::rotl(static_cast<::std::make_unsigned_t<I>>(a), static_cast<int>(int_shift_count(b)))); }
+
+    template <typename I>
+    inline constexpr I int_rotr(I a, I b) noexcept
+    { return static_cast<I>(::std::rotr(static_cast<::std::make_unsigned_t<I>>(a), static_cast<int>(int_shift_count(b)))); }
+
+    /// @brief compare (all comparisons produce an i32)
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_eq(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a == b); }
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_ne(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a != b); }
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_lt(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a < b); }
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_gt(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a > b); }
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_le(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a <= b); }
+
+    template <typename T>
+    inline constexpr wasm_i32 cmp_ge(T a, T b) noexcept
+    { return static_cast<wasm_i32>(a >= b); }
+
+    template <typename I>
+    inline constexpr wasm_i32 cmp_lt_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<wasm_i32>(static_cast<unsigned_t>(a) < static_cast<unsigned_t>(b));
+    }
+
+    template <typename I>
+    inline constexpr wasm_i32 cmp_gt_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<wasm_i32>(static_cast<unsigned_t>(a) > static_cast<unsigned_t>(b));
+    }
+
+    template <typename I>
+    inline constexpr wasm_i32 cmp_le_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<wasm_i32>(static_cast<unsigned_t>(a) <= static_cast<unsigned_t>(b));
+    }
+
+    template <typename I>
+    inline constexpr wasm_i32 cmp_ge_u(I a, I b) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+        return static_cast<wasm_i32>(static_cast<unsigned_t>(a) >= static_cast<unsigned_t>(b));
+    }
+
+    /// @brief float
+
+    template <typename F>
+    inline constexpr F float_abs(F a) noexcept
+    { return ::std::bit_cast<F>(static_cast<float_bits_t<F>>(::std::bit_cast<float_bits_t<F>>(a) & ~float_sign_mask<F>)); }
+
+    template <typename F>
+    inline constexpr F float_neg(F a) noexcept
+    { return ::std::bit_cast<F>(static_cast<float_bits_t<F>>(::std::bit_cast<float_bits_t<F>>(a) ^ float_sign_mask<F>)); }
+
+    template <typename F>
+    inline constexpr F float_copysign(F a, F b) noexcept
+    {
+        return ::std::bit_cast<F>(static_cast<float_bits_t<F>>((::std::bit_cast<float_bits_t<F>>(a) & ~float_sign_mask<F>) |
+                                                               (::std::bit_cast<float_bits_t<F>>(b) & float_sign_mask<F>)));
+    }
+
+    template <typename F>
+    inline F float_ceil(F a) noexcept
+    { return ::std::ceil(a); }
+
+    template <typename F>
+    inline F float_floor(F a) noexcept
+    { return ::std::floor(a); }
+
+    template <typename F>
+    inline F float_trunc(F a) noexcept
+    { return ::std::trunc(a); }
+
+    template <typename F>
+    inline F float_nearest(F a) noexcept
+    {
+        // The default floating-point environment rounds to nearest, ties to even, which is what wasm requires.
+        return ::std::nearbyint(a);
+    }
+
+    template <typename F>
+    inline F float_sqrt(F a) noexcept
+    { return ::std::sqrt(a); }
+
+    template <typename F>
+    inline constexpr F float_add(F a, F b) noexcept
+    { return a + b; }
+
+    template <typename F>
+    inline constexpr F float_sub(F a, F b) noexcept
+    { return a - b; }
+
+    template <typename F>
+    inline constexpr F float_mul(F a, F b) noexcept
+    { return a * b; }
+
+    template <typename F>
+    inline constexpr F float_div(F a, F b) noexcept
+    { return a / b; }
+
+    template <typename F>
+    inline constexpr F float_min(F a, F b) noexcept
+    {
+        // NaN operands propagate (the addition yields a quiet NaN).
+        if(a != a || b != b) [[unlikely]] { return a + b; }
+        // -0 is less than +0.
+        if(a == b) [[unlikely]] { return (::std::bit_cast<float_bits_t<F>>(a) & float_sign_mask<F>) ? a : b; }
+        return a < b ? a : b;
+    }
+
+    template <typename F>
+    inline constexpr F float_max(F a, F b) noexcept
+    {
+        if(a != a || b != b) [[unlikely]] { return a + b; }
+        if(a == b) [[unlikely]] { return (::std::bit_cast<float_bits_t<F>>(a) & float_sign_mask<F>) ? b : a; }
+        return a > b ? a : b;
+    }
+
+    /// @brief conversion
+
+    inline constexpr wasm_i32 i32_wrap_i64(wasm_i64 a) noexcept
+    { return static_cast<wasm_i32>(static_cast<wasm_u32>(static_cast<wasm_u64>(a))); }
+
+    inline constexpr wasm_i64 i64_extend_i32_s(wasm_i32 a) noexcept
+    { return static_cast<wasm_i64>(a); }
+
+    inline constexpr wasm_i64 i64_extend_i32_u(wasm_i32 a) noexcept
+    { return static_cast<wasm_i64>(static_cast<wasm_u32>(a)); }
+
+    /// @brief      float -> signed integer, trapping on NaN and on results that are not representable.
+    /// @details    The bounds +-2^(N-1) are powers of two and therefore exact in both f32 and f64, so comparing the truncated value against them is
+    ///             exact.
+    template <typename I, typename F>
+    inline I trunc_s(F a) noexcept
+    {
+        if(a != a) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::invalid_conversion_to_integer); }
+
+        constexpr F bound{static_cast<F>(static_cast<::std::make_unsigned_t<I>>(static_cast<::std::make_unsigned_t<I>>(1u)
+                                                                                  << (::std::numeric_limits<::std::make_unsigned_t<I>>::digits - 1)))};
+        auto const t{::std::trunc(a)};
+        if(!(t >= -bound && t < bound)) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_overflow); }
+        return static_cast<I>(t);
+    }
+
+    /// @brief      float -> unsigned integer (stored in the signed wasm type).
+    template <typename I, typename F>
+    inline I trunc_u(F a) noexcept
+    {
+        using unsigned_t = ::std::make_unsigned_t<I>;
+
+        if(a != a) [[unlikely]] { ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::invalid_conversion_to_integer); }
+
+        // 2^N, computed as 2 * 2^(N-1) to stay within the unsigned range.
+        constexpr F bound{static_cast<F>(static_cast<unsigned_t>(static_cast<unsigned_t>(1u) << (::std::numeric_limits<unsigned_t>::digits - 1))) *
+                          static_cast<F>(2)};
+        auto const t{::std::trunc(a)};
+        // -0.x truncates to -0, which compares equal to 0 and is accepted.
+        if(!(t >= static_cast<F>(0) && t < bound)) [[unlikely]]
+        {
+            ::uwvm2::compiler::uwvm_int::trap(::uwvm2::compiler::uwvm_int::trap_kind::integer_overflow);
+        }
+        return static_cast<I>(static_cast<unsigned_t>(t));
+    }
+
+    template <typename F, typename I>
+    inline constexpr F convert_s(I a) noexcept
+    { return static_cast<F>(a); }
+
+    template <typename F, typename I>
+    inline constexpr F convert_u(I a) noexcept
+    { return static_cast<F>(static_cast<::std::make_unsigned_t<I>>(a)); }
+
+    inline constexpr wasm_f32 f32_demote_f64(wasm_f64 a) noexcept
+    { return static_cast<wasm_f32>(a); }
+
+    inline constexpr wasm_f64 f64_promote_f32(wasm_f32 a) noexcept
+    { return static_cast<wasm_f64>(a); }
+
+    template <typename To, typename From>
+    inline constexpr To reinterpret(From a) noexcept
+    {
+        static_assert(sizeof(To) == sizeof(From));
+        return ::std::bit_cast<To>(a);
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
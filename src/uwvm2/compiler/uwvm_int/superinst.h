@@ -0,0 +1,370 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/compiler/uwvm_int/flags/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      Superinstructions fused by the translator.
+    /// @details    The set covers the pairs that dominate compiler output: addresses held in locals, constant right operands and loop
+    ///             conditions. Run with `--runtime-int-superinst-census` to see how often each one applies to the code of a workload and which
+    ///             opcode pairs are left, which is what new superinstructions should be picked from.
+    enum class superinst_kind : unsigned
+    {
+        // local.get; *.load
+        load_local,
+        // i32.const; <i32 binop>
+        binary_reg_const,
+        // <numeric>; br_if (mostly compares)
+        br_if_reg,
+        // local.get; br_if and local.tee; br_if
+        br_if_local
+    };
+
+    inline constexpr ::std::size_t superinst_kind_count{4uz};
+
+    inline constexpr ::uwvm2::utils::container::u8string_view superinst_names[superinst_kind_count]{u8"local.get + load",
+                                                                                                   u8"i32.const + i32 binop",
+                                                                                                   u8"numeric + br_if",
+                                                                                                   u8"local.get/local.tee + br_if"};
+
+    struct superinst_counter_t
+    {
+        // Instructions that ended a superinstruction of this kind.
+        ::std::uint_least64_t fused{};
+        // Instructions that a superinstruction of this kind could end with.
+        ::std::uint_least64_t candidates{};
+    };
+
+    /// @brief      Static census of the translated code, only collected if `flags::show_superinst_census` is set.
+    /// @note       Every count is a code site. The dispatch path has no counters, so how often a site is executed is not known.
+    struct superinst_census_t
+    {
+        inline static constexpr ::std::size_t opcode_count{256uz};
+
+        superinst_counter_t counters[superinst_kind_count]{};
+        // Adjacent opcode pairs of reachable code, indexed by `first * opcode_count + second`. Allocated on first use.
+        ::uwvm2::utils::container::vector<::std::uint_least64_t> bigrams{};
+
+        inline void record_candidate(superinst_kind kind) noexcept { ++counters[static_cast<unsigned>(kind)].candidates; }
+
+        inline void record_fused(superinst_kind kind) noexcept { ++counters[static_cast<unsigned>(kind)].fused; }
+
+        inline void record_bigram(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic first,
+                                  ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic second) noexcept
+        {
+            if(bigrams.empty()) { bigrams.resize(opcode_count * opcode_count); }
+            ++bigrams.index_unchecked(static_cast<::std::size_t>(first) * opcode_count + static_cast<::std::size_t>(second));
+        }
+    };
+
+    inline superinst_census_t superinst_census{};  // [global]
+
+    namespace details
+    {
+        inline constexpr ::uwvm2::utils::container::u8string_view get_op_basic_name(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+        {
+            using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+
+            switch(op)
+            {
+                case op_basic::unreachable: return u8"unreachable";
+                case op_basic::nop: return u8"nop";
+                case op_basic::block: return u8"block";
+                case op_basic::loop: return u8"loop";
+                case op_basic::if_: return u8"if";
+                case op_basic::else_: return u8"else";
+                case op_basic::end: return u8"end";
+                case op_basic::br: return u8"br";
+                case op_basic::br_if: return u8"br_if";
+                case op_basic::br_table: return u8"br_table";
+                case op_basic::return_: return u8"return";
+                case op_basic::call: return u8"call";
+                case op_basic::call_indirect: return u8"call_indirect";
+                case op_basic::drop: return u8"drop";
+                case op_basic::select: return u8"select";
+                case op_basic::local_get: return u8"local.get";
+                case op_basic::local_set: return u8"local.set";
+                case op_basic::local_tee: return u8"local.tee";
+                case op_basic::global_get: return u8"global.get";
+                case op_basic::global_set: return u8"global.set";
+                case op_basic::i32_load: return u8"i32.load";
+                case op_basic::i64_load: return u8"i64.load";
+                case op_basic::f32_load: return u8"f32.load";
+                case op_basic::f64_load: return u8"f64.load";
+                case op_basic::i32_load8_s: return u8"i32.load8_s";
+                case op_basic::i32_load8_u: return u8"i32.load8_u";
+                case op_basic::i32_load16_s: return u8"i32.load16_s";
+                case op_basic::i32_load16_u: return u8"i32.load16_u";
+                case op_basic::i64_load8_s: return u8"i64.load8_s";
+                case op_basic::i64_load8_u: return u8"i64.load8_u";
+                case op_basic::i64_load16_s: return u8"i64.load16_s";
+                case op_basic::i64_load16_u: return u8"i64.load16_u";
+                case op_basic::i64_load32_s: return u8"i64.load32_s";
+                case op_basic::i64_load32_u: return u8"i64.load32_u";
+                case op_basic::i32_store: return u8"i32.store";
+                case op_basic::i64_store: return u8"i64.store";
+                case op_basic::f32_store: return u8"f32.store";
+                case op_basic::f64_store: return u8"f64.store";
+                case op_basic::i32_store8: return u8"i32.store8";
+                case op_basic::i32_store16: return u8"i32.store16";
+                case op_basic::i64_store8: return u8"i64.store8";
+                case op_basic::i64_store16: return u8"i64.store16";
+                case op_basic::i64_store32: return u8"i64.store32";
+                case op_basic::memory_size: return u8"memory.size";
+                case op_basic::memory_grow: return u8"memory.grow";
+                case op_basic::i32_const: return u8"i32.const";
+                case op_basic::i64_const: return u8"i64.const";
+                case op_basic::f32_const: return u8"f32.const";
+                case op_basic::f64_const: return u8"f64.const";
+                case op_basic::i32_eqz: return u8"i32.eqz";
+                case op_basic::i32_eq: return u8"i32.eq";
+                case op_basic::i32_ne: return u8"i32.ne";
+                case op_basic::i32_lt_s: return u8"i32.lt_s";
+                case op_basic::i32_lt_u: return u8"i32.lt_u";
+                case op_basic::i32_gt_s: return u8"i32.gt_s";
+                case op_basic::i32_gt_u: return u8"i32.gt_u";
+                case op_basic::i32_le_s: return u8"i32.le_s";
+                case op_basic::i32_le_u: return u8"i32.le_u";
+                case op_basic::i32_ge_s: return u8"i32.ge_s";
+                case op_basic::i32_ge_u: return u8"i32.ge_u";
+                case op_basic::i64_eqz: return u8"i64.eqz";
+                case op_basic::i64_eq: return u8"i64.eq";
+                case op_basic::i64_ne: return u8"i64.ne";
+                case op_basic::i64_lt_s: return u8"i64.lt_s";
+                case op_basic::i64_lt_u: return u8"i64.lt_u";
+                case op_basic::i64_gt_s: return u8"i64.gt_s";
+                case op_basic::i64_gt_u: return u8"i64.gt_u";
+                case op_basic::i64_le_s: return u8"i64.le_s";
+                case op_basic::i64_le_u: return u8"i64.le_u";
+                case op_basic::i64_ge_s: return u8"i64.ge_s";
+                case op_basic::i64_ge_u: return u8"i64.ge_u";
+                case op_basic::f32_eq: return u8"f32.eq";
+                case op_basic::f32_ne: return u8"f32.ne";
+                case op_basic::f32_lt: return u8"f32.lt";
+                case op_basic::f32_gt: return u8"f32.gt";
+                case op_basic::f32_le: return u8"f32.le";
+                case op_basic::f32_ge: return u8"f32.ge";
+                case op_basic::f64_eq: return u8"f64.eq";
+                case op_basic::f64_ne: return u8"f64.ne";
+                case op_basic::f64_lt: return u8"f64.lt";
+                case op_basic::f64_gt: return u8"f64.gt";
+                case op_basic::f64_le: return u8"f64.le";
+                case op_basic::f64_ge: return u8"f64.ge";
+                case op_basic::i32_clz: return u8"i32.clz";
+                case op_basic::i32_ctz: return u8"i32.ctz";
+                case op_basic::i32_popcnt: return u8"i32.popcnt";
+                case op_basic::i32_add: return u8"i32.add";
+                case op_basic::i32_sub: return u8"i32.sub";
+                case op_basic::i32_mul: return u8"i32.mul";
+                case op_basic::i32_div_s: return u8"i32.div_s";
+                case op_basic::i32_div_u: return u8"i32.div_u";
+                case op_basic::i32_rem_s: return u8"i32.rem_s";
+                case op_basic::i32_rem_u: return u8"i32.rem_u";
+                case op_basic::i32_and: return u8"i32.and";
+                case op_basic::i32_or: return u8"i32.or";
+                case op_basic::i32_xor: return u8"i32.xor";
+                case op_basic::i32_shl: return u8"i32.shl";
+                case op_basic::i32_shr_s: return u8"i32.shr_s";
+                case op_basic::i32_shr_u: return u8"i32.shr_u";
+                case op_basic::i32_rotl: return u8"i32.rotl";
+                case op_basic::i32_rotr: return u8"i32.rotr";
+                case op_basic::i64_clz: return u8"i64.clz";
+                case op_basic::i64_ctz: return u8"i64.ctz";
+                case op_basic::i64_popcnt: return u8"i64.popcnt";
+                case op_basic::i64_add: return u8"i64.add";
+                case op_basic::i64_sub: return u8"i64.sub";
+                case op_basic::i64_mul: return u8"i64.mul";
+                case op_basic::i64_div_s: return u8"i64.div_s";
+                case op_basic::i64_div_u: return u8"i64.div_u";
+                case op_basic::i64_rem_s: return u8"i64.rem_s";
+                case op_basic::i64_rem_u: return u8"i64.rem_u";
+                case op_basic::i64_and: return u8"i64.and";
+                case op_basic::i64_or: return u8"i64.or";
+                case op_basic::i64_xor: return u8"i64.xor";
+                case op_basic::i64_shl: return u8"i64.shl";
+                case op_basic::i64_shr_s: return u8"i64.shr_s";
+                case op_basic::i64_shr_u: return u8"i64.shr_u";
+                case op_basic::i64_rotl: return u8"i64.rotl";
+                case op_basic::i64_rotr: return u8"i64.rotr";
+                case op_basic::f32_abs: return u8"f32.abs";
+                case op_basic::f32_neg: return u8"f32.neg";
+                case op_basic::f32_ceil: return u8"f32.ceil";
+                case op_basic::f32_floor: return u8"f32.floor";
+                case op_basic::f32_trunc: return u8"f32.trunc";
+                case op_basic::f32_nearest: return u8"f32.nearest";
+                case op_basic::f32_sqrt: return u8"f32.sqrt";
+                case op_basic::f32_add: return u8"f32.add";
+                case op_basic::f32_sub: return u8"f32.sub";
+                case op_basic::f32_mul: return u8"f32.mul";
+                case op_basic::f32_div: return u8"f32.div";
+                case op_basic::f32_min: return u8"f32.min";
+                case op_basic::f32_max: return u8"f32.max";
+                case op_basic::f32_copysign: return u8"f32.copysign";
+                case op_basic::f64_abs: return u8"f64.abs";
+                case op_basic::f64_neg: return u8"f64.neg";
+                case op_basic::f64_ceil: return u8"f64.ceil";
+                case op_basic::f64_floor: return u8"f64.floor";
+                case op_basic::f64_trunc: return u8"f64.trunc";
+                case op_basic::f64_nearest: return u8"f64.nearest";
+                case op_basic::f64_sqrt: return u8"f64.sqrt";
+                case op_basic::f64_add: return u8"f64.add";
+                case op_basic::f64_sub: return u8"f64.sub";
+                case op_basic::f64_mul: return u8"f64.mul";
+                case op_basic::f64_div: return u8"f64.div";
+                case op_basic::f64_min: return u8"f64.min";
+                case op_basic::f64_max: return u8"f64.max";
+                case op_basic::f64_copysign: return u8"f64.copysign";
+                case op_basic::i32_wrap_i64: return u8"i32.wrap_i64";
+                case op_basic::i32_trunc_f32_s: return u8"i32.trunc_f32_s";
+                case op_basic::i32_trunc_f32_u: return u8"i32.trunc_f32_u";
+                case op_basic::i32_trunc_f64_s: return u8"i32.trunc_f64_s";
+                case op_basic::i32_trunc_f64_u: return u8"i32.trunc_f64_u";
+                case op_basic::i64_extend_i32_s: return u8"i64.extend_i32_s";
+                case op_basic::i64_extend_i32_u: return u8"i64.extend_i32_u";
+                case op_basic::i64_trunc_f32_s: return u8"i64.trunc_f32_s";
+                case op_basic::i64_trunc_f32_u: return u8"i64.trunc_f32_u";
+                case op_basic::i64_trunc_f64_s: return u8"i64.trunc_f64_s";
+                case op_basic::i64_trunc_f64_u: return u8"i64.trunc_f64_u";
+                case op_basic::f32_convert_i32_s: return u8"f32.convert_i32_s";
+                case op_basic::f32_convert_i32_u: return u8"f32.convert_i32_u";
+                case op_basic::f32_convert_i64_s: return u8"f32.convert_i64_s";
+                case op_basic::f32_convert_i64_u: return u8"f32.convert_i64_u";
+                case op_basic::f32_demote_f64: return u8"f32.demote_f64";
+                case op_basic::f64_convert_i32_s: return u8"f64.convert_i32_s";
+                case op_basic::f64_convert_i32_u: return u8"f64.convert_i32_u";
+                case op_basic::f64_convert_i64_s: return u8"f64.convert_i64_s";
+                case op_basic::f64_convert_i64_u: return u8"f64.convert_i64_u";
+                case op_basic::f64_promote_f32: return u8"f64.promote_f32";
+                case op_basic::i32_reinterpret_f32: return u8"i32.reinterpret_f32";
+                case op_basic::i64_reinterpret_f64: return u8"i64.reinterpret_f64";
+                case op_basic::f32_reinterpret_i32: return u8"f32.reinterpret_i32";
+                case op_basic::f64_reinterpret_i64: return u8"f64.reinterpret_i64";
+                default: return u8"(unknown)";
+            }
+        }
+
+        struct superinst_bigram_t
+        {
+            ::std::uint_least64_t count{};
+            ::std::size_t index{};
+        };
+
+        inline constexpr ::std::size_t superinst_census_bigram_count{16uz};
+    }  // namespace details
+
+    /// @brief      Print the census collected while translating.
+    inline void print_superinst_census() noexcept
+    {
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                            u8"[info]  ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"uwvm-int superinstruction static census of the translated code (fused / candidates, per code site, not per execution):\n");
+
+        for(::std::size_t i{}; i != superinst_kind_count; ++i)
+        {
+            auto const& counter{superinst_census.counters[i]};
+            // Per mille, printed with one decimal.
+            auto const rate{counter.candidates == 0u ? 0u : counter.fused * 1000u / counter.candidates};
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                u8"    ",
+                                ::fast_io::mnp::left(superinst_names[i], 28uz),
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                counter.fused,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" / ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                counter.candidates,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8" (",
+                                rate / 10u,
+                                u8".",
+                                rate % 10u,
+                                u8"%)\n");
+        }
+
+        // Keep the most frequent pairs, sorted by descending count.
+        details::superinst_bigram_t top[details::superinst_census_bigram_count]{};
+        ::std::size_t const bigram_count{superinst_census.bigrams.size()};
+        for(::std::size_t index{}; index != bigram_count; ++index)
+        {
+            auto const count{superinst_census.bigrams.index_unchecked(index)};
+            if(count <= top[details::superinst_census_bigram_count - 1uz].count) { continue; }
+
+            auto pos{details::superinst_census_bigram_count - 1uz};
+            for(; pos != 0uz && top[pos - 1uz].count < count; --pos) { top[pos] = top[pos - 1uz]; }
+            top[pos] = {count, index};
+        }
+
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output, u8"    most frequent opcode pairs:\n");
+        for(auto const& bigram: top)
+        {
+            if(bigram.count == 0u) { break; }
+
+            using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+            auto const first{static_cast<op_basic>(bigram.index / superinst_census_t::opcode_count)};
+            auto const second{static_cast<op_basic>(bigram.index % superinst_census_t::opcode_count)};
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                u8"        ",
+                                details::get_op_basic_name(first),
+                                u8" ",
+                                details::get_op_basic_name(second),
+                                u8": ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                bigram.count,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"\n");
+        }
+
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output, u8"\n", ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -0,0 +1,178 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+#  include <thread>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
+# include "define.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      Calls of a function before it is queued for the tier-up compiler.
+    inline constexpr ::std::uint_least32_t tier_up_call_threshold{1000u};
+
+    /// @brief      Loop header passes (loop entries and back-edges) of a function before it is queued for the tier-up compiler.
+    inline constexpr ::std::uint_least32_t tier_up_loop_threshold{10000u};
+
+    /// @brief      Builds native code for hot functions, installed by a JIT engine before `instantiate`. Tiered execution stays in the interpreter
+    ///             while none is installed.
+    struct tier_up_compiler_t
+    {
+        // Called on the tier-up thread, or concurrently for every function with `llvm_jit_only`. Returns null if the function cannot be compiled,
+        // it then stays interpreted.
+        tier2_code_t const* (*compile)(compiled_function_t const& function) noexcept {};
+    };
+
+    inline tier_up_compiler_t tier_up_compiler{};  // [global]
+
+    namespace details
+    {
+        /// @brief      Hot functions waiting for the tier-up thread.
+        struct tier_up_queue_t
+        {
+            ::uwvm2::utils::mutex::mutex_t mutex{};
+            ::uwvm2::utils::container::vector<compiled_function_t const*> pending{};
+            bool stopping{};
+            // Bumped after `pending` or `stopping` changed, the tier-up thread waits on it.
+            ::std::uint_least32_t signal{};
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+            ::std::thread thread{};
+#endif
+        };
+
+        inline tier_up_queue_t tier_up_queue{};  // [global]
+
+        inline void compile_tier2(compiled_function_t const* function) noexcept
+        {
+            auto const code{tier_up_compiler.compile(*function)};
+            if(code != nullptr) { ::std::atomic_ref<tier2_code_t const*>{function->tier2_code}.store(code, ::std::memory_order_release); }
+            ::std::atomic_ref<tier_up_state>{function->tier_state}.store(code != nullptr ? tier_up_state::compiled : tier_up_state::failed,
+                                                                          ::std::memory_order_relaxed);
+        }
+
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        inline void tier_up_thread_main() noexcept
+        {
+            ::std::atomic_ref<::std::uint_least32_t> const signal{tier_up_queue.signal};
+            ::uwvm2::utils::container::vector<compiled_function_t const*> batch{};
+            for(;;)
+            {
+                // Anything queued after this load bumps `signal` again, so the wait below cannot miss it.
+                auto const seen{signal.load(::std::memory_order_acquire)};
+                {
+                    ::uwvm2::utils::mutex::mutex_guard_t guard{tier_up_queue.mutex};
+                    if(tier_up_queue.stopping) { return; }
+                    batch.swap(tier_up_queue.pending);
+                }
+
+                for(auto const function: batch) { compile_tier2(function); }
+                batch.clear();
+
+                signal.wait(seen, ::std::memory_order_acquire);
+            }
+        }
+
+        inline void signal_tier_up_thread() noexcept
+        {
+            ::std::atomic_ref<::std::uint_least32_t> const signal{tier_up_queue.signal};
+            signal.fetch_add(1u, ::std::memory_order_release);
+            signal.notify_one();
+        }
+#endif
+    }  // namespace details
+
+    /// @brief      Queue a hot function for the tier-up compiler. Only the first request of a function is queued.
+    /// @details    The executing thread goes on interpreting, the next call or loop header pass of the function enters the native code once it is
+    ///             published. Where threads are unavailable the function is compiled right away.
+    UWVM_GNU_COLD inline void request_tier_up(compiled_function_t const* function) noexcept
+    {
+        if(tier_up_compiler.compile == nullptr) { return; }
+
+        auto expected{tier_up_state::interpreted};
+        if(!::std::atomic_ref<tier_up_state>{function->tier_state}.compare_exchange_strong(expected,
+                                                                                             tier_up_state::queued,
+                                                                                             ::std::memory_order_relaxed,
+                                                                                             ::std::memory_order_relaxed))
+        {
+            return;
+        }
+
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        {
+            ::uwvm2::utils::mutex::mutex_guard_t guard{details::tier_up_queue.mutex};
+            details::tier_up_queue.pending.push_back(function);
+        }
+        details::signal_tier_up_thread();
+#else
+        details::compile_tier2(function);
+#endif
+    }
+
+    /// @brief      Start the thread that compiles queued functions, if a tier-up compiler is installed.
+    inline void start_tier_up_thread() noexcept
+    {
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        if(tier_up_compiler.compile == nullptr || details::tier_up_queue.thread.joinable()) { return; }
+        details::tier_up_queue.stopping = false;
+        details::tier_up_queue.thread = ::std::thread{details::tier_up_thread_main};
+#endif
+    }
+
+    /// @brief      Stop the tier-up thread. Functions still queued stay interpreted.
+    inline void stop_tier_up_thread() noexcept
+    {
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        if(!details::tier_up_queue.thread.joinable()) { return; }
+        {
+            ::uwvm2::utils::mutex::mutex_guard_t guard{details::tier_up_queue.mutex};
+            details::tier_up_queue.stopping = true;
+            details::tier_up_queue.pending.clear();
+        }
+        details::signal_tier_up_thread();
+        details::tier_up_queue.thread.join();
+#endif
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
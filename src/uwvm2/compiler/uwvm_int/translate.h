@@ -0,0 +1,1653 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <atomic>
+# include <bit>
+# include <concepts>
+# include <limits>
+# include <memory>
+# include <type_traits>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/opcode/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/utils/memory/impl.h>
+# include <uwvm2/compiler/checker/impl.h>
+# include <uwvm2/compiler/uwvm_int/flags/impl.h>
+# include "define.h"
+# include "memory.h"
+# include "numeric.h"
+# include "handler.h"
+# include "superinst.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    /// @brief      Report a function body that cannot be translated and terminate.
+    /// @note       Bodies are validated by `::uwvm2::compiler::checker` before they are translated. The translator still checks the structural
+    ///             properties it relies on (operand stack height, label/local/global/function indices, immediates) and refuses anything else.
+    [[noreturn]] UWVM_GNU_COLD inline void translate_error(compiled_module_t const& module,
+                                                           ::std::size_t function_index,
+                                                           ::std::size_t offset,
+                                                           ::uwvm2::utils::container::u8string_view message) noexcept
+    {
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                            u8"[fatal] ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"uwvm-int: Cannot translate function ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            function_index,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8" of module \"",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            module.module_name,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"\" (expression offset ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            ::fast_io::mnp::hex0x<true>(offset),
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"): ",
+                            message,
+                            u8".\n\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        ::fast_io::fast_terminate();
+    }
+
+    /// @brief      Set by the first `verification_error`.
+    inline bool verification_error_reported{};  // [global]
+
+    /// @brief      Reject the module whose function body failed verification, reported like the errors of the parser (`error_impl`), and terminate.
+    /// @note       Verification runs on several threads. Only the first failure is reported, threads failing after it wait for the termination.
+    [[noreturn]] UWVM_GNU_COLD inline void verification_error(compiled_module_t const& module,
+                                                              ::std::size_t function_index,
+                                                              ::std::byte const* err_curr,
+                                                              ::uwvm2::utils::container::u8string_view message) noexcept
+    {
+        ::std::atomic_ref<bool> const reported{verification_error_reported};
+        if(reported.exchange(true, ::std::memory_order_acq_rel))
+        {
+            for(;;) { reported.wait(true, ::std::memory_order_acquire); }
+        }
+
+        ::uwvm2::parser::wasm::base::error_output_t errout;
+        errout.module_begin = module.module_begin;
+        errout.err.err_curr = err_curr;
+        errout.err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_function_body;
+        errout.err.err_selectable.invalid_function_body = {message, function_index};
+        errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
+#if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
+        errout.flag.win32_use_text_attr = static_cast<::std::uint_least8_t>(!::uwvm2::uwvm::utils::ansies::log_win32_use_ansi_b);
+#endif
+
+        ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{module.module_begin, err_curr, module.module_end};
+
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            // 1
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                            u8"[error] ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"Verification error in WebAssembly module \"",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            module.module_name,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"\".\n",
+                            // 2
+                            errout,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"\n"
+                            // 3
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                            u8"[info]  ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"Parser Memory Indication: ",
+                            memory_printer,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                            u8"\n\n");
+        ::fast_io::fast_terminate();
+    }
+
+    namespace details
+    {
+        /// @brief      Register form handlers, indexed by `tos_source` of the cached source and whether the result is cached.
+        using register_handler_table_t = op_handler_t[3][2];
+
+        struct numeric_op_info_t
+        {
+            // Stack form.
+            op_handler_t handler{};
+            // Register form, see `register_immediate_t`.
+            register_handler_table_t reg_handlers{};
+            // Superinstructions, null if the op does not take part in them.
+            // `<op>; br_if`, for ops producing an i32. Indexed by `tos_source`.
+            op_handler_t br_if_reg_handlers[3]{};
+            // `i32.const; <op>` and `i32.const; <op>; br_if`, for binary ops on i32. Only `tos_source::none` and `tos_source::src1` are used.
+            register_handler_table_t reg_const_handlers{};
+            op_handler_t br_if_reg_const_handlers[3]{};
+            // Number of operands, every numeric instruction produces exactly one value.
+            unsigned operand_count{};
+        };
+
+        template <typename T, typename R, R (*Fn)(T) noexcept>
+        inline constexpr numeric_op_info_t get_unary_op_info() noexcept
+        {
+            numeric_op_info_t info{};
+            info.handler = &op_unary<T, R, Fn>;
+            info.reg_handlers[0][0] = &op_unary_reg<T, R, Fn, tos_source::none, false>;
+            info.reg_handlers[0][1] = &op_unary_reg<T, R, Fn, tos_source::none, true>;
+            info.reg_handlers[1][0] = &op_unary_reg<T, R, Fn, tos_source::src1, false>;
+            info.reg_handlers[1][1] = &op_unary_reg<T, R, Fn, tos_source::src1, true>;
+            if constexpr(::std::same_as<R, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>)
+            {
+                info.br_if_reg_handlers[0] = &op_br_if_unary_reg<T, Fn, tos_source::none>;
+                info.br_if_reg_handlers[1] = &op_br_if_unary_reg<T, Fn, tos_source::src1>;
+            }
+            info.operand_count = 1u;
+            return info;
+        }
+
+        template <typename T, typename R, R (*Fn)(T, T) noexcept>
+        inline constexpr numeric_op_info_t get_binary_op_info() noexcept
+        {
+            numeric_op_info_t info{};
+            info.handler = &op_binary<T, R, Fn>;
+            info.reg_handlers[0][0] = &op_binary_reg<T, R, Fn, tos_source::none, false>;
+            info.reg_handlers[0][1] = &op_binary_reg<T, R, Fn, tos_source::none, true>;
+            info.reg_handlers[1][0] = &op_binary_reg<T, R, Fn, tos_source::src1, false>;
+            info.reg_handlers[1][1] = &op_binary_reg<T, R, Fn, tos_source::src1, true>;
+            info.reg_handlers[2][0] = &op_binary_reg<T, R, Fn, tos_source::src2, false>;
+            info.reg_handlers[2][1] = &op_binary_reg<T, R, Fn, tos_source::src2, true>;
+            if constexpr(::std::same_as<R, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>)
+            {
+                info.br_if_reg_handlers[0] = &op_br_if_binary_reg<T, Fn, tos_source::none>;
+                info.br_if_reg_handlers[1] = &op_br_if_binary_reg<T, Fn, tos_source::src1>;
+                info.br_if_reg_handlers[2] = &op_br_if_binary_reg<T, Fn, tos_source::src2>;
+            }
+            if constexpr(::std::same_as<T, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>)
+            {
+                info.reg_const_handlers[0][0] = &op_binary_reg_const<R, Fn, tos_source::none, false>;
+                info.reg_const_handlers[0][1] = &op_binary_reg_const<R, Fn, tos_source::none, true>;
+                info.reg_const_handlers[1][0] = &op_binary_reg_const<R, Fn, tos_source::src1, false>;
+                info.reg_const_handlers[1][1] = &op_binary_reg_const<R, Fn, tos_source::src1, true>;
+                if constexpr(::std::same_as<R, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>)
+                {
+                    info.br_if_reg_const_handlers[0] = &op_br_if_binary_reg_const<Fn, tos_source::none>;
+                    info.br_if_reg_const_handlers[1] = &op_br_if_binary_reg_const<Fn, tos_source::src1>;
+                }
+            }
+            info.operand_count = 2u;
+            return info;
+        }
+
+        template <typename T, typename R, R (*Fn)(T) noexcept>
+        inline constexpr numeric_op_info_t unary_op_info{get_unary_op_info<T, R, Fn>()};
+
+        template <typename T, typename R, R (*Fn)(T, T) noexcept>
+        inline constexpr numeric_op_info_t binary_op_info{get_binary_op_info<T, R, Fn>()};
+
+        /// @brief      Handler of a numeric (0x45 ~ 0xbf) instruction, or a null handler for anything else.
+        inline constexpr numeric_op_info_t get_numeric_op_info(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+        {
+            using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+            using i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+            using i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+            using f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+            using f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+            namespace num = ::uwvm2::compiler::uwvm_int::numeric;
+
+            switch(op)
+            {
+                // i32 compare
+                case op_basic::i32_eqz: return unary_op_info<i32, i32, &num::int_eqz<i32>>;
+                case op_basic::i32_eq: return binary_op_info<i32, i32, &num::cmp_eq<i32>>;
+                case op_basic::i32_ne: return binary_op_info<i32, i32, &num::cmp_ne<i32>>;
+                case op_basic::i32_lt_s: return binary_op_info<i32, i32, &num::cmp_lt<i32>>;
+                case op_basic::i32_lt_u: return binary_op_info<i32, i32, &num::cmp_lt_u<i32>>;
+                case op_basic::i32_gt_s: return binary_op_info<i32, i32, &num::cmp_gt<i32>>;
+                case op_basic::i32_gt_u: return binary_op_info<i32, i32, &num::cmp_gt_u<i32>>;
+                case op_basic::i32_le_s: return binary_op_info<i32, i32, &num::cmp_le<i32>>;
+                case op_basic::i32_le_u: return binary_op_info<i32, i32, &num::cmp_le_u<i32>>;
+                case op_basic::i32_ge_s: return binary_op_info<i32, i32, &num::cmp_ge<i32>>;
+                case op_basic::i32_ge_u: return binary_op_info<i32, i32, &num::cmp_ge_u<i32>>;
+                // i64 compare
+                case op_basic::i64_eqz: return unary_op_info<i64, i32, &num::int_eqz<i64>>;
+                case op_basic::i64_eq: return binary_op_info<i64, i32, &num::cmp_eq<i64>>;
+                case op_basic::i64_ne: return binary_op_info<i64, i32, &num::cmp_ne<i64>>;
+                case op_basic::i64_lt_s: return binary_op_info<i64, i32, &num::cmp_lt<i64>>;
+                case op_basic::i64_lt_u: return binary_op_info<i64, i32, &num::cmp_lt_u<i64>>;
+                case op_basic::i64_gt_s: return binary_op_info<i64, i32, &num::cmp_gt<i64>>;
+                case op_basic::i64_gt_u: return binary_op_info<i64, i32, &num::cmp_gt_u<i64>>;
+                case op_basic::i64_le_s: return binary_op_info<i64, i32, &num::cmp_le<i64>>;
+                case op_basic::i64_le_u: return binary_op_info<i64, i32, &num::cmp_le_u<i64>>;
+                case op_basic::i64_ge_s: return binary_op_info<i64, i32, &num::cmp_ge<i64>>;
+                case op_basic::i64_ge_u: return binary_op_info<i64, i32, &num::cmp_ge_u<i64>>;
+                // f32 compare
+                case op_basic::f32_eq: return binary_op_info<f32, i32, &num::cmp_eq<f32>>;
+                case op_basic::f32_ne: return binary_op_info<f32, i32, &num::cmp_ne<f32>>;
+                case op_basic::f32_lt: return binary_op_info<f32, i32, &num::cmp_lt<f32>>;
+                case op_basic::f32_gt: return binary_op_info<f32, i32, &num::cmp_gt<f32>>;
+                case op_basic::f32_le: return binary_op_info<f32, i32, &num::cmp_le<f32>>;
+                case op_basic::f32_ge: return binary_op_info<f32, i32, &num::cmp_ge<f32>>;
+                // f64 compare
+                case op_basic::f64_eq: return binary_op_info<f64, i32, &num::cmp_eq<f64>>;
+                case op_basic::f64_ne: return binary_op_info<f64, i32, &num::cmp_ne<f64>>;
+                case op_basic::f64_lt: return binary_op_info<f64, i32, &num::cmp_lt<f64>>;
+                case op_basic::f64_gt: return binary_op_info<f64, i32, &num::cmp_gt<f64>>;
+                case op_basic::f64_le: return binary_op_info<f64, i32, &num::cmp_le<f64>>;
+                case op_basic::f64_ge: return binary_op_info<f64, i32, &num::cmp_ge<f64>>;
+                // i32 arithmetic
+                case op_basic::i32_clz: return unary_op_info<i32, i32, &num::int_clz<i32>>;
+                case op_basic::i32_ctz: return unary_op_info<i32, i32, &num::int_ctz<i32>>;
+                case op_basic::i32_popcnt: return unary_op_info<i32, i32, &num::int_popcnt<i32>>;
+                case op_basic::i32_add: return binary_op_info<i32, i32, &num::int_add<i32>>;
+                case op_basic::i32_sub: return binary_op_info<i32, i32, &num::int_sub<i32>>;
+                case op_basic::i32_mul: return binary_op_info<i32, i32, &num::int_mul<i32>>;
+                case op_basic::i32_div_s: return binary_op_info<i32, i32, &num::int_div_s<i32>>;
+                case op_basic::i32_div_u: return binary_op_info<i32, i32, &num::int_div_u<i32>>;
+                case op_basic::i32_rem_s: return binary_op_info<i32, i32, &num::int_rem_s<i32>>;
+                case op_basic::i32_rem_u: return binary_op_info<i32, i32, &num::int_rem_u<i32>>;
+                case op_basic::i32_and: return binary_op_info<i32, i32, &num::int_and<i32>>;
+                case op_basic::i32_or: return binary_op_info<i32, i32, &num::int_or<i32>>;
+                case op_basic::i32_xor: return binary_op_info<i32, i32, &num::int_xor<i32>>;
+                case op_basic::i32_shl: return binary_op_info<i32, i32, &num::int_shl<i32>>;
+                case op_basic::i32_shr_s: return binary_op_info<i32, i32, &num::int_shr_s<i32>>;
+                case op_basic::i32_shr_u: return binary_op_info<i32, i32, &num::int_shr_u<i32>>;
+                case op_basic::i32_rotl: return binary_op_info<i32, i32, &num::int_rotl<i32>>;
+                case op_basic::i32_rotr: return binary_op_info<i32, i32, &num::int_rotr<i32>>;
+                // i64 arithmetic
+                case op_basic::i64_clz: return unary_op_info<i64, i64, &num::int_clz<i64>>;
+                case op_basic::i64_ctz: return unary_op_info<i64, i64, &num::int_ctz<i64>>;
+                case op_basic::i64_popcnt: return unary_op_info<i64, i64, &num::int_popcnt<i64>>;
+                case op_basic::i64_add: return binary_op_info<i64, i64, &num::int_add<i64>>;
+                case op_basic::i64_sub: return binary_op_info<i64, i64, &num::int_sub<i64>>;
+                case op_basic::i64_mul: return binary_op_info<i64, i64, &num::int_mul<i64>>;
+                case op_basic::i64_div_s: return binary_op_info<i64, i64, &num::int_div_s<i64>>;
+                case op_basic::i64_div_u: return binary_op_info<i64, i64, &num::int_div_u<i64>>;
+                case op_basic::i64_rem_s: return binary_op_info<i64, i64, &num::int_rem_s<i64>>;
+                case op_basic::i64_rem_u: return binary_op_info<i64, i64, &num::int_rem_u<i64>>;
+                case op_basic::i64_and: return binary_op_info<i64, i64, &num::int_and<i64>>;
+                case op_basic::i64_or: return binary_op_info<i64, i64, &num::int_or<i64>>;
+                case op_basic::i64_xor: return binary_op_info<i64, i64, &num::int_xor<i64>>;
+                case op_basic::i64_shl: return binary_op_info<i64, i64, &num::int_shl<i64>>;
+                case op_basic::i64_shr_s: return binary_op_info<i64, i64, &num::int_shr_s<i64>>;
+                case op_basic::i64_shr_u: return binary_op_info<i64, i64, &num::int_shr_u<i64>>;
+                case op_basic::i64_rotl: return binary_op_info<i64, i64, &num::int_rotl<i64>>;
+                case op_basic::i64_rotr: return binary_op_info<i64, i64, &num::int_rotr<i64>>;
+                // f32 arithmetic
+                case op_basic::f32_abs: return unary_op_info<f32, f32, &num::float_abs<f32>>;
+                case op_basic::f32_neg: return unary_op_info<f32, f32, &num::float_neg<f32>>;
+                case op_basic::f32_ceil: return unary_op_info<f32, f32, &num::float_ceil<f32>>;
+                case op_basic::f32_floor: return unary_op_info<f32, f32, &num::float_floor<f32>>;
+                case op_basic::f32_trunc: return unary_op_info<f32, f32, &num::float_trunc<f32>>;
+                case op_basic::f32_nearest: return unary_op_info<f32, f32, &num::float_nearest<f32>>;
+                case op_basic::f32_sqrt: return unary_op_info<f32, f32, &num::float_sqrt<f32>>;
+                case op_basic::f32_add: return binary_op_info<f32, f32, &num::float_add<f32>>;
+                case op_basic::f32_sub: return binary_op_info<f32, f32, &num::float_sub<f32>>;
+                case op_basic::f32_mul: return binary_op_info<f32, f32, &num::float_mul<f32>>;
+                case op_basic::f32_div: return binary_op_info<f32, f32, &num::float_div<f32>>;
+                case op_basic::f32_min: return binary_op_info<f32, f32, &num::float_min<f32>>;
+                case op_basic::f32_max: return binary_op_info<f32, f32, &num::float_max<f32>>;
+                case op_basic::f32_copysign: return binary_op_info<f32, f32, &num::float_copysign<f32>>;
+                // f64 arithmetic
+                case op_basic::f64_abs: return unary_op_info<f64, f64, &num::float_abs<f64>>;
+                case op_basic::f64_neg: return unary_op_info<f64, f64, &num::float_neg<f64>>;
+                case op_basic::f64_ceil: return unary_op_info<f64, f64, &num::float_ceil<f64>>;
+                case op_basic::f64_floor: return unary_op_info<f64, f64, &num::float_floor<f64>>;
+                case op_basic::f64_trunc: return unary_op_info<f64, f64, &num::float_trunc<f64>>;
+                case op_basic::f64_nearest: return unary_op_info<f64, f64, &num::float_nearest<f64>>;
+                case op_basic::f64_sqrt: return unary_op_info<f64, f64, &num::float_sqrt<f64>>;
+                case op_basic::f64_add: return binary_op_info<f64, f64, &num::float_add<f64>>;
+                case op_basic::f64_sub: return binary_op_info<f64, f64, &num::float_sub<f64>>;
+                case op_basic::f64_mul: return binary_op_info<f64, f64, &num::float_mul<f64>>;
+                case op_basic::f64_div: return binary_op_info<f64, f64, &num::float_div<f64>>;
+                case op_basic::f64_min: return binary_op_info<f64, f64, &num::float_min<f64>>;
+                case op_basic::f64_max: return binary_op_info<f64, f64, &num::float_max<f64>>;
+                case op_basic::f64_copysign: return binary_op_info<f64, f64, &num::float_copysign<f64>>;
+                // conversion
+                case op_basic::i32_wrap_i64: return unary_op_info<i64, i32, &num::i32_wrap_i64>;
+                case op_basic::i32_trunc_f32_s: return unary_op_info<f32, i32, &num::trunc_s<i32, f32>>;
+                case op_basic::i32_trunc_f32_u: return unary_op_info<f32, i32, &num::trunc_u<i32, f32>>;
+                case op_basic::i32_trunc_f64_s: return unary_op_info<f64, i32, &num::trunc_s<i32, f64>>;
+                case op_basic::i32_trunc_f64_u: return unary_op_info<f64, i32, &num::trunc_u<i32, f64>>;
+                case op_basic::i64_extend_i32_s: return unary_op_info<i32, i64, &num::i64_extend_i32_s>;
+                case op_basic::i64_extend_i32_u: return unary_op_info<i32, i64, &num::i64_extend_i32_u>;
+                case op_basic::i64_trunc_f32_s: return unary_op_info<f32, i64, &num::trunc_s<i64, f32>>;
+                case op_basic::i64_trunc_f32_u: return unary_op_info<f32, i64, &num::trunc_u<i64, f32>>;
+                case op_basic::i64_trunc_f64_s: return unary_op_info<f64, i64, &num::trunc_s<i64, f64>>;
+                case op_basic::i64_trunc_f64_u: return unary_op_info<f64, i64, &num::trunc_u<i64, f64>>;
+                case op_basic::f32_convert_i32_s: return unary_op_info<i32, f32, &num::convert_s<f32, i32>>;
+                case op_basic::f32_convert_i32_u: return unary_op_info<i32, f32, &num::convert_u<f32, i32>>;
+                case op_basic::f32_convert_i64_s: return unary_op_info<i64, f32, &num::convert_s<f32, i64>>;
+                case op_basic::f32_convert_i64_u: return unary_op_info<i64, f32, &num::convert_u<f32, i64>>;
+                case op_basic::f32_demote_f64: return unary_op_info<f64, f32, &num::f32_demote_f64>;
+                case op_basic::f64_convert_i32_s: return unary_op_info<i32, f64, &num::convert_s<f64, i32>>;
+                case op_basic::f64_convert_i32_u: return unary_op_info<i32, f64, &num::convert_u<f64, i32>>;
+                case op_basic::f64_convert_i64_s: return unary_op_info<i64, f64, &num::convert_s<f64, i64>>;
+                case op_basic::f64_convert_i64_u: return unary_op_info<i64, f64, &num::convert_u<f64, i64>>;
+                case op_basic::f64_promote_f32: return unary_op_info<f32, f64, &num::f64_promote_f32>;
+                case op_basic::i32_reinterpret_f32: return unary_op_info<f32, i32, &num::reinterpret<i32, f32>>;
+                case op_basic::i64_reinterpret_f64: return unary_op_info<f64, i64, &num::reinterpret<i64, f64>>;
+                case op_basic::f32_reinterpret_i32: return unary_op_info<i32, f32, &num::reinterpret<f32, i32>>;
+                case op_basic::f64_reinterpret_i64: return unary_op_info<i64, f64, &num::reinterpret<f64, i64>>;
+                default: return {};
+            }
+        }
+
+        enum class control_frame_kind : unsigned
+        {
+            function,
+            block,
+            loop,
+            if_,
+            else_
+        };
+
+        /// @brief      A branch target that is patched once its destination is known: either `op_t::imm.branch` of an op or a `br_table` entry.
+        struct branch_slot_t
+        {
+            ::std::size_t index{};
+            bool in_br_table{};
+        };
+
+        struct resolved_branch_t
+        {
+            branch_slot_t slot{};
+            ::std::size_t target_op_index{};
+        };
+
+        struct br_table_fixup_t
+        {
+            ::std::size_t op_index{};
+            ::std::size_t first_target_index{};
+        };
+
+        /// @brief      Branch targets of a translated body that are still op indices, see `link_function`.
+        struct function_links_t
+        {
+            ::uwvm2::utils::container::vector<resolved_branch_t> resolved_branches{};
+            ::uwvm2::utils::container::vector<br_table_fixup_t> br_table_fixups{};
+        };
+
+        /// @brief      Turn the op indices of `links` into pointers into `ops` and `br_table_targets`, wherever the body ends up living.
+        inline void link_function(function_links_t const& links, op_t* ops, branch_target_t* br_table_targets) noexcept
+        {
+            for(auto const& resolved: links.resolved_branches)
+            {
+                if(resolved.slot.in_br_table) { br_table_targets[resolved.slot.index].target = ops + resolved.target_op_index; }
+                else
+                {
+                    ops[resolved.slot.index].imm.branch.target = ops + resolved.target_op_index;
+                }
+            }
+            for(auto const& fixup: links.br_table_fixups) { ops[fixup.op_index].imm.br_table.targets = br_table_targets + fixup.first_target_index; }
+        }
+
+        struct control_frame_t
+        {
+            // Forward branches to the end of this frame.
+            ::uwvm2::utils::container::vector<branch_slot_t> end_fixups{};
+            // The conditional jump of an `if` that has not met its `else` yet.
+            branch_slot_t if_slot{};
+            // Operand stack height when the frame was entered.
+            ::std::size_t entry_height{};
+            ::std::size_t loop_begin{};
+            ::std::uint_least32_t result_arity{};
+            // Entry of the frame in `function_side_table_t::blocks`, unused for the function frame.
+            ::std::size_t block_index{};
+            control_frame_kind kind{};
+            // The rest of the frame is dead code (after br, br_table, return or unreachable).
+            bool unreachable{};
+        };
+
+        using wasm_byte_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte const*;
+
+        /// @brief      One-pass translation of a wasm1 function body into `op_t`.
+        /// @details    Branch targets are recorded as op indices while `ops` can still reallocate and are turned into pointers once the body is complete.
+        struct function_translator_t
+        {
+            compiled_module_t& module;
+            compiled_function_t& function;
+            ::std::size_t function_index;
+
+            wasm_byte_const_may_alias_ptr expr_begin;
+            wasm_byte_const_may_alias_ptr curr;
+            wasm_byte_const_may_alias_ptr end;
+            wasm_byte_const_may_alias_ptr op_begin{};
+
+            ::uwvm2::utils::container::vector<control_frame_t> frames{};
+            function_links_t links{};
+            // Leave `links` to the caller, which moves the body somewhere else before linking it.
+            bool defer_link{};
+            // What the validator found out about the body.
+            ::uwvm2::compiler::checker::function_side_table_t const* side_table{};
+
+            ::std::size_t height{};
+            ::std::size_t max_height{};
+            // Next entry of `function_side_table_t::blocks`, blocks are numbered in the order they are opened.
+            ::std::size_t next_block{};
+
+            inline static constexpr ::std::size_t no_op_index{::std::numeric_limits<::std::size_t>::max()};
+
+            // `local.get`s that have not been pushed yet. They are always the top (at most two) values of the operand stack and `height` counts
+            // them. Register ops read them straight from their locals, any other instruction materializes them first.
+            ::uwvm2::utils::container::vector<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32> pending_locals{};
+            // Register op emitted by the previous instruction, its result is the top of the operand stack.
+            ::std::size_t last_register_op{no_op_index};
+            // Register op whose result is kept in the cached top-of-stack register instead of its slot, see `tos_int_t`. It is the topmost
+            // materialized value and sits at operand stack position `cache_position`.
+            ::std::size_t cache_op{no_op_index};
+            ::std::size_t cache_position{};
+            // Variant of `cache_op` that writes its result to `register_immediate_t::dst`.
+            op_handler_t cache_slot_handler{};
+            // `br_if` superinstruction that `cache_op` can be turned into, if any.
+            op_handler_t cache_br_if_handler{};
+            // Whether every slot index of the function fits into `register_immediate_t`.
+            bool use_register_ops{};
+            // Reachable `loop` instructions translated so far, numbers the loop headers of tiered execution.
+            ::std::uint_least32_t loop_count{};
+
+            // Superinstruction census (`flags::show_superinst_census`).
+            bool collect_census{};
+            bool has_previous_op{};
+            ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic previous_op{};
+
+            [[noreturn]] inline void fail(::uwvm2::utils::container::u8string_view message) const noexcept
+            {
+                if(module.report_verification_errors)
+                {
+                    ::uwvm2::compiler::uwvm_int::verification_error(module, function_index, reinterpret_cast<::std::byte const*>(op_begin), message);
+                }
+                ::uwvm2::compiler::uwvm_int::translate_error(module, function_index, static_cast<::std::size_t>(op_begin - expr_begin), message);
+            }
+
+            inline ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte read_byte() noexcept
+            {
+                if(curr == end) [[unlikely]] { fail(u8"unexpected end of the function body"); }
+                return *curr++;
+            }
+
+            template <typename T>
+            inline T read_leb128() noexcept
+            {
+                using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+                T v;  // No initialization necessary
+                auto const [next, err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                ::fast_io::mnp::leb128_get(v))};
+                if(err != ::fast_io::parse_code::ok) [[unlikely]] { fail(u8"invalid LEB128 immediate"); }
+                curr = reinterpret_cast<wasm_byte_const_may_alias_ptr>(next);
+                return v;
+            }
+
+            template <typename F>
+            inline F read_float() noexcept
+            {
+                using bits_t = ::std::conditional_t<sizeof(F) == 4uz, ::std::uint_least32_t, ::std::uint_least64_t>;
+                if(static_cast<::std::size_t>(end - curr) < sizeof(bits_t)) [[unlikely]] { fail(u8"unexpected end of the function body"); }
+                bits_t bits;  // No initialization necessary
+                ::std::memcpy(::std::addressof(bits), curr, sizeof(bits_t));
+                curr += sizeof(bits_t);
+                return ::std::bit_cast<F>(::fast_io::little_endian(bits));
+            }
+
+            /// @brief      wasm1 block types are either empty (0x40) or a single value type.
+            inline ::std::uint_least32_t read_block_arity() noexcept
+            {
+                using value_type = ::uwvm2::parser::wasm::standard::wasm1::type::value_type;
+                using wasm_byte = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte;
+
+                switch(read_byte())
+                {
+                    case static_cast<wasm_byte>(0x40u):
+                    {
+                        return 0u;
+                    }
+                    case static_cast<wasm_byte>(value_type::i32): [[fallthrough]];
+                    case static_cast<wasm_byte>(value_type::i64): [[fallthrough]];
+                    case static_cast<wasm_byte>(value_type::f32): [[fallthrough]];
+                    case static_cast<wasm_byte>(value_type::f64):
+                    {
+                        return 1u;
+                    }
+                    [[unlikely]] default:
+                    {
+                        fail(u8"invalid block type");
+                    }
+                }
+            }
+
+            inline void read_reserved_zero_byte() noexcept
+            {
+                if(read_byte() != 0u) [[unlikely]] { fail(u8"reserved byte must be zero"); }
+            }
+
+            inline void pop(::std::size_t n) noexcept
+            {
+                if(height - frames.back_unchecked().entry_height < n) [[unlikely]] { fail(u8"operand stack underflow"); }
+                height -= n;
+            }
+
+            inline void push(::std::size_t n) noexcept
+            {
+                height += n;
+                if(height > max_height) { max_height = height; }
+            }
+
+            inline ::std::size_t emit(op_handler_t handler) noexcept
+            {
+                auto const index{function.ops.size()};
+                function.ops.push_back(op_t{});
+                function.ops.back_unchecked().handler = handler;
+                return index;
+            }
+
+            inline void count_superinst(superinst_kind kind, bool fused) noexcept
+            {
+                if(!collect_census) { return; }
+                superinst_census.record_candidate(kind);
+                if(fused) { superinst_census.record_fused(kind); }
+            }
+
+            inline void count_opcode(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+            {
+                if(!collect_census) { return; }
+                if(has_previous_op) { superinst_census.record_bigram(previous_op, op); }
+                previous_op = op;
+                has_previous_op = true;
+            }
+
+            /// @brief      Whether `op` can use pending `local.get`s directly; everything else needs them pushed first.
+            inline static constexpr bool can_use_pending_locals(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+                switch(op)
+                {
+                    case op_basic::local_get: [[fallthrough]];
+                    case op_basic::local_set: [[fallthrough]];
+                    case op_basic::local_tee: [[fallthrough]];
+                    case op_basic::drop: [[fallthrough]];
+                    case op_basic::br_if: [[fallthrough]];
+                    case op_basic::i32_const: return true;
+                    default:
+                    {
+                        // loads and numeric instructions
+                        return (op >= op_basic::i32_load && op <= op_basic::i64_load32_u) || (op >= op_basic::i32_eqz && op <= op_basic::f64_reinterpret_i64);
+                    }
+                }
+            }
+
+            /// @brief      Push all pending `local.get`s except the top `keep` ones, which stay pending.
+            inline void flush_pending_locals(::std::size_t keep) noexcept
+            {
+                auto const pending_count{pending_locals.size()};
+                if(pending_count <= keep) { return; }
+
+                auto const flush_count{pending_count - keep};
+                for(::std::size_t i{}; i != flush_count; ++i)
+                {
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_local_get)).imm.index = pending_locals.index_unchecked(i);
+                }
+                for(::std::size_t i{}; i != keep; ++i) { pending_locals.index_unchecked(i) = pending_locals.index_unchecked(flush_count + i); }
+                pending_locals.resize(keep);
+            }
+
+            /// @brief      Slot index of the operand stack value at `position` (counted from the bottom of the function's operand stack).
+            inline ::std::uint_least32_t get_stack_slot(::std::size_t position) const noexcept
+            { return static_cast<::std::uint_least32_t>(function.local_count + position); }
+
+            /// @brief      Whether `op` leaves the cached top-of-stack value alone or handles it itself; everything else needs it in its slot.
+            inline static constexpr bool can_keep_cached_top(::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic op) noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+                switch(op)
+                {
+                    case op_basic::nop: [[fallthrough]];
+                    case op_basic::local_get: [[fallthrough]];
+                    case op_basic::local_set: [[fallthrough]];
+                    case op_basic::local_tee: [[fallthrough]];
+                    case op_basic::br_if: [[fallthrough]];
+                    case op_basic::i32_const: [[fallthrough]];
+                    case op_basic::i64_const: [[fallthrough]];
+                    case op_basic::f32_const: [[fallthrough]];
+                    case op_basic::f64_const: return true;
+                    default:
+                    {
+                        // numeric instructions
+                        return op >= op_basic::i32_eqz && op <= op_basic::f64_reinterpret_i64;
+                    }
+                }
+            }
+
+            /// @brief      Make the cached top-of-stack value live in its slot.
+            /// @details    Nothing after `cache_op` has read the slot yet, so the producer is simply switched to its slot-writing variant.
+            inline void spill_cached_top() noexcept
+            {
+                if(cache_op == no_op_index) { return; }
+                function.ops.index_unchecked(cache_op).handler = cache_slot_handler;
+                cache_op = no_op_index;
+            }
+
+            /// @brief      Pick the variant of a register op whose operands are the materialized stack values from `first` on (`count` of them).
+            /// @details    The result goes to the cache, a cached value that is not one of the operands is spilled first.
+            inline tos_source take_cached_operand(::std::size_t first, ::std::size_t count) noexcept
+            {
+                if(cache_op == no_op_index) { return tos_source::none; }
+                if(cache_position < first || cache_position - first >= count)
+                {
+                    spill_cached_top();
+                    return tos_source::none;
+                }
+                auto const source{cache_position == first ? tos_source::src1 : tos_source::src2};
+                cache_op = no_op_index;
+                return source;
+            }
+
+            inline void set_cached_top(::std::size_t index,
+                                       ::std::size_t position,
+                                       register_handler_table_t const& handlers,
+                                       op_handler_t const (&br_if_handlers)[3],
+                                       tos_source source) noexcept
+            {
+                auto const source_index{static_cast<::std::size_t>(source)};
+                function.ops.index_unchecked(index).handler = handlers[source_index][1];
+                cache_op = index;
+                cache_position = position;
+                cache_slot_handler = handlers[source_index][0];
+                cache_br_if_handler = br_if_handlers[source_index];
+            }
+
+            /// @brief      Emit the register form of a numeric instruction.
+            /// @details    Operands that are still pending are read from their locals, the others from their operand stack slots or the cached
+            ///             top-of-stack register. The result is cached; its slot is the one of the first operand, unless the next instruction is
+            ///             a `local.set`/`local.tee` that retargets it.
+            inline void emit_register_numeric(numeric_op_info_t const& info) noexcept
+            {
+                ::std::size_t const operand_count{info.operand_count};
+                flush_pending_locals(operand_count);
+                auto const pending_count{pending_locals.size()};
+
+                pop(operand_count);
+                auto const first{height};
+                auto const get_operand_slot{[&](::std::size_t k) noexcept -> ::std::uint_least32_t
+                                            {
+                                                // The top `pending_count` operands are pending.
+                                                auto const first_pending{operand_count - pending_count};
+                                                if(k >= first_pending) { return pending_locals.index_unchecked(k - first_pending); }
+                                                return get_stack_slot(first + k);
+                                            }};
+
+                register_immediate_t reg{};
+                reg.src1 = get_operand_slot(0uz);
+                if(operand_count == 2uz) { reg.src2 = get_operand_slot(1uz); }
+                reg.dst = get_stack_slot(first);
+                // Materialized height goes from `first + operand_count - pending_count` to `first + 1`.
+                reg.sp_delta = static_cast<::std::int_least32_t>(1 + static_cast<::std::int_least32_t>(pending_count) -
+                                                                  static_cast<::std::int_least32_t>(operand_count));
+                pending_locals.clear();
+
+                auto const source{take_cached_operand(first, operand_count - pending_count)};
+                auto const index{emit(nullptr)};
+                function.ops.index_unchecked(index).imm.reg = reg;
+                set_cached_top(index, first, info.reg_handlers, info.br_if_reg_handlers, source);
+                push(1uz);
+                last_register_op = index;
+            }
+
+            /// @brief      Emit `i32.const k; <op>` as one register op, the left operand is the top of the operand stack.
+            inline void emit_register_const(numeric_op_info_t const& info, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32 k) noexcept
+            {
+                flush_pending_locals(1uz);
+                auto const pending_count{pending_locals.size()};
+
+                pop(1uz);
+                auto const first{height};
+
+                register_immediate_t reg{};
+                reg.src1 = pending_count == 0uz ? get_stack_slot(first) : static_cast<::std::uint_least32_t>(pending_locals.front_unchecked());
+                reg.src2 = static_cast<::std::uint_least32_t>(k);
+                reg.dst = get_stack_slot(first);
+                reg.sp_delta = static_cast<::std::int_least32_t>(pending_count);
+                pending_locals.clear();
+
+                auto const source{take_cached_operand(first, 1uz - pending_count)};
+                auto const index{emit(nullptr)};
+                function.ops.index_unchecked(index).imm.reg = reg;
+                set_cached_top(index, first, info.reg_const_handlers, info.br_if_reg_const_handlers, source);
+                push(1uz);
+                last_register_op = index;
+            }
+
+            /// @brief      Emit the op that holds the branch of a `br_if` superinstruction.
+            inline void emit_br_if_extension(control_frame_t& label) noexcept
+            {
+                auto const branch{make_branch(label)};
+                auto const index{emit(::uwvm2::compiler::uwvm_int::op_immediate_extension)};
+                function.ops.index_unchecked(index).imm.branch = branch;
+                link_branch(label, {index, false});
+            }
+
+            /// @return     Whether the `br_if` has been fused with the instruction before it; the condition has been popped.
+            inline bool try_emit_br_if_superinst(control_frame_t& label, ::std::size_t producer) noexcept
+            {
+                if(producer != no_op_index && producer == cache_op && cache_br_if_handler != nullptr)
+                {
+                    // The producer evaluates the condition itself instead of pushing it.
+                    pop(1uz);
+                    cache_op = no_op_index;
+                    auto& producer_op{function.ops.index_unchecked(producer)};
+                    producer_op.handler = cache_br_if_handler;
+                    --producer_op.imm.reg.sp_delta;
+                    emit_br_if_extension(label);
+                    count_superinst(superinst_kind::br_if_reg, true);
+                    count_superinst(superinst_kind::br_if_local, false);
+                    return true;
+                }
+
+                // The branch target reads the operand stack from the slots.
+                spill_cached_top();
+
+                if(!pending_locals.empty())
+                {
+                    flush_pending_locals(1uz);
+                    pop(1uz);
+                    auto const local{pending_locals.back_unchecked()};
+                    pending_locals.clear();
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_br_if_local)).imm.index = local;
+                    emit_br_if_extension(label);
+                    count_superinst(superinst_kind::br_if_reg, false);
+                    count_superinst(superinst_kind::br_if_local, true);
+                    return true;
+                }
+
+                count_superinst(superinst_kind::br_if_reg, false);
+                count_superinst(superinst_kind::br_if_local, false);
+                return false;
+            }
+
+            /// @brief      Store the top of the operand stack into local `index` without a separate op, if possible.
+            /// @param      producer    Register op emitted by the previous instruction, or `no_op_index`.
+            /// @return     Whether the store has been handled; the value has been popped.
+            inline bool try_forward_to_local(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index, ::std::size_t producer) noexcept
+            {
+                if(!use_register_ops) { return false; }
+
+                if(producer != no_op_index && producer == cache_op)
+                {
+                    // Nothing can branch between the producer and this instruction, so it can write the local directly.
+                    pop(1uz);
+                    cache_op = no_op_index;
+                    auto& producer_op{function.ops.index_unchecked(producer)};
+                    producer_op.handler = cache_slot_handler;
+                    auto& reg{producer_op.imm.reg};
+                    reg.dst = static_cast<::std::uint_least32_t>(index);
+                    --reg.sp_delta;
+                    return true;
+                }
+
+                if(!pending_locals.empty())
+                {
+                    // Older pending values must be read before the local changes.
+                    flush_pending_locals(1uz);
+                    pop(1uz);
+                    auto const src{pending_locals.back_unchecked()};
+                    pending_locals.clear();
+                    if(src != index)
+                    {
+                        auto const op_index{emit(::uwvm2::compiler::uwvm_int::op_copy_reg)};
+                        function.ops.index_unchecked(op_index).imm.reg = {static_cast<::std::uint_least32_t>(src),
+                                                                          0u,
+                                                                          static_cast<::std::uint_least32_t>(index),
+                                                                          0};
+                    }
+                    return true;
+                }
+
+                // The stack form reads the value from its slot.
+                spill_cached_top();
+                return false;
+            }
+
+            inline void push_frame(control_frame_kind kind, ::std::uint_least32_t result_arity, branch_slot_t if_slot) noexcept
+            {
+                control_frame_t frame{};
+                frame.if_slot = if_slot;
+                frame.entry_height = height;
+                frame.loop_begin = function.ops.size();
+                frame.result_arity = result_arity;
+                frame.kind = kind;
+                if(kind != control_frame_kind::function) { frame.block_index = next_block++; }
+                frames.push_back(::std::move(frame));
+            }
+
+            /// @brief      Everything up to the matching `else`/`end` is dead; the operand stack becomes polymorphic.
+            /// @details    The validator has recorded where that `else`/`end` is, so the dead code is skipped without decoding it again and the blocks
+            ///             opened inside it never get a frame.
+            inline void set_unreachable() noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                frame.unreachable = true;
+                height = frame.entry_height;
+
+                auto const& blocks{side_table->blocks};
+                ::std::size_t resume;  // No initialization necessary
+                if(frame.kind == control_frame_kind::function)
+                {
+                    // A validated body ends with the `end` of the function.
+                    resume = static_cast<::std::size_t>(end - expr_begin) - 1uz;
+                }
+                else
+                {
+                    auto const& block{blocks.index_unchecked(frame.block_index)};
+                    bool const has_else{frame.kind == control_frame_kind::if_ && block.else_ != ::uwvm2::compiler::checker::block_entry_t::no_else};
+                    resume = has_else ? block.else_ : block.end;
+                }
+
+                curr = expr_begin + resume;
+                while(next_block != blocks.size() && blocks.index_unchecked(next_block).begin < resume) { ++next_block; }
+            }
+
+            inline control_frame_t& get_label(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 depth) noexcept
+            {
+                if(static_cast<::std::size_t>(depth) >= frames.size()) [[unlikely]] { fail(u8"invalid label index"); }
+                return frames.index_unchecked(frames.size() - 1uz - static_cast<::std::size_t>(depth));
+            }
+
+            inline branch_target_t make_branch(control_frame_t const& label) noexcept
+            {
+                // A loop label takes no values in wasm1.
+                ::std::uint_least32_t const arity{label.kind == control_frame_kind::loop ? 0u : label.result_arity};
+                if(height < label.entry_height + arity) [[unlikely]] { fail(u8"operand stack underflow"); }
+                return {nullptr, static_cast<::std::uint_least32_t>(height - arity - label.entry_height), arity};
+            }
+
+            inline void link_branch(control_frame_t& label, branch_slot_t slot) noexcept
+            {
+                if(label.kind == control_frame_kind::loop) { links.resolved_branches.push_back({slot, label.loop_begin}); }
+                else
+                {
+                    label.end_fixups.push_back(slot);
+                }
+            }
+
+            inline void emit_return() noexcept
+            {
+                switch(function.result_count)
+                {
+                    case 0uz:
+                    {
+                        emit(::uwvm2::compiler::uwvm_int::op_return_0);
+                        break;
+                    }
+                    case 1uz:
+                    {
+                        if(height == frames.back_unchecked().entry_height) [[unlikely]] { fail(u8"operand stack underflow"); }
+                        emit(::uwvm2::compiler::uwvm_int::op_return_1);
+                        break;
+                    }
+                    [[unlikely]] default:
+                    {
+                        fail(u8"multiple results are not supported");
+                    }
+                }
+            }
+
+            inline void require_memory() noexcept
+            {
+                if(!module.has_memory) [[unlikely]] { fail(u8"memory instruction in a module without memory"); }
+            }
+
+            template <typename MemT, typename ResT>
+            inline void emit_load() noexcept
+            {
+                require_memory();
+                [[maybe_unused]] auto const align{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                auto const offset{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+
+                if(!pending_locals.empty())
+                {
+                    // `local.get; *.load`
+                    flush_pending_locals(1uz);
+                    pop(1uz);
+                    auto const local{pending_locals.back_unchecked()};
+                    pending_locals.clear();
+                    op_handler_t handler{&::uwvm2::compiler::uwvm_int::op_load_local<native_memory_accessor, MemT, ResT>};
+                    if(module.memory.native_memory == nullptr)
+                    {
+                        handler = &::uwvm2::compiler::uwvm_int::op_load_local<local_imported_memory_accessor, MemT, ResT>;
+                    }
+                    else if(module.memory.elide_bounds_checks)
+                    {
+                        handler = &::uwvm2::compiler::uwvm_int::op_load_local<guarded_native_memory_accessor, MemT, ResT>;
+                    }
+                    auto const index{emit(handler)};
+                    function.ops.index_unchecked(index).imm.local_memarg = {::std::addressof(module.memory), offset, local};
+                    push(1uz);
+                    count_superinst(superinst_kind::load_local, true);
+                    return;
+                }
+
+                count_superinst(superinst_kind::load_local, false);
+                pop(1uz);
+                op_handler_t handler{&::uwvm2::compiler::uwvm_int::op_load<native_memory_accessor, MemT, ResT>};
+                if(module.memory.native_memory == nullptr) { handler = &::uwvm2::compiler::uwvm_int::op_load<local_imported_memory_accessor, MemT, ResT>; }
+                else if(module.memory.elide_bounds_checks) { handler = &::uwvm2::compiler::uwvm_int::op_load<guarded_native_memory_accessor, MemT, ResT>; }
+                auto const index{emit(handler)};
+                function.ops.index_unchecked(index).imm.memarg = {::std::addressof(module.memory), offset};
+                push(1uz);
+            }
+
+            template <typename ValT, typename MemT>
+            inline void emit_store() noexcept
+            {
+                require_memory();
+                [[maybe_unused]] auto const align{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                auto const offset{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                pop(2uz);
+                op_handler_t handler{&::uwvm2::compiler::uwvm_int::op_store<native_memory_accessor, ValT, MemT>};
+                if(module.memory.native_memory == nullptr) { handler = &::uwvm2::compiler::uwvm_int::op_store<local_imported_memory_accessor, ValT, MemT>; }
+                else if(module.memory.elide_bounds_checks) { handler = &::uwvm2::compiler::uwvm_int::op_store<guarded_native_memory_accessor, ValT, MemT>; }
+                auto const index{emit(handler)};
+                function.ops.index_unchecked(index).imm.memarg = {::std::addressof(module.memory), offset};
+            }
+
+            template <typename T>
+            inline void emit_const(T v) noexcept
+            {
+                auto& imm{function.ops.index_unchecked(emit(&::uwvm2::compiler::uwvm_int::op_const<T>)).imm};
+                if constexpr(::std::same_as<T, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>) { imm.i32 = v; }
+                else if constexpr(::std::same_as<T, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64>) { imm.i64 = v; }
+                else if constexpr(::std::same_as<T, ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32>) { imm.f32 = v; }
+                else
+                {
+                    imm.f64 = v;
+                }
+                push(1uz);
+            }
+
+            inline global_binding_t const& get_global(::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 index) noexcept
+            {
+                if(static_cast<::std::size_t>(index) >= module.globals.size()) [[unlikely]] { fail(u8"invalid global index"); }
+                return module.globals.index_unchecked(static_cast<::std::size_t>(index));
+            }
+
+            inline void emit_global_get() noexcept
+            {
+                auto const& global{get_global(read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>())};
+                if(global.storage == nullptr)
+                {
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_host_global_get)).imm.host_global = ::std::addressof(global.host);
+                }
+                else
+                {
+                    op_handler_t handler{};
+                    switch(global.storage->kind)
+                    {
+                        case ::uwvm2::object::global::global_type::wasm_i32:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_get<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_i64:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_get<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_f32:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_get<::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_f64:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_get<::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64>;
+                            break;
+                        }
+                        [[unlikely]] default:
+                        {
+                            fail(u8"unsupported global type");
+                        }
+                    }
+                    function.ops.index_unchecked(emit(handler)).imm.global = global.storage;
+                }
+                push(1uz);
+            }
+
+            inline void emit_global_set() noexcept
+            {
+                auto const& global{get_global(read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>())};
+                if(!global.is_mutable) [[unlikely]] { fail(u8"global.set on an immutable global"); }
+                pop(1uz);
+                if(global.storage == nullptr)
+                {
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_host_global_set)).imm.host_global = ::std::addressof(global.host);
+                }
+                else
+                {
+                    op_handler_t handler{};
+                    switch(global.storage->kind)
+                    {
+                        case ::uwvm2::object::global::global_type::wasm_i32:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_set<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_i64:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_set<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_f32:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_set<::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32>;
+                            break;
+                        }
+                        case ::uwvm2::object::global::global_type::wasm_f64:
+                        {
+                            handler = &::uwvm2::compiler::uwvm_int::op_global_set<::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64>;
+                            break;
+                        }
+                        [[unlikely]] default:
+                        {
+                            fail(u8"unsupported global type");
+                        }
+                    }
+                    function.ops.index_unchecked(emit(handler)).imm.global = global.storage;
+                }
+            }
+
+            inline void emit_call() noexcept
+            {
+                auto const index{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                if(static_cast<::std::size_t>(index) >= module.function_index_space.size()) [[unlikely]] { fail(u8"invalid function index"); }
+                auto const& callee{module.function_index_space.index_unchecked(static_cast<::std::size_t>(index))};
+
+                pop(get_param_count(callee.function_type_ptr));
+                if(callee.kind == callable_kind::compiled)
+                {
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_call_compiled)).imm.callee = callee.compiled;
+                }
+                else
+                {
+                    function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_call_host)).imm.host = callee.host;
+                }
+                push(get_result_count(callee.function_type_ptr));
+            }
+
+            inline void emit_call_indirect() noexcept
+            {
+                auto const type_index{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                read_reserved_zero_byte();
+                if(module.table == nullptr) [[unlikely]] { fail(u8"call_indirect in a module without table"); }
+                if(static_cast<::std::size_t>(type_index) >= module.function_type_count) [[unlikely]] { fail(u8"invalid type index"); }
+                auto const function_type_ptr{module.function_types + type_index};
+
+                pop(1uz);
+                pop(get_param_count(function_type_ptr));
+                function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_call_indirect)).imm.call_indirect = {module.table, function_type_ptr};
+                push(get_result_count(function_type_ptr));
+            }
+
+            inline ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 read_local_index() noexcept
+            {
+                auto const index{read_leb128<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>()};
+                if(static_cast<::std::size_t>(index) >= function.local_count) [[unlikely]] { fail(u8"invalid local index"); }
+                return index;
+            }
+
+            /// @return     Whether the function frame has been closed.
+            inline bool handle_end() noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                if(!frame.unreachable && height != frame.entry_height + frame.result_arity) [[unlikely]]
+                {
+                    fail(u8"operand stack height does not match the block type at end");
+                }
+
+                auto const end_index{function.ops.size()};
+                if(frame.kind == control_frame_kind::if_)
+                {
+                    if(frame.result_arity != 0u) [[unlikely]] { fail(u8"if with a result requires an else arm"); }
+                    links.resolved_branches.push_back({frame.if_slot, end_index});
+                }
+                for(auto const slot: frame.end_fixups) { links.resolved_branches.push_back({slot, end_index}); }
+
+                auto const is_function{frame.kind == control_frame_kind::function};
+                height = frame.entry_height + frame.result_arity;
+
+                // The implicit return of the function body is also the target of branches to the function label.
+                if(is_function) { emit_return(); }
+
+                frames.pop_back_unchecked();
+                return is_function;
+            }
+
+            inline void handle_else() noexcept
+            {
+                auto& frame{frames.back_unchecked()};
+                if(frame.kind != control_frame_kind::if_) [[unlikely]] { fail(u8"else without a matching if"); }
+                if(!frame.unreachable && height != frame.entry_height + frame.result_arity) [[unlikely]]
+                {
+                    fail(u8"operand stack height does not match the block type at else");
+                }
+
+                // The then arm jumps over the else arm, the false condition of `if` lands right after that jump.
+                auto const jump_index{emit(::uwvm2::compiler::uwvm_int::op_jump)};
+                function.ops.index_unchecked(jump_index).imm.branch = {};
+                frame.end_fixups.push_back({jump_index, false});
+                links.resolved_branches.push_back({frame.if_slot, function.ops.size()});
+
+                frame.kind = control_frame_kind::else_;
+                frame.unreachable = false;
+                height = frame.entry_height;
+            }
+
+            inline void translate() noexcept
+            {
+                using op_basic = ::uwvm2::parser::wasm::standard::wasm1::opcode::op_basic;
+                using wasm_u32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32;
+                using wasm_i32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32;
+                using wasm_i64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_i64;
+                using wasm_f32 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f32;
+                using wasm_f64 = ::uwvm2::parser::wasm::standard::wasm1::type::wasm_f64;
+
+                // Each byte encodes at most one op, plus the implicit return and the entry op of tiered execution.
+                function.ops.reserve(static_cast<::std::size_t>(end - curr) + 2uz);
+
+                use_register_ops = function.local_count + side_table->max_stack_height <=
+                                   static_cast<::std::size_t>(::std::numeric_limits<::std::uint_least32_t>::max());
+
+                collect_census = ::uwvm2::compiler::uwvm_int::flags::show_superinst_census;
+
+                push_frame(control_frame_kind::function, static_cast<::std::uint_least32_t>(function.result_count), {});
+
+                if(module.tier_up)
+                {
+                    auto const index{emit(::uwvm2::compiler::uwvm_int::op_tier_up_entry)};
+                    function.ops.index_unchecked(index).imm.callee = ::std::addressof(function);
+                }
+
+                for(;;)
+                {
+                    op_begin = curr;
+                    auto const op{static_cast<op_basic>(read_byte())};
+
+                    count_opcode(op);
+
+                    auto const producer{last_register_op};
+                    last_register_op = no_op_index;
+
+                    if(!can_use_pending_locals(op)) { flush_pending_locals(0uz); }
+                    if(!can_keep_cached_top(op)) { spill_cached_top(); }
+
+                    switch(op)
+                    {
+                        case op_basic::unreachable:
+                        {
+                            emit(::uwvm2::compiler::uwvm_int::op_unreachable);
+                            set_unreachable();
+                            break;
+                        }
+                        case op_basic::nop:
+                        {
+                            break;
+                        }
+                        case op_basic::block:
+                        {
+                            push_frame(control_frame_kind::block, read_block_arity(), {});
+                            break;
+                        }
+                        case op_basic::loop:
+                        {
+                            push_frame(control_frame_kind::loop, read_block_arity(), {});
+                            if(module.tier_up)
+                            {
+                                // Back-edges target the header op, which is also where on-stack replacement enters the native code.
+                                auto const index{emit(::uwvm2::compiler::uwvm_int::op_tier_up_loop)};
+                                function.ops.index_unchecked(index).imm.tier_up_loop = {::std::addressof(function), loop_count++};
+                            }
+                            break;
+                        }
+                        case op_basic::if_:
+                        {
+                            auto const arity{read_block_arity()};
+                            pop(1uz);
+                            auto const index{emit(::uwvm2::compiler::uwvm_int::op_br_if_eqz_jump)};
+                            function.ops.index_unchecked(index).imm.branch = {};
+                            push_frame(control_frame_kind::if_, arity, {index, false});
+                            break;
+                        }
+                        case op_basic::else_:
+                        {
+                            handle_else();
+                            break;
+                        }
+                        case op_basic::end:
+                        {
+                            if(handle_end())
+                            {
+                                if(curr != end) [[unlikely]] { fail(u8"unexpected bytes after the end of the function body"); }
+
+                                // Patch branch targets now that `ops` and `br_table_targets` no longer move.
+                                if(!defer_link) { link_function(links, function.ops.data(), function.br_table_targets.data()); }
+
+                                function.max_operand_height = max_height;
+                                function.frame_slot_count = function.local_count + max_height;
+                                if(function.frame_slot_count < function.result_count) { function.frame_slot_count = function.result_count; }
+                                return;
+                            }
+                            break;
+                        }
+                        case op_basic::br:
+                        {
+                            auto& label{get_label(read_leb128<wasm_u32>())};
+                            if(label.kind == control_frame_kind::function) { emit_return(); }
+                            else
+                            {
+                                auto const branch{make_branch(label)};
+                                auto const index{emit(branch.drop == 0u ? ::uwvm2::compiler::uwvm_int::op_jump : ::uwvm2::compiler::uwvm_int::op_br)};
+                                function.ops.index_unchecked(index).imm.branch = branch;
+                                link_branch(label, {index, false});
+                            }
+                            set_unreachable();
+                            break;
+                        }
+                        case op_basic::br_if:
+                        {
+                            auto const depth{read_leb128<wasm_u32>()};
+                            auto& label{get_label(depth)};
+                            if(use_register_ops && try_emit_br_if_superinst(label, producer)) { break; }
+                            spill_cached_top();
+                            pop(1uz);
+                            auto const branch{make_branch(label)};
+                            auto const index{emit(branch.drop == 0u ? ::uwvm2::compiler::uwvm_int::op_br_if_jump : ::uwvm2::compiler::uwvm_int::op_br_if)};
+                            function.ops.index_unchecked(index).imm.branch = branch;
+                            link_branch(label, {index, false});
+                            break;
+                        }
+                        case op_basic::br_table:
+                        {
+                            auto const count{read_leb128<wasm_u32>()};
+                            // Every label takes at least one byte.
+                            if(static_cast<::std::size_t>(count) >= static_cast<::std::size_t>(end - curr)) [[unlikely]]
+                            {
+                                fail(u8"br_table label count exceeds the function body");
+                            }
+                            pop(1uz);
+
+                            auto const first_target_index{function.br_table_targets.size()};
+                            for(wasm_u32 i{}; i <= count; ++i)
+                            {
+                                auto& label{get_label(read_leb128<wasm_u32>())};
+                                function.br_table_targets.push_back(make_branch(label));
+                                link_branch(label, {first_target_index + static_cast<::std::size_t>(i), true});
+                            }
+
+                            auto const index{emit(::uwvm2::compiler::uwvm_int::op_br_table)};
+                            function.ops.index_unchecked(index).imm.br_table.count = count;
+                            links.br_table_fixups.push_back({index, first_target_index});
+                            set_unreachable();
+                            break;
+                        }
+                        case op_basic::return_:
+                        {
+                            emit_return();
+                            set_unreachable();
+                            break;
+                        }
+                        case op_basic::call:
+                        {
+                            emit_call();
+                            break;
+                        }
+                        case op_basic::call_indirect:
+                        {
+                            emit_call_indirect();
+                            break;
+                        }
+                        case op_basic::drop:
+                        {
+                            pop(1uz);
+                            // A pending value has not been pushed, dropping it is free.
+                            if(!pending_locals.empty()) { pending_locals.pop_back_unchecked(); }
+                            else
+                            {
+                                emit(::uwvm2::compiler::uwvm_int::op_drop);
+                            }
+                            break;
+                        }
+                        case op_basic::select:
+                        {
+                            pop(3uz);
+                            emit(::uwvm2::compiler::uwvm_int::op_select);
+                            push(1uz);
+                            break;
+                        }
+                        case op_basic::local_get:
+                        {
+                            auto const index{read_local_index()};
+                            if(use_register_ops)
+                            {
+                                flush_pending_locals(1uz);
+                                pending_locals.push_back(index);
+                            }
+                            else
+                            {
+                                function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_local_get)).imm.index = index;
+                            }
+                            push(1uz);
+                            break;
+                        }
+                        case op_basic::local_set:
+                        {
+                            auto const index{read_local_index()};
+                            if(try_forward_to_local(index, producer)) { break; }
+                            pop(1uz);
+                            function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_local_set)).imm.index = index;
+                            break;
+                        }
+                        case op_basic::local_tee:
+                        {
+                            auto const index{read_local_index()};
+                            if(try_forward_to_local(index, producer))
+                            {
+                                // The value now lives in the local.
+                                pending_locals.push_back(index);
+                                push(1uz);
+                                break;
+                            }
+                            pop(1uz);
+                            function.ops.index_unchecked(emit(::uwvm2::compiler::uwvm_int::op_local_tee)).imm.index = index;
+                            push(1uz);
+                            break;
+                        }
+                        case op_basic::global_get:
+                        {
+                            emit_global_get();
+                            break;
+                        }
+                        case op_basic::global_set:
+                        {
+                            emit_global_set();
+                            break;
+                        }
+                        case op_basic::i32_load: emit_load<::std::uint_least32_t, wasm_i32>(); break;
+                        case op_basic::i64_load: emit_load<::std::uint_least64_t, wasm_i64>(); break;
+                        case op_basic::f32_load: emit_load<wasm_f32, wasm_f32>(); break;
+                        case op_basic::f64_load: emit_load<wasm_f64, wasm_f64>(); break;
+                        case op_basic::i32_load8_s: emit_load<::std::int_least8_t, wasm_i32>(); break;
+                        case op_basic::i32_load8_u: emit_load<::std::uint_least8_t, wasm_i32>(); break;
+                        case op_basic::i32_load16_s: emit_load<::std::int_least16_t, wasm_i32>(); break;
+                        case op_basic::i32_load16_u: emit_load<::std::uint_least16_t, wasm_i32>(); break;
+                        case op_basic::i64_load8_s: emit_load<::std::int_least8_t, wasm_i64>(); break;
+                        case op_basic::i64_load8_u: emit_load<::std::uint_least8_t, wasm_i64>(); break;
+                        case op_basic::i64_load16_s: emit_load<::std::int_least16_t, wasm_i64>(); break;
+                        case op_basic::i64_load16_u: emit_load<::std::uint_least16_t, wasm_i64>(); break;
+                        case op_basic::i64_load32_s: emit_load<::std::int_least32_t, wasm_i64>(); break;
+                        case op_basic::i64_load32_u: emit_load<::std::uint_least32_t, wasm_i64>(); break;
+                        case op_basic::i32_store: emit_store<wasm_i32, ::std::uint_least32_t>(); break;
+                        case op_basic::i64_store: emit_store<wasm_i64, ::std::uint_least64_t>(); break;
+                        case op_basic::f32_store: emit_store<wasm_f32, wasm_f32>(); break;
+                        case op_basic::f64_store: emit_store<wasm_f64, wasm_f64>(); break;
+                        case op_basic::i32_store8: emit_store<wasm_i32, ::std::uint_least8_t>(); break;
+                        case op_basic::i32_store16: emit_store<wasm_i32, ::std::uint_least16_t>(); break;
+                        case op_basic::i64_store8: emit_store<wasm_i64, ::std::uint_least8_t>(); break;
+                        case op_basic::i64_store16: emit_store<wasm_i64, ::std::uint_least16_t>(); break;
+                        case op_basic::i64_store32: emit_store<wasm_i64, ::std::uint_least32_t>(); break;
+                        case op_basic::memory_size:
+                        {
+                            read_reserved_zero_byte();
+                            require_memory();
+                            auto const index{emit(module.memory.native_memory != nullptr
+                                                      ? &::uwvm2::compiler::uwvm_int::op_memory_size<native_memory_accessor>
+                                                      : &::uwvm2::compiler::uwvm_int::op_memory_size<local_imported_memory_accessor>)};
+                            function.ops.index_unchecked(index).imm.memory = ::std::addressof(module.memory);
+                            push(1uz);
+                            break;
+                        }
+                        case op_basic::memory_grow:
+                        {
+                            read_reserved_zero_byte();
+                            require_memory();
+                            pop(1uz);
+                            auto const index{emit(module.memory.native_memory != nullptr
+                                                      ? &::uwvm2::compiler::uwvm_int::op_memory_grow<native_memory_accessor>
+                                                      : &::uwvm2::compiler::uwvm_int::op_memory_grow<local_imported_memory_accessor>)};
+                            function.ops.index_unchecked(index).imm.memory = ::std::addressof(module.memory);
+                            push(1uz);
+                            break;
+                        }
+                        case op_basic::i32_const:
+                        {
+                            auto const k{read_leb128<wasm_i32>()};
+                            if(use_register_ops && curr != end)
+                            {
+                                // `i32.const; <i32 binop>`
+                                auto const next_op{static_cast<op_basic>(*curr)};
+                                if(auto const info{get_numeric_op_info(next_op)}; info.reg_const_handlers[0][0] != nullptr)
+                                {
+                                    op_begin = curr++;
+                                    count_opcode(next_op);
+                                    emit_register_const(info, k);
+                                    count_superinst(superinst_kind::binary_reg_const, true);
+                                    break;
+                                }
+                            }
+                            flush_pending_locals(0uz);
+                            emit_const(k);
+                            break;
+                        }
+                        case op_basic::i64_const:
+                        {
+                            emit_const(read_leb128<wasm_i64>());
+                            break;
+                        }
+                        case op_basic::f32_const:
+                        {
+                            emit_const(read_float<wasm_f32>());
+                            break;
+                        }
+                        case op_basic::f64_const:
+                        {
+                            emit_const(read_float<wasm_f64>());
+                            break;
+                        }
+                        default:
+                        {
+                            auto const info{get_numeric_op_info(op)};
+                            if(info.handler == nullptr) [[unlikely]] { fail(u8"unsupported opcode"); }
+                            if(info.reg_const_handlers[0][0] != nullptr) { count_superinst(superinst_kind::binary_reg_const, false); }
+                            if(use_register_ops)
+                            {
+                                emit_register_numeric(info);
+                                break;
+                            }
+                            pop(info.operand_count);
+                            emit(info.handler);
+                            push(1uz);
+                            break;
+                        }
+                    }
+                }
+            }
+        };
+    }  // namespace details
+
+    /// @brief      Report a body that failed validation, like `fail` does for the translator.
+    [[noreturn]] UWVM_GNU_COLD inline void validation_error(compiled_module_t const& module,
+                                                            compiled_function_t const& function,
+                                                            ::std::size_t function_index,
+                                                            ::uwvm2::compiler::checker::validation_error_t const& error) noexcept
+    {
+        if(module.report_verification_errors)
+        {
+            ::uwvm2::compiler::uwvm_int::verification_error(module, function_index, error.err_curr, error.message);
+        }
+        auto const expr_begin{reinterpret_cast<::std::byte const*>(function.function_ptr->wasm_code_ptr->body.expr_begin)};
+        ::uwvm2::compiler::uwvm_int::translate_error(module, function_index, static_cast<::std::size_t>(error.err_curr - expr_begin), error.message);
+    }
+
+    namespace details
+    {
+        /// @return     false with `error` set if the body fails validation, nothing has been translated then.
+        inline bool try_translate_function_impl(compiled_module_t& module,
+                                                compiled_function_t& function,
+                                                ::std::size_t function_index,
+                                                bool defer_link,
+                                                function_links_t& links,
+                                                ::uwvm2::compiler::checker::validation_error_t& error) noexcept
+        {
+            auto const code_ptr{function.function_ptr->wasm_code_ptr};
+            if(code_ptr == nullptr) [[unlikely]]
+            {
+                // vm bug
+#if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+#endif
+                ::fast_io::fast_terminate();
+            }
+
+            // Validation and translation of different bodies run on several threads, each keeps its own validator and side table.
+            thread_local ::uwvm2::compiler::checker::function_validator_t validator{};
+            thread_local ::uwvm2::compiler::checker::function_side_table_t side_table{};
+
+            if(!validator.validate(module.validation_context, *function.function_type_ptr, *code_ptr, side_table, error)) [[unlikely]] { return false; }
+
+            function_translator_t translator{module, function, function_index, code_ptr->body.expr_begin, code_ptr->body.expr_begin, code_ptr->body.code_end};
+            translator.defer_link = defer_link;
+            translator.side_table = ::std::addressof(side_table);
+            translator.translate();
+            links = ::std::move(translator.links);
+            return true;
+        }
+
+        inline function_links_t translate_function_impl(compiled_module_t& module,
+                                                        compiled_function_t& function,
+                                                        ::std::size_t function_index,
+                                                        bool defer_link) noexcept
+        {
+            function_links_t links{};
+            if(::uwvm2::compiler::checker::validation_error_t error{};
+               !try_translate_function_impl(module, function, function_index, defer_link, links, error)) [[unlikely]]
+            {
+                ::uwvm2::compiler::uwvm_int::validation_error(module, function, function_index, error);
+            }
+            return links;
+        }
+    }  // namespace details
+
+    /// @brief      Translate the body of `function` (a defined function of `module`) into ops.
+    /// @param      function_index  Index in the function index space, only used for diagnostics.
+    inline void translate_function(compiled_module_t& module, compiled_function_t& function, ::std::size_t function_index) noexcept
+    {
+        details::translate_function_impl(module, function, function_index, false);
+    }
+
+    /// @brief      Like `translate_function`, but leaves the branch targets as op indices so the body can be moved before `details::link_function`.
+    /// @note       Bodies of different functions may be translated concurrently, as long as `flags::show_superinst_census` is off.
+    inline details::function_links_t translate_function_unlinked(compiled_module_t& module,
+                                                                 compiled_function_t& function,
+                                                                 ::std::size_t function_index) noexcept
+    {
+        return details::translate_function_impl(module, function, function_index, true);
+    }
+
+    /// @brief      Like `translate_function_unlinked`, but hands a validation failure to the caller instead of reporting it, so that callers
+    ///             translating many bodies at once can report the failure of the lowest function index whatever order the bodies ran in.
+    /// @note       The translator's own checks still terminate, they only fail on bodies that passed validation if uwvm-int lacks a feature.
+    inline bool try_translate_function_unlinked(compiled_module_t& module,
+                                                compiled_function_t& function,
+                                                ::std::size_t function_index,
+                                                details::function_links_t& links,
+                                                ::uwvm2::compiler::checker::validation_error_t& error) noexcept
+    {
+        return details::try_translate_function_impl(module, function, function_index, true, links, error);
+    }
+
+#if defined(UWVM_MODULE)
+    extern "C++" UWVM_GNU_COLD
+#else
+    UWVM_GNU_COLD inline
+#endif
+        op_t const* translate_on_first_call(compiled_function_t const* function) noexcept
+    {
+        ::std::atomic_ref<op_t const*> const entry{function->entry};
+        ::std::atomic_ref<lazy_translation_state> const state{function->lazy_state};
+
+        auto expected{lazy_translation_state::stub};
+        if(state.compare_exchange_strong(expected, lazy_translation_state::translating, ::std::memory_order_acquire, ::std::memory_order_acquire))
+        {
+            // Every compiled function is an element of the non-const `compiled_module_t::functions` of its module.
+            auto& mutable_function{const_cast<compiled_function_t&>(*function)};
+            auto& module{*function->module_ptr};
+            auto const defined_index{static_cast<::std::size_t>(function - module.functions.data())};
+            translate_function(module, mutable_function, module.runtime_module_ptr->imported_function_vec_storage.size() + defined_index);
+
+            entry.store(mutable_function.ops.data(), ::std::memory_order_release);
+            state.store(lazy_translation_state::translated, ::std::memory_order_release);
+            state.notify_all();
+        }
+        else
+        {
+            // Another thread is translating the body.
+            while(expected != lazy_translation_state::translated)
+            {
+                state.wait(expected, ::std::memory_order_acquire);
+                expected = state.load(::std::memory_order_acquire);
+            }
+        }
+
+        return entry.load(::std::memory_order_acquire);
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
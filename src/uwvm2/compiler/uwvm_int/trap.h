@@ -0,0 +1,165 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <csetjmp>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::compiler::uwvm_int
+{
+    enum class trap_kind : unsigned
+    {
+        unreachable,
+        integer_divide_by_zero,
+        integer_overflow,
+        invalid_conversion_to_integer,
+        out_of_bounds_memory_access,
+        undefined_element,
+        uninitialized_element,
+        indirect_call_type_mismatch,
+        call_stack_exhausted
+    };
+
+    inline constexpr ::uwvm2::utils::container::u8string_view get_trap_kind_name(trap_kind kind) noexcept
+    {
+        switch(kind)
+        {
+            case trap_kind::unreachable:
+            {
+                return u8"unreachable executed";
+            }
+            case trap_kind::integer_divide_by_zero:
+            {
+                return u8"integer divide by zero";
+            }
+            case trap_kind::integer_overflow:
+            {
+                return u8"integer overflow";
+            }
+            case trap_kind::invalid_conversion_to_integer:
+            {
+                return u8"invalid conversion to integer";
+            }
+            case trap_kind::out_of_bounds_memory_access:
+            {
+                return u8"out of bounds memory access";
+            }
+            case trap_kind::undefined_element:
+            {
+                return u8"undefined element";
+            }
+            case trap_kind::uninitialized_element:
+            {
+                return u8"uninitialized element";
+            }
+            case trap_kind::indirect_call_type_mismatch:
+            {
+                return u8"indirect call type mismatch";
+            }
+            case trap_kind::call_stack_exhausted:
+            {
+                return u8"call stack exhausted";
+            }
+            [[unlikely]] default:
+            {
+                return u8"unknown";
+            }
+        }
+    }
+
+    /// @brief      Where a trap unwinds to instead of terminating the process, see `try_call_function`.
+    /// @details    The frames between the entry point and the trap are interpreter handlers and JIT code, which hold no resources, so the jump
+    ///             skips nothing that needs cleaning up. On POSIX the signal mask is saved as well: a guard region fault jumps out of the signal
+    ///             handler.
+    struct trap_frame_t
+    {
+#if defined(_WIN32) && !defined(__CYGWIN__)
+        ::std::jmp_buf buffer;
+#else
+        ::sigjmp_buf buffer;
+#endif
+        trap_frame_t* previous{};
+        // Written between the `setjmp` and the jump back, hence volatile.
+        trap_kind volatile kind{};
+    };
+
+    /// @brief      Innermost trap frame of this thread, traps terminate the process when it is null.
+    inline thread_local trap_frame_t* current_trap_frame{};  // [global]
+
+    /// @brief      Print the fatal message of a trap.
+    UWVM_GNU_COLD inline void report_trap(trap_kind kind) noexcept
+    {
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                            u8"[fatal] ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"uwvm-int: wasm trap: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            get_trap_kind_name(kind),
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8".\n\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+    }
+
+    /// @brief      Raise a wasm trap: unwind to the innermost trap frame of this thread, or report the trap and terminate without one.
+    /// @details    Kept out of line and cold so the handlers' fast paths only carry a predicted-not-taken branch.
+    [[noreturn]] UWVM_GNU_COLD inline void trap(trap_kind kind) noexcept
+    {
+        if(auto const frame{current_trap_frame}; frame != nullptr)
+        {
+            frame->kind = kind;
+#if defined(_WIN32) && !defined(__CYGWIN__)
+            ::std::longjmp(frame->buffer, 1);
+#else
+            ::siglongjmp(frame->buffer, 1);
+#endif
+        }
+
+        report_trap(kind);
+        ::fast_io::fast_terminate();
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -113,6 +113,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
     };
 
     using wasip1_proc_exit_ptr_t = void (*)(::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32) noexcept;
+    using wasip1_proc_exit_prepare_ptr_t = void (*)() noexcept;
     using wasip1_proc_raise_ptr_t = ::uwvm2::imported::wasi::wasip1::abi::errno_t (*)(::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32) noexcept;
     using wasip1_sched_yield_ptr_t = ::uwvm2::imported::wasi::wasip1::abi::errno_t (*)() noexcept;
 
@@ -175,6 +176,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::environment
         ///        without returning.)
         /// @note  If not set, the default exit behavior will be used. (exit(3))
         wasip1_proc_exit_ptr_t wasip1_proc_exit_func_ptr{};
+        /// @brief Called by proc_exit before the process exits, whether or not a custom exit function is set
+        /// @note  Lets the host finish work that must complete before the exit, such as verifying the code of the running modules.
+        wasip1_proc_exit_prepare_ptr_t wasip1_proc_exit_prepare_func_ptr{};
         wasip1_proc_raise_ptr_t wasip1_proc_raise_func_ptr{};
         wasip1_sched_yield_ptr_t wasip1_sched_yield_func_ptr{};
 
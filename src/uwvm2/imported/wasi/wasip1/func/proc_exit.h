@@ -74,6 +74,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::func
     inline void proc_exit_impl(::uwvm2::imported::wasi::wasip1::environment::wasip1_environment<::uwvm2::object::memory::linear::native_memory_t> & env,
                                ::uwvm2::imported::wasi::wasip1::abi::exitcode_t code) noexcept
     {
+        if(env.wasip1_proc_exit_prepare_func_ptr != nullptr) { env.wasip1_proc_exit_prepare_func_ptr(); }
+
         if(env.wasip1_proc_exit_func_ptr != nullptr)
         {
             env.wasip1_proc_exit_func_ptr(static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_i32>(code));
@@ -51,7 +51,7 @@
 UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
 {
     /// @brief      Read a Wasm value from linear memory (allocator backend) with concurrency safety and bounds double-checking.
-    /// @details    - Concurrency safety: use the double-atom guard (growing_flag_p + active_ops_p) to synchronize with grow operations.
+    /// @details    - Concurrency safety: use the operation guard (growing_flag_p + per-thread epoch record) to synchronize with grow operations.
     ///             - Bounds double-checks:
     ///               (1) Using the size_t parameter supports both u32 and u64. Comparison checks between u32 or u64 and size_t will be performed by the calling
     ///                   function.
@@ -65,7 +65,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
 
     template <typename Alloc>
     inline constexpr auto lock_memory(::uwvm2::object::memory::linear::basic_allocator_memory_t<Alloc> const& memory) noexcept
-    { return ::uwvm2::object::memory::linear::memory_operation_guard_t{memory.growing_flag_p, memory.active_ops_p}; }
+    { return ::uwvm2::object::memory::linear::memory_operation_guard_t{memory.growing_flag_p}; }
 
     template <typename Alloc>
     inline constexpr void check_memory_bounds_unlocked(::uwvm2::object::memory::linear::basic_allocator_memory_t<Alloc> const& memory,
@@ -157,7 +157,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                               ::std::size_t wasm_bytes) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         // After acquiring the lock, call the unlocked version.
         check_memory_bounds_unlocked(memory, offset, wasm_bytes);
@@ -313,7 +313,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                               ::std::size_t offset) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         return get_basic_wasm_type_from_memory_unlocked<WasmType, Alloc>(memory, offset);
     }
@@ -463,7 +463,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                           WasmType value) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         store_basic_wasm_type_to_memory_unlocked<WasmType, Alloc>(memory, offset, value);
     }
@@ -604,7 +604,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                ::std::byte* end) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         read_all_from_memory_unlocked<Alloc>(memory, offset, begin, end);
     }
@@ -746,7 +746,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                               ::std::byte const* end) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         write_all_to_memory_unlocked<Alloc>(memory, offset, begin, end);
     }
@@ -871,7 +871,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                        ::std::size_t size) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         clear_memory_unlocked<Alloc>(memory, offset, size);
     }
@@ -1024,7 +1024,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                                         ::std::size_t offset) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         return get_basic_wasm_type_from_memory_unchecked_unlocked<WasmType, Alloc>(memory, offset);
     }
@@ -1190,7 +1190,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                                     WasmType value) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         store_basic_wasm_type_to_memory_unchecked_unlocked<WasmType, Alloc>(memory, offset, value);
     }
@@ -1329,7 +1329,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                          ::std::byte* end) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         read_all_from_memory_unchecked_unlocked<Alloc>(memory, offset, begin, end);
     }
@@ -1469,7 +1469,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                         ::std::byte const* end) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         write_all_to_memory_unchecked_unlocked<Alloc>(memory, offset, begin, end);
     }
@@ -1592,7 +1592,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::imported::wasi::wasip1::memory
                                                  ::std::size_t size) noexcept
     {
         // Mutual exclusion between concurrent read/write operations and memory growth: Entering the memory operation region
-        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p, memory.active_ops_p};
+        ::uwvm2::object::memory::linear::memory_operation_guard_t memory_op_guard{memory.growing_flag_p};
 
         clear_memory_unchecked_unlocked<Alloc>(memory, offset, size);
     }
@@ -137,6 +137,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::error
 
     inline constexpr void output_mmap_memory_error(mmap_memory_error_t const& memerr) noexcept
     {
+        // A fault below the length is not a guard region hit, the pages backing the memory could not be provided.
+        bool const in_bounds{memerr.memory_offset < memerr.memory_length};
 #ifdef UWVM
         ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
@@ -148,11 +150,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::error
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
                             memerr.memory_idx,
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                            u8"] page protection fault: ",
+                            ::fast_io::mnp::cond(in_bounds, u8"] backing storage fault: "),
+                            ::fast_io::mnp::cond(!in_bounds, u8"] page protection fault: "),
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
                             ::fast_io::mnp::addrvw(memerr.memory_offset),
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                            u8" (fault offset) >= ",
+                            ::fast_io::mnp::cond(in_bounds, u8" (fault offset) < "),
+                            ::fast_io::mnp::cond(!in_bounds, u8" (fault offset) >= "),
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
                             ::fast_io::mnp::addrvw(memerr.memory_length),
                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
@@ -164,9 +168,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::error
                             u8"[fatal] "
                             u8"memory[",
                             memerr.memory_idx,
-                            u8"] page protection fault: ",
+                            ::fast_io::mnp::cond(in_bounds, u8"] backing storage fault: "),
+                            ::fast_io::mnp::cond(!in_bounds, u8"] page protection fault: "),
                             ::fast_io::mnp::addrvw(memerr.memory_offset),
-                            u8" (fault offset) >= ",
+                            ::fast_io::mnp::cond(in_bounds, u8" (fault offset) < "),
+                            ::fast_io::mnp::cond(!in_bounds, u8" (fault offset) >= "),
                             ::fast_io::mnp::addrvw(memerr.memory_length),
                             u8" (allocated)\n\n");
 #endif
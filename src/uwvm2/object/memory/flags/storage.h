@@ -54,6 +54,40 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::flags
     /// @todo       Set it to the interpreter, JIT.
     inline bool grow_strict{};  // [global]
 
+    /// @brief      Let mmap-backed linear memories commit geometrically ahead of their length on grow, so that growing one page at a time does not
+    ///             change page protection on every `memory.grow`.
+    /// @note       Accesses past the length are then no longer caught by page protection, such memories check every access in software. Memories that
+    ///             are checked in software anyway (custom page sizes below the platform page size) always commit ahead.
+    inline bool grow_commit_ahead{};  // [global]
+
+    enum class huge_page_mode : unsigned
+    {
+        // Platform pages.
+        none,
+        // Transparent huge pages: the reservation starts at a huge page boundary and committed pages are advised with `MADV_HUGEPAGE`, the kernel then
+        // backs every whole huge page of the memory with one TLB entry when it can.
+        transparent,
+        // Explicit huge pages: committed pages are taken from the hugetlb pool with `MAP_HUGETLB`. Memory is committed in whole huge pages, so page
+        // protection no longer catches accesses just past the end and the engines check bounds in software.
+        hugetlb
+    };
+
+    /// @brief      Huge page backing of mmap-backed linear memories, read by each memory when it is initialized.
+    /// @note       Only Linux provides these modes, elsewhere platform pages are used. When the hugetlb pool cannot hold the initial memory, that memory
+    ///             falls back to transparent huge pages.
+    inline huge_page_mode huge_pages{};  // [global]
+
+    /// @brief      Place the pages of mmap-backed linear memories on the NUMA node of the thread that initializes them, through a policy set on the
+    ///             reservation rather than first touch. Instances can be moved later with `mmap_memory_t::migrate_to_numa_node`.
+    /// @note       Linux only.
+    inline bool numa_local{};  // [global]
+
+    /// @brief      Number of released mmap reservations kept for reuse by later instances instead of being unmapped, 0 disables the pool.
+    /// @note       Each pooled reservation keeps its full guard region mapped (8 GB for a guarded wasm32 memory), so the default of 16 holds at most
+    ///             128 GB of the 128 TB user address space while covering the instances a typical embedder keeps in flight. Servers that create more
+    ///             instances concurrently raise it with `--wasm-memory-reservation-pool`.
+    inline ::std::size_t mmap_reservation_pool_size{16uz};  // [global]
+
 }  // namespace uwvm2::object::memory::flags
 
 #ifndef UWVM_MODULE
@@ -111,48 +111,214 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         }
     };
 
+    namespace details
+    {
+        /// @brief      A memory the owning thread is inside of, with its nesting depth.
+        struct held_memory_t
+        {
+            // Growing flag of the memory, nullptr for a free slot. Written by the owning thread only, read by grows.
+            ::std::atomic<::std::atomic_flag const*> memory{};
+            // Only used by the owning thread.
+            ::std::size_t depth{};
+        };
+
+        /// @brief      Slots of the memories a thread is inside of. A thread nesting more memories than a chunk holds links further chunks, which are
+        ///             never moved or freed, so grows can scan them while the owning thread enters and leaves.
+        struct held_memory_chunk_t
+        {
+            held_memory_t slots[4]{};
+            ::std::atomic<held_memory_chunk_t*> next{};
+        };
+
+        /// @brief      Per-thread record of the memory operations a thread is currently inside of.
+        /// @details    Only the owning thread writes a record, so entering and leaving an operation touches a cache line no other thread writes to. A grow
+        ///             scans every record instead, which is rare compared to loads and stores.
+        struct alignas(64) memory_operation_epoch_t
+        {
+            // Nesting depth of the memory operations of the owning thread, 0 when the thread is quiescent.
+            ::std::atomic_size_t active{};
+            // Cleared when the owning thread exits, the record is then reused by the next thread.
+            ::std::atomic_bool in_use{};
+            memory_operation_epoch_t* next{};
+            // Every memory the thread is inside of. A grow only waits for the records holding its memory, so a thread nested in operations on other
+            // memories can wait for that grow without the grow waiting for it.
+            held_memory_chunk_t held{};
+
+            /// @brief      The slot of a memory the owning thread is inside of, nullptr if there is none. Owning thread only.
+            inline held_memory_t* find_held(::std::atomic_flag const* growing_flag_p) noexcept
+            {
+                for(auto chunk{::std::addressof(this->held)}; chunk != nullptr; chunk = chunk->next.load(::std::memory_order_relaxed))
+                {
+                    for(auto& slot: chunk->slots)
+                    {
+                        if(slot.memory.load(::std::memory_order_relaxed) == growing_flag_p) { return ::std::addressof(slot); }
+                    }
+                }
+                return nullptr;
+            }
+
+            /// @brief      A free slot, a chunk is linked when every slot is taken. Owning thread only.
+            inline held_memory_t& free_held_slot() noexcept
+            {
+                for(auto chunk{::std::addressof(this->held)};;)
+                {
+                    for(auto& slot: chunk->slots)
+                    {
+                        if(slot.memory.load(::std::memory_order_relaxed) == nullptr) { return slot; }
+                    }
+
+                    auto next{chunk->next.load(::std::memory_order_relaxed)};
+                    if(next == nullptr)
+                    {
+                        using chunk_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, held_memory_chunk_t>;
+
+                        next = chunk_allocator_t::allocate(1uz);
+                        ::new(next) held_memory_chunk_t{};
+
+                        // release: grows scanning the chunks observe an initialized chunk.
+                        chunk->next.store(next, ::std::memory_order_release);
+                    }
+                    chunk = next;
+                }
+            }
+
+            /// @brief      Whether the owning thread is inside an operation on the memory of `growing_flag_p`. Called by grows.
+            inline bool holds(::std::atomic_flag const* growing_flag_p) const noexcept
+            {
+                for(auto chunk{::std::addressof(this->held)}; chunk != nullptr; chunk = chunk->next.load(::std::memory_order_acquire))
+                {
+                    for(auto const& slot: chunk->slots)
+                    {
+                        // acquire: pairs with the release that frees the slot, the accesses of the finished operation happen before the grow.
+                        if(slot.memory.load(::std::memory_order_acquire) == growing_flag_p) { return true; }
+                    }
+                }
+                return false;
+            }
+        };
+
+        // Push-only list of all records. Records are never freed, there are at most as many as threads that ever ran concurrently.
+        inline ::std::atomic<memory_operation_epoch_t*> memory_operation_epoch_list{};  // [global]
+
+        inline memory_operation_epoch_t* acquire_memory_operation_epoch() noexcept
+        {
+            for(auto curr{memory_operation_epoch_list.load(::std::memory_order_acquire)}; curr != nullptr; curr = curr->next)
+            {
+                bool expected{};
+                if(curr->in_use.compare_exchange_strong(expected, true, ::std::memory_order_acquire, ::std::memory_order_relaxed)) { return curr; }
+            }
+
+            using epoch_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, memory_operation_epoch_t>;
+
+            auto const epoch{epoch_allocator_t::allocate(1uz)};
+            ::new(epoch) memory_operation_epoch_t{};
+            epoch->in_use.store(true, ::std::memory_order_relaxed);
+
+            // release: the grow path reads the record through the list.
+            auto head{memory_operation_epoch_list.load(::std::memory_order_relaxed)};
+            do {
+                epoch->next = head;
+            }
+            while(!memory_operation_epoch_list.compare_exchange_weak(head, epoch, ::std::memory_order_release, ::std::memory_order_relaxed));
+
+            return epoch;
+        }
+
+        struct memory_operation_epoch_owner_t
+        {
+            memory_operation_epoch_t* epoch{acquire_memory_operation_epoch()};
+
+            inline ~memory_operation_epoch_owner_t() { this->epoch->in_use.store(false, ::std::memory_order_release); }
+        };
+
+        /// @brief      The record of the calling thread, registered on first use.
+        inline memory_operation_epoch_t& this_thread_memory_operation_epoch() noexcept
+        {
+            thread_local memory_operation_epoch_owner_t owner{};
+            return *owner.epoch;
+        }
+
+        /// @brief      Wait until no thread is inside a memory operation on the memory whose growing flag is `growing_flag_p`.
+        /// @note       The caller has set the growing flag, so threads that enter afterwards back off instead of being waited for.
+        inline void wait_for_memory_operations(::std::atomic_flag const* growing_flag_p) noexcept
+        {
+            // seq_cst: pairs with the seq_cst increment and flag test in `memory_operation_guard_t::enter_operation`. Either the grow observes the
+            // increment here, or the entering thread observes the growing flag and backs off.
+            ::std::atomic_thread_fence(::std::memory_order_seq_cst);
+
+            for(auto curr{memory_operation_epoch_list.load(::std::memory_order_acquire)}; curr != nullptr; curr = curr->next)
+            {
+                unsigned spin_count{};
+
+                // acquire: observe decrements published with release; ensures quiescence is visible
+                for(auto v{curr->active.load(::std::memory_order_acquire)}; v != 0uz; v = curr->active.load(::std::memory_order_acquire))
+                {
+                    // The thread works on other memories only. It may wait for this grow, and checks the growing flag again before entering.
+                    if(!curr->holds(growing_flag_p)) { break; }
+
+                    if(++spin_count > 1000u)
+                    {
+                        // acquire: pair with operation's release decrement before proceeding after wake
+                        curr->active.wait(v, ::std::memory_order_acquire);
+                        spin_count = 0u;
+                    }
+                    else
+                    {
+                        ::uwvm2::utils::mutex::rwlock_pause();
+                    }
+                }
+            }
+        }
+    }  // namespace details
+
     /// @brief      The guard for memory operations (read/write instructions).
     /// @note       This guard implements the enter/exit protocol for memory operations to ensure thread safety
     ///             during memory growth operations. It prevents race conditions between memory operations and
     ///             the memory relocation process.
     /// @details    The protocol ensures:
     ///             1. Memory operations wait for any ongoing grow operation to complete
-    ///             2. Active operations are properly counted to prevent grow from starting while operations are in progress
+    ///             2. Active operations are recorded in the per-thread epoch record, a grow waits until every thread working on the memory is quiescent
     ///             3. Double-check mechanism prevents race conditions where grow starts immediately after entry
-    ///             4. Proper memory ordering (acquire/release) ensures visibility of memory updates
+    ///             4. Proper memory ordering (seq_cst on the record and the growing flag) ensures visibility of memory updates
+    ///             Unlike a shared counter of active operations, entering and leaving only write the record of the calling thread, so threads
+    ///             accessing the same memory do not bounce a cache line between them.
+    /// @note       Guards on several memories may be nested, and a memory may be entered again inside them. Like locks, nested guards on different
+    ///             memories must be taken in the same order on every thread, otherwise two grows can each wait for a thread waiting for the other.
     struct memory_operation_guard_t
     {
         ::std::atomic_flag* growing_flag_p{};
-        ::std::atomic_size_t* active_ops_p{};
+        details::memory_operation_epoch_t* epoch_p{};
 
-        inline constexpr memory_operation_guard_t(::std::atomic_flag* other_growing_flag_p, ::std::atomic_size_t* other_active_ops_p) noexcept :
-            growing_flag_p{other_growing_flag_p}, active_ops_p{other_active_ops_p}
+        inline constexpr memory_operation_guard_t(::std::atomic_flag* other_growing_flag_p) noexcept : growing_flag_p{other_growing_flag_p}
         {
             // Since this is a path frequently accessed during WASM execution, we should strive to avoid branches related to the virtual machine's own bug
             // checks (which are verified during debugging).
 
 # if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
-            if(this->growing_flag_p == nullptr || this->active_ops_p == nullptr) [[unlikely]]
+            if(this->growing_flag_p == nullptr) [[unlikely]]
             {
                 // This is a bug in uwvm rather than a bug in the program running in WASM.
                 ::uwvm2::utils::debug::trap_and_inform_bug_pos();
             }
 # endif
 
+            if(this->growing_flag_p != nullptr) [[likely]] { this->epoch_p = ::std::addressof(details::this_thread_memory_operation_epoch()); }
+
             enter_operation();
         }
 
         inline constexpr memory_operation_guard_t(memory_operation_guard_t const& other) noexcept = delete;
         inline constexpr memory_operation_guard_t& operator= (memory_operation_guard_t const& other) noexcept = delete;
 
+        /// @note       The guard must stay on the thread that created it.
         inline constexpr memory_operation_guard_t(memory_operation_guard_t&& other) noexcept
         {
             // Directly take over the lock from the other process.
             this->growing_flag_p = other.growing_flag_p;
-            this->active_ops_p = other.active_ops_p;
+            this->epoch_p = other.epoch_p;
 
             other.growing_flag_p = nullptr;
-            other.active_ops_p = nullptr;
+            other.epoch_p = nullptr;
         }
 
         inline constexpr memory_operation_guard_t& operator= (memory_operation_guard_t&& other) noexcept
@@ -164,10 +330,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             exit_operation();
 
             this->growing_flag_p = other.growing_flag_p;
-            this->active_ops_p = other.active_ops_p;
+            this->epoch_p = other.epoch_p;
 
             other.growing_flag_p = nullptr;
-            other.active_ops_p = nullptr;
+            other.epoch_p = nullptr;
 
             return *this;
         }
@@ -177,19 +343,39 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         /// @brief      Enter the memory operation safely.
         /// @details    Implements the enter protocol to prevent race conditions:
         ///             1. Wait for grow operation to complete (acquire semantics)
-        ///             2. Increment active operations counter (acquire semantics)
-        ///             3. Double-check that grow hasn't started (acquire semantics)
-        ///             4. If grow started, undo increment and retry
+        ///             2. Take a slot for the memory and increment the depth in the thread's record (seq_cst semantics)
+        ///             3. Double-check that grow hasn't started (seq_cst semantics)
+        ///             4. If grow started, free the slot, undo increment and retry
+        ///             A memory the thread is already inside of is entered again without waiting.
         inline constexpr void enter_operation() noexcept
         {
             // Due to the inclusion of mobile semantics, null pointer checks must be performed.
-            if(this->growing_flag_p == nullptr || this->active_ops_p == nullptr) [[unlikely]] { return; }
+            if(this->growing_flag_p == nullptr || this->epoch_p == nullptr) [[unlikely]] { return; }
+
+            auto& epoch{*this->epoch_p};
+
+            // Only the owning thread writes the record.
+            auto const depth{epoch.active.load(::std::memory_order_relaxed)};
+
+            // Nested in an operation on the same memory: a grow cannot pass this thread anyway, and waiting for it here would deadlock.
+            if(depth != 0uz)
+            {
+                if(auto const held{epoch.find_held(this->growing_flag_p)}; held != nullptr)
+                {
+                    ++held->depth;
+                    epoch.active.store(depth + 1uz, ::std::memory_order_relaxed);
+                    return;
+                }
+            }
+
+            auto& slot{epoch.free_held_slot()};
 
             unsigned spin_count{};
 
             for(;;)
             {
                 // 1) Wait for grow operation to complete, must use acquire to see memory updates
+                // The slot is free meanwhile, so the grow does not wait for this thread even if it is inside operations on other memories.
                 while(this->growing_flag_p->test(::std::memory_order_acquire))
                 {
                     if(++spin_count > 1000u)
@@ -204,44 +390,68 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
                 }
 
                 // 2) Declare entry into active region.
-                // Use acquire to prevent subsequent memory accesses from being reordered before the increment,
-                // otherwise grow() could observe active_ops==0 and start relocating while this operation is already in-flight.
-                this->active_ops_p->fetch_add(1uz, ::std::memory_order_acquire);
+                // The memory is published before the depth, a grow that observes the depth also observes that this thread holds the memory.
+                slot.memory.store(this->growing_flag_p, ::std::memory_order_relaxed);
+
+                // seq_cst: the store must not be reordered after the flag test below, otherwise grow() could miss this operation while it also misses
+                // the growing flag. The record is private to this thread, so the store does not contend with other threads.
+                epoch.active.store(depth + 1uz, ::std::memory_order_seq_cst);
 
                 // 3) Double-check that grow hasn't started after we "entered"
-                if(!this->growing_flag_p->test(::std::memory_order_acquire))
+                if(!this->growing_flag_p->test(::std::memory_order_seq_cst))
                 {
+                    slot.depth = 1uz;
                     break;  // Successfully entered, grow is not active
                 }
 
                 // 4) Grow started after we entered: undo increment and retry
-                this->active_ops_p->fetch_sub(1uz, ::std::memory_order_release);
+                // The slot is freed before the depth changes. A grow woken by the depth change re-reads the slots and passes this record.
+                slot.memory.store(nullptr, ::std::memory_order_relaxed);
+                epoch.active.store(depth, ::std::memory_order_release);
 
-                // Only one grow can await active_ops: the grow path holds growing_flag exclusively.
-                // Other grow attempts block on growing_flag->wait until the flag is cleared.
-                // Thus the waiter set for active_ops==0 contains at most one grow thread.
-                // Wake a single grow waiter to re-check the counter; at most one grow can await active_ops
-                this->active_ops_p->notify_one();  // Wake up a waiting grow operation
+                // Wake the grows waiting for this record to re-check it.
+                epoch.active.notify_all();
             }
         }
 
         /// @brief      Exit the memory operation safely.
         /// @details    Implements the exit protocol:
-        ///             1. Decrement active operations counter (release semantics)
-        ///             2. Notify waiting grow operations
+        ///             1. Free the slot of the memory once its outermost operation ends (release semantics)
+        ///             2. Decrement the depth in the thread's record
+        ///             3. Notify a waiting grow operation once the thread left the memory
         inline constexpr void exit_operation() noexcept
         {
             // Due to the inclusion of mobile semantics, null pointer checks must be performed.
-            if(this->growing_flag_p == nullptr || this->active_ops_p == nullptr) [[unlikely]] { return; }
+            if(this->growing_flag_p == nullptr || this->epoch_p == nullptr) [[unlikely]] { return; }
+
+            auto& epoch{*this->epoch_p};
+
+            auto const held{epoch.find_held(this->growing_flag_p)};
+
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            if(held == nullptr) [[unlikely]]
+            {
+                // This is a bug in uwvm rather than a bug in the program running in WASM.
+                ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+            }
+# endif
 
-            // Decrement counter with release semantics to publish our updates
-            this->active_ops_p->fetch_sub(1uz, ::std::memory_order_release);
+            bool left_memory{};
+            if(--held->depth == 0uz)
+            {
+                // release: publish our updates, a grow that observes the free slot no longer waits for this thread.
+                held->memory.store(nullptr, ::std::memory_order_release);
+                left_memory = true;
+            }
 
-            // Only one grow can await active_ops: the grow path holds growing_flag exclusively.
-            // Other grow attempts block on growing_flag->wait until the flag is cleared.
-            // Thus the waiter set for active_ops==0 contains at most one grow thread.
-            // Wake a single grow waiter to re-check the counter; at most one grow can await active_ops
-            this->active_ops_p->notify_one();
+            auto const depth{epoch.active.load(::std::memory_order_relaxed) - 1uz};
+
+            // seq_cst: pairs with the fence in `details::wait_for_memory_operations`. Either the grow observes the decrement before it sleeps, or
+            // the flag test below observes the grow and wakes it.
+            epoch.active.store(depth, ::std::memory_order_seq_cst);
+
+            // A grow only waits for this record while the thread holds its memory, and only while the growing flag is set.
+            if(left_memory && this->growing_flag_p->test(::std::memory_order_seq_cst)) [[unlikely]] { epoch.active.notify_all(); }
         }
     };
 
@@ -255,13 +465,14 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
     ///          - After A releases the line, B and C race; if C proceeds first and copies “old” data into the new buffer, then B writes to the old buffer,
     ///            yielding divergence between the new buffer and reality.
     ///
-    ///          Therefore, the grow_flag must be set during the grow phase to prevent new threads from attempting to read or write memory. Reference counting
-    ///          is performed for instructions currently being read or written. When the reference count reaches zero, the grow process begins.
+    ///          Therefore, the grow_flag must be set during the grow phase to prevent new threads from attempting to read or write memory. Every thread
+    ///          counts the instructions it is currently reading or writing in its own epoch record. When every thread working on the memory is quiescent,
+    ///          the grow process begins.
     ///
     /// @note    Usage example for memory operations:
     ///          ```cpp
     ///          void memory_read_operation() {
-    ///              memory_operation_guard_t guard{this->growing_flag_p, this->active_ops_p};
+    ///              memory_operation_guard_t guard{this->growing_flag_p};
     ///              // Safe to access memory here - guard ensures thread safety
     ///              // Memory access code...
     ///          }  // Guard automatically exits when function ends
@@ -293,7 +504,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
         // A type allocator must be an aligned allocator.
         using atomic_flag_allcator_t = ::fast_io::typed_generic_allocator_adapter<allocator_t, ::std::atomic_flag>;
-        using atomic_size_allcator_t = ::fast_io::typed_generic_allocator_adapter<allocator_t, ::std::atomic_size_t>;
 
         /// @brief Ensure alignment. Typically, the maximum allowed alignment size for WASM memory operation instructions is 16 (v128). Here, align to the size
         ///        of a cache line, which is usually 64.
@@ -306,9 +516,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
         unsigned custom_page_size_log2{};
 
-        // Querying lock status itself can cause race conditions, so a double-atom model is used here.
+        // Querying lock status itself can cause race conditions, so the growing flag is paired with the per-thread epoch records of
+        // `memory_operation_guard_t`.
         ::std::atomic_flag* growing_flag_p{};
-        ::std::atomic_size_t* active_ops_p{};
         // constexpr data
 
         /// @brief If mmap is not possible, it indicates that realloc is required. This means the content may grow, potentially changing the base address,
@@ -319,6 +529,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         ///        accommodate certain embedded platforms that do not support mmap but do support multithreading.
         inline static constexpr bool support_multi_thread{true};
 
+        /// @brief The buffer has no guard region, every access has to be bounds checked.
+        inline static constexpr bool can_elide_wasm32_bounds_checks{false};
+
         // function
 
         /// @brief      Default constructor.
@@ -328,9 +541,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->growing_flag_p = atomic_flag_allcator_t::allocate(1uz);
             ::new(this->growing_flag_p)::std::atomic_flag{};
 
-            this->active_ops_p = atomic_size_allcator_t::allocate(1uz);
-            ::new(this->active_ops_p)::std::atomic_size_t{};
-
             constexpr ::std::size_t default_wasm_page_size{static_cast<::std::size_t>(::uwvm2::object::memory::wasm_page::default_wasm32_page_size)};
             constexpr unsigned default_wasm_page_size_log2{static_cast<unsigned>(::std::countr_zero(default_wasm_page_size))};
             this->custom_page_size_log2 = default_wasm_page_size_log2;
@@ -341,9 +551,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->growing_flag_p = atomic_flag_allcator_t::allocate(1uz);
             ::new(this->growing_flag_p)::std::atomic_flag{};
 
-            this->active_ops_p = atomic_size_allcator_t::allocate(1uz);
-            ::new(this->active_ops_p)::std::atomic_size_t{};
-
             // The same method as set_custom_page_size, but without adding a lock.
 
             // Check if it is a power of 2
@@ -386,7 +593,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         {
             if(page_grow_size == 0uz) [[unlikely]] { return; }
 
-            if(this->growing_flag_p == nullptr || this->active_ops_p == nullptr) [[unlikely]]
+            if(this->growing_flag_p == nullptr) [[unlikely]]
             {
                 // this is a bug
                 ::uwvm2::utils::debug::trap_and_inform_bug_pos();
@@ -398,22 +605,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             // Stop-the-world: wait for all in-flight operations to finish
 
             // Wait for all existing memory read instructions to complete.
-            // acquire: observe decrements published with release; ensures quiescence is visible
-            unsigned spin_count{};
-
-            for(auto v{this->active_ops_p->load(::std::memory_order_acquire)}; v != 0uz; v = this->active_ops_p->load(::std::memory_order_acquire))
-            {
-                if(++spin_count > 1000u)
-                {
-                    // acquire: pair with operation's release decrement before proceeding after wake
-                    this->active_ops_p->wait(v, ::std::memory_order_acquire);
-                    spin_count = 0u;
-                }
-                else
-                {
-                    ::uwvm2::utils::mutex::rwlock_pause();
-                }
-            }
+            details::wait_for_memory_operations(this->growing_flag_p);
 
             if(this->memory_begin == nullptr) [[unlikely]]
             {
@@ -507,7 +699,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         {
             if(page_grow_size == 0uz) [[unlikely]] { return true; }
 
-            if(this->growing_flag_p == nullptr || this->active_ops_p == nullptr) [[unlikely]]
+            if(this->growing_flag_p == nullptr) [[unlikely]]
             {
                 // this is a bug
                 ::uwvm2::utils::debug::trap_and_inform_bug_pos();
@@ -519,22 +711,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             // Stop-the-world: wait for all in-flight operations to finish
 
             // Wait for all existing memory read instructions to complete.
-            // acquire: observe decrements published with release; ensures quiescence is visible
-            unsigned spin_count{};
-
-            for(auto v{this->active_ops_p->load(::std::memory_order_acquire)}; v != 0uz; v = this->active_ops_p->load(::std::memory_order_acquire))
-            {
-                if(++spin_count > 1000u)
-                {
-                    // acquire: pair with operation's release decrement before proceeding after wake
-                    this->active_ops_p->wait(v, ::std::memory_order_acquire);
-                    spin_count = 0u;
-                }
-                else
-                {
-                    ::uwvm2::utils::mutex::rwlock_pause();
-                }
-            }
+            details::wait_for_memory_operations(this->growing_flag_p);
 
             if(this->memory_begin == nullptr) [[unlikely]]
             {
@@ -621,13 +798,15 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
         inline constexpr ::std::size_t get_page_size() const noexcept
         {
-            memory_operation_guard_t memory_op_guard{this->growing_flag_p, this->active_ops_p};
+            memory_operation_guard_t memory_op_guard{this->growing_flag_p};
             // UB will never appear; it has been preemptively checked.
 
             // memory_op_guard destruct here
             return this->memory_length >> this->custom_page_size_log2;
         }
 
+        inline constexpr bool can_elide_bounds_checks() const noexcept { return false; }
+
         inline constexpr basic_allocator_memory_t(basic_allocator_memory_t const& other) noexcept = delete;
 
         inline constexpr basic_allocator_memory_t& operator= (basic_allocator_memory_t const& other) noexcept = delete;
@@ -640,14 +819,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->memory_length = other.memory_length;
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->growing_flag_p = other.growing_flag_p;
-            this->active_ops_p = other.active_ops_p;
 
             // clear destory other
             other.memory_begin = nullptr;
             other.memory_length = 0uz;
             other.custom_page_size_log2 = 0u;
             other.growing_flag_p = nullptr;
-            other.active_ops_p = nullptr;
         }
 
         /// @note      This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done before the
@@ -662,14 +839,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->memory_length = other.memory_length;
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->growing_flag_p = other.growing_flag_p;
-            this->active_ops_p = other.active_ops_p;
 
             // clear destory other
             other.memory_begin = nullptr;
             other.memory_length = 0uz;
             other.custom_page_size_log2 = 0u;
             other.growing_flag_p = nullptr;
-            other.active_ops_p = nullptr;
 
             return *this;
         }
@@ -697,14 +872,10 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             if(this->growing_flag_p != nullptr) [[likely]] { ::std::destroy_at(this->growing_flag_p); }
             atomic_flag_allcator_t::deallocate_n(this->growing_flag_p, 1uz);  // dealloc includes built-in nullptr checking
 
-            if(this->active_ops_p != nullptr) [[likely]] { ::std::destroy_at(this->active_ops_p); }
-            atomic_size_allcator_t::deallocate_n(this->active_ops_p, 1uz);  // dealloc includes built-in nullptr checking
-
             this->memory_length = 0uz;
             this->memory_begin = nullptr;
             this->custom_page_size_log2 = 0u;
             this->growing_flag_p = nullptr;
-            this->active_ops_p = nullptr;
         }
 
         /// @note       This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done after the
@@ -716,9 +887,6 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             if(this->growing_flag_p != nullptr) [[likely]] { ::std::destroy_at(this->growing_flag_p); }
             atomic_flag_allcator_t::deallocate_n(this->growing_flag_p, 1uz);  // dealloc includes built-in nullptr checking
 
-            if(this->active_ops_p != nullptr) [[likely]] { ::std::destroy_at(this->active_ops_p); }
-            atomic_size_allcator_t::deallocate_n(this->active_ops_p, 1uz);  // dealloc includes built-in nullptr checking
-
             // multiple call to destructor is undefined behavior, so never set to default value
         }
     };
@@ -44,8 +44,12 @@ import fast_io;
 import uwvm2.utils.container;
 import uwvm2.utils.debug;
 import uwvm2.utils.mutex;
+import uwvm2.utils.madvise;
+import uwvm2.utils.numa;
 import uwvm2.object.memory.wasm_page;
 import uwvm2.object.memory.platform_page;
+import uwvm2.object.memory.signal;
+import uwvm2.object.memory.flags;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
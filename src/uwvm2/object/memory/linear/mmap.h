@@ -43,8 +43,12 @@
 # include <uwvm2/utils/container/impl.h>
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/utils/mutex/impl.h>
+# include <uwvm2/utils/madvise/impl.h>
+# include <uwvm2/utils/numa/impl.h>
 # include <uwvm2/object/memory/wasm_page/impl.h>
 # include <uwvm2/object/memory/platform_page/impl.h>
+# include <uwvm2/object/memory/signal/impl.h>
+# include <uwvm2/object/memory/flags/impl.h>
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -72,6 +76,139 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
     inline constexpr ::std::uint_least64_t max_full_protection_wasm32_length{static_cast<::std::uint_least64_t>(1u) << 33u};     // 8 GB
     inline constexpr ::std::uint_least32_t max_partial_protection_wasm32_length{static_cast<::std::uint_least32_t>(1u) << 28u};  // 256 MB
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) &&                                       \
+     (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) && __has_include(<sys/mman.h>)  // POSIX
+    namespace details
+    {
+        struct mmap_reservation_t
+        {
+            ::std::byte* begin{};
+            ::std::size_t size{};
+        };
+
+        /// @brief      Process-wide pool of released `PROT_NONE` reservations, keyed by their page-aligned size.
+        /// @details    Every instantiation reserves several GB of address space and every teardown unmaps it; both are VMA operations serialized on the
+        ///             kernel `mmap_lock`. A released reservation is reset instead (`MADV_DONTNEED` and `PROT_NONE` over the committed prefix only) and handed
+        ///             to the next `init_by_page_count` of the same size. Reservations beyond `flags::mmap_reservation_pool_size` are unmapped as before.
+        inline ::uwvm2::utils::container::vector<mmap_reservation_t> pooled_mmap_reservations{};  // [global]
+        inline ::uwvm2::utils::mutex::mutex_t mmap_reservation_pool_lock{};                      // [global]
+
+        /// @brief      Take a pooled reservation of exactly `size` bytes starting at a multiple of `alignment`, nullptr if there is none.
+        inline ::std::byte* acquire_pooled_mmap_reservation(::std::size_t size, ::std::size_t alignment) noexcept
+        {
+            ::uwvm2::utils::mutex::mutex_guard_t pool_guard{mmap_reservation_pool_lock};
+
+            for(::std::size_t i{pooled_mmap_reservations.size()}; i != 0uz; --i)
+            {
+                auto& slot{pooled_mmap_reservations.index_unchecked(i - 1uz)};
+                if(slot.size != size || (reinterpret_cast<::std::uintptr_t>(slot.begin) & (alignment - 1uz)) != 0u) { continue; }
+
+                auto const begin{slot.begin};
+
+                // Move the last entry into the hole.
+                slot = pooled_mmap_reservations.back_unchecked();
+                pooled_mmap_reservations.pop_back_unchecked();
+
+                return begin;
+            }
+
+            return nullptr;
+        }
+
+        inline constexpr auto mmap_fixed_anonymous_flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED
+#  if defined(MAP_NORESERVE)
+                                                         | MAP_NORESERVE
+#  endif
+        };
+
+        /// @brief      Size of the huge pages used by `flags::huge_page_mode::transparent` and `flags::huge_page_mode::hugetlb`, the PMD size on x86-64 and
+        ///             AArch64 with 4 KB base pages.
+        inline constexpr ::std::size_t huge_page_size{static_cast<::std::size_t>(1u) << 21u};  // 2 MB
+
+#  if defined(__linux__) && defined(MAP_HUGETLB)
+        // The hugetlb pool is reserved when the pages are committed, so a commit that the pool cannot hold fails instead of raising SIGBUS on first touch.
+        inline constexpr auto mmap_fixed_hugetlb_flags{MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED | MAP_HUGETLB
+#   if defined(MAP_HUGE_2MB)
+                                                       | MAP_HUGE_2MB
+#   endif
+        };
+#  endif
+
+        /// @brief      Reserve `size` bytes of `PROT_NONE` address space starting at a multiple of `alignment`, nullptr if the kernel refused.
+        /// @details    Over-reserves by `alignment` bytes and unmaps the unaligned head and the rest of the tail. Both sizes are page-aligned.
+        inline ::std::byte* reserve_aligned_mmap_reservation(::std::size_t size, ::std::size_t alignment) noexcept
+        {
+            constexpr auto mmap_flags{MAP_PRIVATE |
+                                      MAP_ANONYMOUS
+#  if defined(MAP_NORESERVE)
+                                      | MAP_NORESERVE
+#  endif
+            };
+
+            if(size > ::std::numeric_limits<::std::size_t>::max() - alignment) [[unlikely]] { return nullptr; }
+
+            auto const over_reserved{::fast_io::noexcept_call(::mmap, nullptr, size + alignment, PROT_NONE, mmap_flags, -1, 0)};
+            if(over_reserved == MAP_FAILED) [[unlikely]] { return nullptr; }
+
+            auto const over_reserved_begin{reinterpret_cast<::std::byte*>(over_reserved)};
+            auto const head{static_cast<::std::size_t>(-reinterpret_cast<::std::uintptr_t>(over_reserved_begin)) & (alignment - 1uz)};
+            auto const begin{over_reserved_begin + head};
+
+            // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
+            if(head != 0uz && ::fast_io::details::sys_munmap_nothrow(over_reserved_begin, head)) [[unlikely]] { ::fast_io::fast_terminate(); }
+            if(head != alignment && ::fast_io::details::sys_munmap_nothrow(begin + size, alignment - head)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            return begin;
+        }
+
+        /// @brief      Release a reservation of `size` bytes whose first `committed_size` bytes are readable and writable. Both sizes are page-aligned.
+        /// @param      replace_prefix   The prefix cannot be reset in place: part of it is a private file mapping, which `MADV_DONTNEED` would reload from
+        ///                              the file, or it carries huge page backing or advice the next owner must not inherit.
+        /// @note       The next owner observes a zero-filled `PROT_NONE` region, exactly like a fresh `mmap`.
+        inline void release_mmap_reservation(::std::byte* begin,
+                                             ::std::size_t size,
+                                             ::std::size_t committed_size,
+                                             [[maybe_unused]] bool replace_prefix) noexcept
+        {
+            if(begin == nullptr) [[unlikely]] { return; }
+
+            if(committed_size != 0uz)
+            {
+#  if defined(__linux__) && defined(MADV_DONTNEED)
+                if(!replace_prefix)
+                {
+                    // Private anonymous pages read back as zero after MADV_DONTNEED.
+                    if(::fast_io::noexcept_call(::madvise, begin, committed_size, MADV_DONTNEED)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    if(::fast_io::noexcept_call(::mprotect, begin, committed_size, PROT_NONE)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                }
+                else
+#  endif
+                {
+                    // MADV_DONTNEED is only a hint outside Linux and reloads file pages, replacing the prefix with a fresh mapping always yields zero-filled
+                    // anonymous pages.
+                    if(::fast_io::noexcept_call(::mmap, begin, committed_size, PROT_NONE, mmap_fixed_anonymous_flags, -1, 0) == MAP_FAILED) [[unlikely]]
+                    {
+                        ::fast_io::fast_terminate();
+                    }
+                }
+            }
+
+            {
+                ::uwvm2::utils::mutex::mutex_guard_t pool_guard{mmap_reservation_pool_lock};
+
+                if(pooled_mmap_reservations.size() < ::uwvm2::object::memory::flags::mmap_reservation_pool_size)
+                {
+                    pooled_mmap_reservations.push_back(mmap_reservation_t{begin, size});
+                    return;
+                }
+            }
+
+            // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
+            if(::fast_io::details::sys_munmap_nothrow(begin, size)) [[unlikely]] { ::fast_io::fast_terminate(); }
+        }
+    }  // namespace details
+# endif
+
     /// @note      Memory safety model for the mmap-backed linear memory:
     ///            - The base pointer `memory_begin` is stable for the lifetime of the instance; growth commits additional virtual address space instead of
     ///              reallocating or moving the buffer.
@@ -83,7 +220,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
     ///              using the atomically updated `memory_length_p`.
     ///            - Because growth never relocates `memory_begin`, this backend does not require per-operation locks; concurrency is handled by the mutex used
     ///              in `grow()` together with acquire/release operations on `memory_length_p`, unlike allocator-backed memories where multi-threaded `realloc`
-    ///              would otherwise require a double-atom guard.
+    ///              would otherwise require an operation guard.
     ///            - WebAssembly linear memory is grow-only: once a given `(offset, size)` range has been validated against some length, that range remains
     ///              valid after subsequent grows, so callers do not need to re-run bounds checks for the same range after a successful grow.
 
@@ -106,6 +243,23 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         // This lock is used to prevent multithreaded growth.
         ::uwvm2::utils::mutex::mutex_t* growing_mutex_p{};
 
+        // Set once file pages have been mapped over part of the committed prefix (see `map_file_pages`). Such pages are no longer anonymous, so
+        // releasing the reservation has to replace the prefix instead of dropping it with `MADV_DONTNEED`.
+        bool file_pages_mapped{};
+
+        // Huge page backing chosen by `init_by_page_count` from `flags::huge_pages` and what the platform provides.
+        ::uwvm2::object::memory::flags::huge_page_mode huge_pages{};
+
+        // Bytes made readable and writable by init or grow, at least the length of the memory. Only changed under `growing_mutex_p`.
+        ::std::size_t committed_length{};
+
+        // Whether grow commits geometrically ahead of the length (see `commit_length`). Such memories check every access against `memory_length_p`.
+        bool commit_ahead{};
+
+        // Set while the reservation carries a policy preferring `numa_node`, from `flags::numa_local` or `migrate_to_numa_node`.
+        bool numa_bound{};
+        unsigned numa_node{};
+
         /// @brief This macro is used to control the behavior of the non-img compiler.
         inline static constexpr bool can_mmap{true};
 
@@ -113,6 +267,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         ///        dynamic determination of `memory_size` is unnecessary.
         inline static constexpr bool support_multi_thread{true};
 
+        /// @brief On 64-bit hosts a wasm32 memory reserves `max_full_protection_wasm32_length` plus guard bytes, which covers every `u32 + u32` effective
+        ///        address. Engines may then emit loads and stores without software bounds checks when `can_elide_bounds_checks()` holds, an out of bounds
+        ///        access faults in the reservation and is reported through the registered protected segment.
+        inline static constexpr bool can_elide_wasm32_bounds_checks{sizeof(::std::size_t) >= sizeof(::std::uint_least64_t)};
+
         /// @brief      Default constructor.
         /// @note       The default page size is 65536 bytes.
         inline constexpr mmap_memory_t() noexcept
@@ -149,17 +308,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->status = memory_status;
         }
 
-        inline constexpr bool require_dynamic_determination_memory_size() const noexcept
+        /// @brief      The granularity in which pages are committed: the platform page size, or the huge page size for hugetlb-backed memories.
+        inline constexpr ::std::size_t get_commit_page_size() const noexcept
         {
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) &&                                       \
+     (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) && __has_include(<sys/mman.h>)  // POSIX
+            if(this->huge_pages == ::uwvm2::object::memory::flags::huge_page_mode::hugetlb) { return details::huge_page_size; }
+# endif
+
             auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
             if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
+            if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            return page_size;
+        }
+
+        inline constexpr bool require_dynamic_determination_memory_size() const noexcept
+        {
+            auto const page_size{this->get_commit_page_size()};
 
             // UB will never appear; it has been preemptively checked.
             auto const custom_page_size{1uz << this->custom_page_size_log2};
 
             // When `custom_page_size` is less than one page, `mmap` can only guarantee the stability of the starting address and cannot provide page protection
             // checks. Additional dynamic verification is required.
-            return custom_page_size < page_size;
+            // Pages committed ahead of the length are accessible as well, so such memories are checked in software too.
+            return custom_page_size < page_size || this->commit_ahead;
         }
 
         inline constexpr bool is_full_page_protection() const noexcept
@@ -200,6 +374,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             }
         }
 
+        /// @brief      Whether page protection alone rejects every out of bounds wasm32 access: the reservation covers the whole effective address range
+        ///             and the committed length is a multiple of the platform page size.
+        inline constexpr bool can_elide_bounds_checks() const noexcept
+        {
+            if constexpr(can_elide_wasm32_bounds_checks) { return this->is_full_page_protection() && !this->require_dynamic_determination_memory_size(); }
+            else
+            {
+                return false;
+            }
+        }
+
         /// @brief      Initialize the memory.
         /// @note       Maximum value checks are not provided; maximum value checks should be performed outside of memory management.
         /// @note       You can use it after clear().
@@ -369,18 +554,64 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
                     };
 
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    try
+                    this->huge_pages = ::uwvm2::object::memory::flags::huge_pages;
+#  if !defined(__linux__) || !defined(MADV_HUGEPAGE)
+                    this->huge_pages = ::uwvm2::object::memory::flags::huge_page_mode::none;
+#  elif !defined(MAP_HUGETLB)
+                    if(this->huge_pages == ::uwvm2::object::memory::flags::huge_page_mode::hugetlb)
+                    {
+                        this->huge_pages = ::uwvm2::object::memory::flags::huge_page_mode::transparent;
+                    }
 #  endif
+
+                    auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+                    if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+                    // Huge page backed reservations start at a huge page boundary and cover whole huge pages, so that the kernel can back every huge page
+                    // of the memory and hugetlb commits never cross the end of the reservation.
+                    bool const huge_reservation{this->huge_pages != ::uwvm2::object::memory::flags::huge_page_mode::none};
+                    auto const reservation_alignment{huge_reservation ? details::huge_page_size : page_size};
+
+                    auto const reservation_alignment_minus_1{(reservation_alignment - 1uz)};
+                    if(max_space > ::std::numeric_limits<::std::size_t>::max() - reservation_alignment_minus_1) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    auto const max_space_ceil{(max_space + reservation_alignment_minus_1) & ~reservation_alignment_minus_1};
+
+                    // A recycled reservation is already zero-filled and `PROT_NONE`.
+                    this->memory_begin = details::acquire_pooled_mmap_reservation(max_space_ceil, reservation_alignment);
+
+                    if(this->memory_begin == nullptr && huge_reservation)
                     {
-                        this->memory_begin = ::fast_io::details::sys_mmap(nullptr, max_space, PROT_NONE, mmap_flags, -1, 0u);
+                        this->memory_begin = details::reserve_aligned_mmap_reservation(max_space_ceil, reservation_alignment);
+                        if(this->memory_begin == nullptr) [[unlikely]] { ::fast_io::fast_terminate(); }
                     }
+
+                    if(this->memory_begin == nullptr)
+                    {
+#  ifdef UWVM_CPP_EXCEPTIONS
+                        try
+#  endif
+                        {
+                            this->memory_begin = ::fast_io::details::sys_mmap(nullptr, max_space_ceil, PROT_NONE, mmap_flags, -1, 0u);
+                        }
 #  ifdef UWVM_CPP_EXCEPTIONS
-                    catch(::fast_io::error)
+                        catch(::fast_io::error)
+                        {
+                            ::fast_io::fast_terminate();
+                        }
+#  endif
+                    }
+
+                    // The policy is set before any page is committed, so every page of the memory comes from the node of the initializing thread, whichever
+                    // thread touches it first.
+                    if(::uwvm2::object::memory::flags::numa_local)
                     {
-                        ::fast_io::fast_terminate();
+                        if(auto const [node, node_success]{::uwvm2::utils::numa::get_current_numa_node()}; node_success)
+                        {
+                            this->numa_bound = ::uwvm2::utils::numa::prefer_numa_node(this->memory_begin, max_space_ceil, node, false);
+                            this->numa_node = node;
+                        }
                     }
-#  endif
                 }
 # endif
 
@@ -413,32 +644,22 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // POSIX
                 {
-
-                    // sys_mprotect may throw ::fast_io::error
-
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    try
-#  endif
+                    if(!this->commit_pages(0uz, memory_length))
                     {
-                        // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
-                        // Since custom_page may appear, it must be aligned to the top here.
+                        // The hugetlb pool cannot hold the initial memory, back it with transparent huge pages instead. The reservation is already aligned.
+                        if(this->huge_pages != ::uwvm2::object::memory::flags::huge_page_mode::hugetlb) [[unlikely]] { ::fast_io::fast_terminate(); }
 
-                        auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                        if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
-                        if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
+                        this->huge_pages = ::uwvm2::object::memory::flags::huge_page_mode::transparent;
+                        if(!this->commit_pages(0uz, memory_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                    }
 
-                        auto const page_size_minus_1{(page_size - 1uz)};
-                        if(memory_length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { ::fast_io::fast_terminate(); }
-                        auto const memory_length_ceil{(memory_length + page_size_minus_1) & ~page_size_minus_1};
+                    this->committed_length = memory_length;
 
-                        ::fast_io::details::sys_mprotect(this->memory_begin, memory_length_ceil, PROT_READ | PROT_WRITE);
-                    }
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    catch(::fast_io::error)
-                    {
-                        ::fast_io::fast_terminate();
-                    }
-#  endif
+                    // Memories that are checked in software anyway always commit ahead. hugetlb memories already commit whole huge pages and would pin
+                    // pool pages the guest never asked for.
+                    bool const software_bounds_checks{this->require_dynamic_determination_memory_size()};
+                    this->commit_ahead = this->huge_pages != ::uwvm2::object::memory::flags::huge_page_mode::hugetlb &&
+                                         (software_bounds_checks || ::uwvm2::object::memory::flags::grow_commit_ahead);
                 }
 # endif
 
@@ -572,32 +793,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // posix
             {
-
-                // sys_mprotect may throw ::fast_io::error
-
-#  ifdef UWVM_CPP_EXCEPTIONS
-                try
-#  endif
-                {
-                    // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
-                    // Since custom_page may appear, it must be aligned to the top here.
-
-                    auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                    if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
-                    if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
-
-                    auto const page_size_minus_1{(page_size - 1uz)};
-                    if(grow_final_memory_length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { ::fast_io::fast_terminate(); }
-                    auto const grow_final_memory_length_ceil{(grow_final_memory_length + page_size_minus_1) & ~page_size_minus_1};
-
-                    ::fast_io::details::sys_mprotect(this->memory_begin, grow_final_memory_length_ceil, PROT_READ | PROT_WRITE);
-                }
-#  ifdef UWVM_CPP_EXCEPTIONS
-                catch(::fast_io::error)
-                {
-                    ::fast_io::fast_terminate();
-                }
-#  endif
+                if(!this->commit_length(grow_final_memory_length, max_limit_memory_length)) [[unlikely]] { ::fast_io::fast_terminate(); }
             }
 # endif
 
@@ -743,58 +939,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // posix
             {
-                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                if(!success) [[unlikely]]
-                {
-                    // this never occurs; it is due to user input error.
-                    ::fast_io::fast_terminate();
-                }
-                if(page_size == 0uz) [[unlikely]]
-                {
-                    // this never occurs; it is due to user input error.
-                    ::fast_io::fast_terminate();
-                }
-
-                auto const page_size_minus_1{(page_size - 1uz)};
-
-                if(current_length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { return false; }
-                auto const current_length_ceil{(current_length + page_size_minus_1) & ~page_size_minus_1};
-
-                if(grow_final_memory_length > ::std::numeric_limits<::std::size_t>::max() - page_size_minus_1) [[unlikely]] { return false; }
-                auto const grow_final_memory_length_ceil{(grow_final_memory_length + page_size_minus_1) & ~page_size_minus_1};
-
-                if(grow_final_memory_length_ceil > current_length_ceil)
-                {
-                    auto const protect_delta{grow_final_memory_length_ceil - current_length_ceil};
-                    auto const protect_begin{this->memory_begin + current_length_ceil};
-
-                    // sys_mprotect may throw ::fast_io::error
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    try
-#  endif
-                    {
-                        ::fast_io::details::sys_mprotect(reinterpret_cast<void*>(protect_begin), protect_delta, PROT_READ | PROT_WRITE);
-                    }
-#  ifdef UWVM_CPP_EXCEPTIONS
-                    catch(::fast_io::error)
-                    {
-#   ifdef UWVM_CPP_EXCEPTIONS
-                        try
-#   endif
-                        {
-                            // Ensure failure is not partially committed; otherwise, OOB may stop faulting in full-protection mode.
-                            ::fast_io::details::sys_mprotect(reinterpret_cast<void*>(protect_begin), protect_delta, PROT_NONE);
-                        }
-#   ifdef UWVM_CPP_EXCEPTIONS
-                        catch(::fast_io::error)
-                        {
-                            // do nothing
-                        }
-#   endif
-                        return false;
-                    }
-#  endif
-                }
+                if(!this->commit_length(grow_final_memory_length, max_limit_memory_length)) { return false; }
             }
 # endif
 
@@ -829,6 +974,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->status = other.status;
             this->growing_mutex_p = other.growing_mutex_p;
+            this->file_pages_mapped = other.file_pages_mapped;
+            this->huge_pages = other.huge_pages;
+            this->committed_length = other.committed_length;
+            this->commit_ahead = other.commit_ahead;
+            this->numa_bound = other.numa_bound;
+            this->numa_node = other.numa_node;
 
             // clear destory other
             other.memory_begin = nullptr;
@@ -836,6 +987,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             other.custom_page_size_log2 = 0u;
             other.status = mmap_memory_status_t{};
             other.growing_mutex_p = nullptr;
+            other.file_pages_mapped = false;
+            other.huge_pages = ::uwvm2::object::memory::flags::huge_page_mode{};
+            other.committed_length = 0uz;
+            other.commit_ahead = false;
+            other.numa_bound = false;
+            other.numa_node = 0u;
         }
 
         /// @note      This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done before the
@@ -851,6 +1008,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = other.custom_page_size_log2;
             this->status = other.status;
             this->growing_mutex_p = other.growing_mutex_p;
+            this->file_pages_mapped = other.file_pages_mapped;
+            this->huge_pages = other.huge_pages;
+            this->committed_length = other.committed_length;
+            this->commit_ahead = other.commit_ahead;
+            this->numa_bound = other.numa_bound;
+            this->numa_node = other.numa_node;
 
             // clear destory other
             other.memory_begin = nullptr;
@@ -858,6 +1021,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             other.custom_page_size_log2 = 0u;
             other.status = mmap_memory_status_t{};
             other.growing_mutex_p = nullptr;
+            other.file_pages_mapped = false;
+            other.huge_pages = ::uwvm2::object::memory::flags::huge_page_mode{};
+            other.committed_length = 0uz;
+            other.commit_ahead = false;
+            other.numa_bound = false;
+            other.numa_node = 0u;
 
             return *this;
         }
@@ -920,6 +1089,188 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             return max_space;
         }
 
+# if !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) &&                                       \
+     (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) && __has_include(<sys/mman.h>)  // POSIX
+        /// @brief      Hand the reservation to `details::release_mmap_reservation`, which resets the committed prefix and pools it for the next instance.
+        /// @note       The protected segment registered for this reservation is dropped first, otherwise the next owner could not register the same range.
+        inline constexpr void release_reservation() noexcept
+        {
+            if(this->memory_begin == nullptr) { return; }
+
+            // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
+            // Since custom_page may appear, it must be aligned to the top here.
+
+            auto const commit_page_size{this->get_commit_page_size()};
+            bool const huge_reservation{this->huge_pages != ::uwvm2::object::memory::flags::huge_page_mode::none};
+
+            auto const acquire_reserved_space{get_acquire_reserved_space()};
+            auto const acquire_reserved_space_ceil{this->get_reservation_size()};
+
+            // Only the pages made readable and writable by init or grow have to be dropped and protected again.
+            // This can only be used after the WASM execution has completed, so use relaxed instead of acquired.
+            auto const committed_length_ceil{(this->committed_length + (commit_page_size - 1uz)) & ~(commit_page_size - 1uz)};
+
+            ::uwvm2::object::memory::signal::unregister_protected_segment(this->memory_begin, this->memory_begin + acquire_reserved_space);
+
+            // The policy belongs to the reservation, the next owner must not inherit it.
+            if(this->numa_bound) { ::uwvm2::utils::numa::reset_numa_policy(this->memory_begin, acquire_reserved_space_ceil); }
+
+            details::release_mmap_reservation(this->memory_begin,
+                                              acquire_reserved_space_ceil,
+                                              committed_length_ceil,
+                                              this->file_pages_mapped || huge_reservation);
+            this->file_pages_mapped = false;
+            this->huge_pages = ::uwvm2::object::memory::flags::huge_page_mode::none;
+            this->committed_length = 0uz;
+            this->commit_ahead = false;
+            this->numa_bound = false;
+            this->numa_node = 0u;
+        }
+
+        /// @brief      Size of the reservation as mapped: whole huge pages for huge page backed memories, whole platform pages otherwise.
+        inline constexpr ::std::size_t get_reservation_size() const noexcept
+        {
+            bool const huge_reservation{this->huge_pages != ::uwvm2::object::memory::flags::huge_page_mode::none};
+            auto const reservation_alignment{huge_reservation ? details::huge_page_size : this->get_commit_page_size()};
+
+            // Overflow "all_memory_length + (page_size - 1uz)" will never occur here because such a situation cannot be allocated.
+            return (get_acquire_reserved_space() + (reservation_alignment - 1uz)) & ~(reservation_alignment - 1uz);
+        }
+
+        /// @brief      Prefer `node` for every page of the memory from now on and migrate the pages already committed.
+        /// @return     false if the platform refused or does not support NUMA policies, the memory then keeps its previous placement.
+        /// @note       Can run while the memory is in use: the kernel serializes the policy change with grows, and pages are copied before they are
+        ///             remapped.
+        inline bool migrate_to_numa_node(unsigned node) noexcept
+        {
+            if(this->memory_begin == nullptr) [[unlikely]] { return false; }
+
+            if(!::uwvm2::utils::numa::prefer_numa_node(this->memory_begin, this->get_reservation_size(), node, true)) { return false; }
+
+            this->numa_bound = true;
+            this->numa_node = node;
+            return true;
+        }
+
+        /// @brief      Make `[0, final_length)` readable and writable. Memories with `commit_ahead` double the committed length instead, capped by
+        ///             `max_commit_length`, so that a guest growing one page at a time does not pay an `mprotect` (and the `mmap_lock`) per `memory.grow`.
+        /// @return     false if the platform refused to commit even `final_length`.
+        /// @note       The length of the memory is unaffected, accesses past it are rejected by the software bounds checks of such memories.
+        inline bool commit_length(::std::size_t final_length, ::std::size_t max_commit_length) noexcept
+        {
+            if(final_length <= this->committed_length) { return true; }
+
+            if(this->commit_ahead)
+            {
+                constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+                auto const doubled_length{this->committed_length > size_t_max / 2uz ? size_t_max : this->committed_length * 2uz};
+                auto const ahead_length{::std::min(::std::max(doubled_length, final_length), ::std::max(max_commit_length, final_length))};
+
+                // Committing ahead is only an optimization, fall back to the exact length if the platform refuses.
+                if(ahead_length > final_length && this->commit_pages(this->committed_length, ahead_length))
+                {
+                    this->committed_length = ahead_length;
+                    return true;
+                }
+            }
+
+            if(!this->commit_pages(this->committed_length, final_length)) { return false; }
+
+            this->committed_length = final_length;
+            return true;
+        }
+
+        /// @brief      Make `[current_length, final_length)` readable and writable, rounded up to whole commit pages. Pages below `current_length` are
+        ///             already committed.
+        /// @return     false if the platform refused, nothing new is committed then.
+        inline bool commit_pages(::std::size_t current_length, ::std::size_t final_length) noexcept
+        {
+            auto const commit_page_size{this->get_commit_page_size()};
+            auto const commit_page_size_minus_1{commit_page_size - 1uz};
+
+            if(final_length > ::std::numeric_limits<::std::size_t>::max() - commit_page_size_minus_1) [[unlikely]] { return false; }
+            auto const current_length_ceil{(current_length + commit_page_size_minus_1) & ~commit_page_size_minus_1};
+            auto const final_length_ceil{(final_length + commit_page_size_minus_1) & ~commit_page_size_minus_1};
+
+            if(final_length_ceil <= current_length_ceil) { return true; }
+
+            auto const commit_begin{this->memory_begin + current_length_ceil};
+            auto const commit_delta{final_length_ceil - current_length_ceil};
+
+#  if defined(__linux__) && defined(MAP_HUGETLB)
+            if(this->huge_pages == ::uwvm2::object::memory::flags::huge_page_mode::hugetlb)
+            {
+                if(::fast_io::noexcept_call(::mmap, commit_begin, commit_delta, PROT_READ | PROT_WRITE, details::mmap_fixed_hugetlb_flags, -1, 0) !=
+                   MAP_FAILED) [[likely]]
+                {
+                    // A new mapping starts without the NUMA policy of the reservation.
+                    if(this->numa_bound) { ::uwvm2::utils::numa::prefer_numa_node(commit_begin, commit_delta, this->numa_node, false); }
+                    return true;
+                }
+
+                // A failed MAP_FIXED may already have removed the reserved pages, put the reservation back so that out of bounds accesses still fault.
+                if(::fast_io::noexcept_call(::mmap, commit_begin, commit_delta, PROT_NONE, details::mmap_fixed_anonymous_flags, -1, 0) == MAP_FAILED)
+                    [[unlikely]]
+                {
+                    ::fast_io::fast_terminate();
+                }
+
+                return false;
+            }
+#  endif
+
+            if(::fast_io::noexcept_call(::mprotect, commit_begin, commit_delta, PROT_READ | PROT_WRITE)) [[unlikely]]
+            {
+                // Ensure failure is not partially committed; otherwise, OOB may stop faulting in full-protection mode.
+                ::fast_io::noexcept_call(::mprotect, commit_begin, commit_delta, PROT_NONE);
+                return false;
+            }
+
+            if(this->huge_pages == ::uwvm2::object::memory::flags::huge_page_mode::transparent)
+            {
+                // Only a hint: whole huge pages of the memory are collapsed when the kernel has them, the rest stays in platform pages.
+                ::uwvm2::utils::madvise::my_madvise(commit_begin, commit_delta, ::uwvm2::utils::madvise::madvise_flag::hugepage);
+            }
+
+            return true;
+        }
+
+        /// @brief      Map `length` bytes of the file `fd` at `file_offset` copy-on-write over `[memory_begin + offset, memory_begin + offset + length)`,
+        ///             so that only the pages the module actually touches are read from the file. All three values must be page-aligned and the range must
+        ///             lie in the committed prefix.
+        /// @return     false if the kernel refused the mapping, the range then holds zero-filled pages and the caller copies the bytes instead.
+        /// @note       Like `native_file_loader`, the mapping follows later writes to the file for pages that have not been written by the module.
+        /// @note       This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done before the
+        ///             WASM execution.
+        inline bool map_file_pages(::std::size_t offset, ::std::size_t length, int fd, ::std::uint_least64_t file_offset) noexcept
+        {
+            if(this->memory_begin == nullptr || length == 0uz) [[unlikely]] { return false; }
+            if(file_offset > static_cast<::std::uint_least64_t>(::std::numeric_limits<off_t>::max())) [[unlikely]] { return false; }
+            // File pages cannot be placed inside a hugetlb mapping.
+            if(this->huge_pages == ::uwvm2::object::memory::flags::huge_page_mode::hugetlb) { return false; }
+
+            // The pages are no longer anonymous even if the mapping below fails halfway.
+            this->file_pages_mapped = true;
+
+            auto const address{this->memory_begin + offset};
+            if(::fast_io::noexcept_call(::mmap, address, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, static_cast<off_t>(file_offset)) !=
+               MAP_FAILED) [[likely]]
+            {
+                // A new mapping starts without the NUMA policy of the reservation, pages copied on write follow it again.
+                if(this->numa_bound) { ::uwvm2::utils::numa::prefer_numa_node(address, length, this->numa_node, false); }
+                return true;
+            }
+
+            // A failed MAP_FIXED may already have removed the previous pages, put zero-filled committed pages back.
+            if(::fast_io::noexcept_call(::mmap, address, length, PROT_READ | PROT_WRITE, details::mmap_fixed_anonymous_flags, -1, 0) == MAP_FAILED) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            return false;
+        }
+# endif
+
         /// @brief      Clear the memory.
         /// @note       Simply clearing the memory without altering the page size.
         /// @note       This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done after the
@@ -949,16 +1300,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // posix
             {
-                // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
-                // Since custom_page may appear, it must be aligned to the top here.
-
-                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
-
-                auto const acquire_reserved_space_ceil{(get_acquire_reserved_space() + page_size - 1uz) & ~(page_size - 1uz)};
-
-                // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                if(::fast_io::details::sys_munmap_nothrow(this->memory_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                release_reservation();
             }
 # endif
 
@@ -1009,16 +1351,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // posix
             {
-                // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
-                // Since custom_page may appear, it must be aligned to the top here.
-
-                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
-
-                auto const acquire_reserved_space_ceil{(get_acquire_reserved_space() + page_size - 1uz) & ~(page_size - 1uz)};
-
-                // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                if(::fast_io::details::sys_munmap_nothrow(this->memory_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                release_reservation();
             }
 # endif
 
@@ -1033,6 +1366,12 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
             this->custom_page_size_log2 = 0u;
             this->status = mmap_memory_status_t{};
             this->growing_mutex_p = nullptr;
+            this->file_pages_mapped = false;
+            this->huge_pages = ::uwvm2::object::memory::flags::huge_page_mode{};
+            this->committed_length = 0uz;
+            this->commit_ahead = false;
+            this->numa_bound = false;
+            this->numa_node = 0u;
         }
 
         /// @note       This function is designed to be lock-free and cannot be executed during WASM execution (multi-threaded). It can only be done after the
@@ -1067,18 +1406,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 # elif !defined(__NEWLIB__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || (defined(__wasi__) && defined(_WASI_EMULATED_MMAN))) &&   \
      __has_include(<sys/mman.h>)  // posix
             {
-                // The length argument must be a multiple of the page size as returned by sysconf(_SC_PAGE_SIZE).
-                // Since custom_page may appear, it must be aligned to the top here.
-
-                auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
-                if(!success) [[unlikely]] { ::fast_io::fast_terminate(); }
-                if(page_size == 0uz) [[unlikely]] { ::fast_io::fast_terminate(); }
-
-                // Overflow "all_memory_length + (page_size - 1uz)" will never occur here because such a situation cannot be allocated.
-                auto const acquire_reserved_space_ceil{(get_acquire_reserved_space() + (page_size - 1uz)) & ~(page_size - 1uz)};
-
-                // fast_io::details::sys_munmap_nothrow is noexcept, manually throws exceptions.
-                if(::fast_io::details::sys_munmap_nothrow(this->memory_begin, acquire_reserved_space_ceil)) [[unlikely]] { ::fast_io::fast_terminate(); }
+                release_reservation();
             }
 # endif
 
@@ -74,6 +74,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
         // constexpr data
         inline static constexpr bool can_mmap{false};
         inline static constexpr bool support_multi_thread{false};
+        inline static constexpr bool can_elide_wasm32_bounds_checks{false};
 
         // function
 
@@ -283,6 +284,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::linear
 
         inline constexpr ::std::size_t get_page_size() const noexcept { return this->memory_length >> this->custom_page_size_log2; }
 
+        inline constexpr bool can_elide_bounds_checks() const noexcept { return false; }
+
         inline constexpr basic_single_thread_allocator_memory_t(basic_single_thread_allocator_memory_t const& other) noexcept = delete;
 
         inline constexpr basic_single_thread_allocator_memory_t& operator= (basic_single_thread_allocator_memory_t const& other) noexcept = delete;
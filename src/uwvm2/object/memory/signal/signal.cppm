@@ -43,6 +43,7 @@ import fast_io;
 import uwvm2.uwvm_predefine.io;
 import uwvm2.uwvm_predefine.utils.ansies;
 import uwvm2.utils.container;
+import uwvm2.utils.mutex;
 import uwvm2.object.memory.error;
 
 #ifndef UWVM_MODULE
@@ -42,6 +42,7 @@
 # include <uwvm2/uwvm_predefine/io/impl.h>
 # include <uwvm2/uwvm_predefine/utils/ansies/impl.h>
 # include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
 # include <uwvm2/object/memory/error/impl.h>
 #endif
 
@@ -90,9 +91,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
         ::std::size_t memory_idx{};
     };
 
+    /// @brief      Reports a fault inside a protected segment in place of the default page protection message, so that an engine relying on the guard
+    ///             region can report it as its own out of bounds trap. It runs in the signal handler and must not return.
+    using protected_fault_handler_t = void (*)(protected_memory_segment_t const& seg, ::std::byte const* fault_addr) noexcept;
+
+    inline protected_fault_handler_t protected_fault_handler{};  // [global]
+
     namespace detail
     {
-        inline ::uwvm2::utils::container::vector<protected_memory_segment_t> segments{};  // [global]
+        /// @brief      Published snapshot of the protected segments, sorted by `begin` and non-overlapping. A snapshot is never modified: register
+        ///             and unregister build a new one and swap it in, so the signal handler reads it without locks (RCU style).
+        struct protected_segment_table_t
+        {
+            protected_memory_segment_t* segments{};
+            ::std::size_t size{};
+        };
+
+        using segment_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, protected_memory_segment_t>;
+        using segment_table_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, protected_segment_table_t>;
+
+        inline ::std::atomic<protected_segment_table_t const*> segment_table{};  // [global]
+
+        // Signal handlers currently reading a snapshot. A replaced snapshot is freed once this dropped to zero after the swap (grace period).
+        inline ::std::atomic_size_t segment_table_readers{};  // [global]
+
+        // Serializes the writers. Never taken by the signal handler.
+        inline ::uwvm2::utils::mutex::mutex_t segment_table_lock{};  // [global]
 
         struct signal_handlers_t
         {
@@ -126,21 +150,109 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
                     .memory_length = static_cast<::std::uint_least64_t>(memory_length)};
         }
 
-        inline constexpr bool handle_fault_address(::std::byte const* fault_addr) noexcept
+        /// @brief      Index of the first segment of `table` that begins after `addr`.
+        inline constexpr ::std::size_t upper_bound_segment(protected_segment_table_t const& table, ::std::byte const* addr) noexcept
         {
-            if(fault_addr == nullptr) [[unlikely]] { return false; }
+            ::std::size_t low{};
+            ::std::size_t high{table.size};
+            while(low != high)
+            {
+                auto const mid{low + (high - low) / 2uz};
+                if(table.segments[mid].begin <= addr) { low = mid + 1uz; }
+                else
+                {
+                    high = mid;
+                }
+            }
+            return low;
+        }
+
+        /// @brief      Copy the segment containing `fault_addr` into `out`. Async-signal-safe: lock-free atomics and a binary search of the
+        ///             published snapshot.
+        inline constexpr bool find_protected_segment(::std::byte const* fault_addr, protected_memory_segment_t& out) noexcept
+        {
+            // Announce the reader before loading the snapshot, the writer checks the count after the swap (both sequentially consistent).
+            segment_table_readers.fetch_add(1uz);
 
-            for(auto const& seg: segments)
+            bool found{};
+            if(auto const table{segment_table.load()}; table != nullptr)
             {
-                if(seg.begin <= fault_addr && fault_addr < seg.end)
+                auto const index{upper_bound_segment(*table, fault_addr)};
+                if(index != 0uz && fault_addr < table->segments[index - 1uz].end)
                 {
-                    auto const mmapmemerr{make_mmap_memory_error(seg, fault_addr)};
-                    ::uwvm2::object::memory::error::output_mmap_memory_error_and_terminate(mmapmemerr);
-                    ::std::unreachable();
+                    out = table->segments[index - 1uz];
+                    found = true;
                 }
             }
 
-            return false;
+            segment_table_readers.fetch_sub(1uz, ::std::memory_order_release);
+            return found;
+        }
+
+        inline constexpr bool handle_fault_address(::std::byte const* fault_addr) noexcept
+        {
+            if(fault_addr == nullptr) [[unlikely]] { return false; }
+
+            // The copy stays valid after the snapshot is left, the fault handler may not return.
+            protected_memory_segment_t seg;  // No initialization necessary
+            if(!find_protected_segment(fault_addr, seg)) { return false; }
+
+            // Only the guard region past the memory length traps. A fault inside the memory means its backing is gone (such as a file mapping
+            // whose file was truncated, raising SIGBUS), execution cannot continue against it.
+            if(static_cast<::std::size_t>(fault_addr - seg.begin) < get_memory_length(seg)) [[unlikely]]
+            {
+                ::uwvm2::object::memory::error::output_mmap_memory_error_and_terminate(make_mmap_memory_error(seg, fault_addr));
+            }
+
+            if(auto const fault_handler{protected_fault_handler}; fault_handler != nullptr)
+            {
+                fault_handler(seg, fault_addr);
+                ::std::unreachable();
+            }
+
+            auto const mmapmemerr{make_mmap_memory_error(seg, fault_addr)};
+            ::uwvm2::object::memory::error::output_mmap_memory_error_and_terminate(mmapmemerr);
+            ::std::unreachable();
+        }
+
+        /// @brief      Swap in `segments[0, size)` (owned by the table from now on) and free the replaced snapshot after the grace period. The
+        ///             caller holds `segment_table_lock`.
+        inline void publish_segment_table(protected_memory_segment_t* segments, ::std::size_t size) noexcept
+        {
+            protected_segment_table_t* table{};
+            if(size != 0uz)
+            {
+                table = segment_table_allocator_t::allocate(1uz);
+                ::new(table) protected_segment_table_t{segments, size};
+            }
+
+            auto const retired{segment_table.exchange(table)};
+
+            // A handler that loaded `retired` is counted until it copied its segment out.
+            while(segment_table_readers.load() != 0uz) { ::uwvm2::utils::mutex::rwlock_pause(); }
+
+            if(retired != nullptr)
+            {
+                segment_allocator_t::deallocate_n(retired->segments, retired->size);
+                segment_table_allocator_t::deallocate_n(const_cast<protected_segment_table_t*>(retired), 1uz);
+            }
+        }
+
+        [[noreturn]] inline void invalid_protected_segment() noexcept
+        {
+# ifdef UWVM
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                u8"[fatal] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"Invalid protected memory segment.\n\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+# else
+            ::fast_io::io::perr(::fast_io::u8err(), u8"uwvm: [fatal] Invalid protected memory segment.\n\n");
+# endif
+            ::fast_io::fast_terminate();
         }
 
 # if defined(_WIN32) || defined(__CYGWIN__)
@@ -302,57 +414,66 @@ UWVM_MODULE_EXPORT namespace uwvm2::object::memory::signal
 # endif
     }  // namespace detail
 
-    /// @note       Protected memory segments are expected to be registered during VM/module initialization,
-    ///             before any guest code that may trigger memory access violations is executed. After
-    ///             initialization, the set of segments is treated as structurally immutable (only the
-    ///             dynamic length, when provided via @p length_p, may change), and no further calls to
-    ///             register_protected_segment, unregister_protected_segment, or clear_protected_segments
-    ///             are performed. This design ensures that the signal/exception handler can traverse the
-    ///             global segments container without additional synchronization, as there are no
-    ///             concurrent structural modifications.
+    /// @note       Segments may be registered and unregistered at any time, also while other threads run guest code. Writers are serialized
+    ///             and publish a new sorted snapshot, the signal/exception handler looks the fault address up in the current snapshot with a binary
+    ///             search and no locks. A segment must be unregistered before its memory is released.
 
+    /// @brief      Register `[begin, end)`. Overlapping an already registered segment is fatal.
     inline constexpr void register_protected_segment(::std::byte const* begin,
                                                      ::std::byte const* end,
                                                      ::std::atomic_size_t const* length_p = nullptr,
                                                      ::std::size_t memory_idx = 0uz) noexcept
     {
-        if(begin == nullptr || end == nullptr || begin >= end) [[unlikely]]
-        {
-# ifdef UWVM
-            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                u8"uwvm: ",
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                u8"[fatal] ",
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                u8"Invalid protected memory segment.\n\n",
-                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-# else
-            ::fast_io::io::perr(::fast_io::u8err(), u8"uwvm: [fatal] Invalid protected memory segment.\n\n");
-# endif
-            ::fast_io::fast_terminate();
-        }
+        if(begin == nullptr || end == nullptr || begin >= end) [[unlikely]] { detail::invalid_protected_segment(); }
 
         detail::install_signal_handler();
-        detail::segments.emplace_back(begin, end, length_p, memory_idx);
+
+        ::uwvm2::utils::mutex::mutex_guard_t segment_table_guard{detail::segment_table_lock};
+
+        auto const table{detail::segment_table.load()};
+        auto const old_size{table == nullptr ? 0uz : table->size};
+        auto const index{table == nullptr ? 0uz : detail::upper_bound_segment(*table, begin)};
+
+        if(index != 0uz && begin < table->segments[index - 1uz].end) [[unlikely]] { detail::invalid_protected_segment(); }
+        if(index != old_size && table->segments[index].begin < end) [[unlikely]] { detail::invalid_protected_segment(); }
+
+        auto const segments{detail::segment_allocator_t::allocate(old_size + 1uz)};
+        for(::std::size_t i{}; i != index; ++i) { segments[i] = table->segments[i]; }
+        segments[index] = {begin, end, length_p, memory_idx};
+        for(::std::size_t i{index}; i != old_size; ++i) { segments[i + 1uz] = table->segments[i]; }
+
+        detail::publish_segment_table(segments, old_size + 1uz);
     }
 
     inline constexpr void unregister_protected_segment(::std::byte const* begin, ::std::byte const* end) noexcept
     {
         if(begin == nullptr || end == nullptr) [[unlikely]] { return; }
 
-        auto& segments{detail::segments};
-        for(auto it{segments.begin()}; it != segments.end(); ++it)
+        ::uwvm2::utils::mutex::mutex_guard_t segment_table_guard{detail::segment_table_lock};
+
+        auto const table{detail::segment_table.load()};
+        if(table == nullptr) { return; }
+
+        auto const index{detail::upper_bound_segment(*table, begin)};
+        if(index == 0uz || table->segments[index - 1uz].begin != begin || table->segments[index - 1uz].end != end) { return; }
+
+        auto const new_size{table->size - 1uz};
+        protected_memory_segment_t* segments{};
+        if(new_size != 0uz)
         {
-            if(it->begin == begin && it->end == end)
-            {
-                segments.erase(it);
-                return;
-            }
+            segments = detail::segment_allocator_t::allocate(new_size);
+            for(::std::size_t i{}; i != index - 1uz; ++i) { segments[i] = table->segments[i]; }
+            for(::std::size_t i{index}; i != table->size; ++i) { segments[i - 1uz] = table->segments[i]; }
         }
+
+        detail::publish_segment_table(segments, new_size);
     }
 
-    inline constexpr void clear_protected_segments() noexcept { detail::segments.clear(); }
+    inline constexpr void clear_protected_segments() noexcept
+    {
+        ::uwvm2::utils::mutex::mutex_guard_t segment_table_guard{detail::segment_table_lock};
+        detail::publish_segment_table(nullptr, 0uz);
+    }
 
 }  // namespace uwvm2::object::memory::signal
 
@@ -166,7 +166,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
         init_const_expr_ref_mutable_imported_global,
         illegal_custom_section_order,
         missing_code_body_end,
-        exceed_the_max_parser_limit
+        exceed_the_max_parser_limit,
+        invalid_function_body
     };
 
     /// @brief used for duplicate_imports_of_the_same_import_type
@@ -245,6 +246,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
         ::std::size_t maxval;
     };
 
+    /// @brief Used to set the output of invalid_function_body errors
+    struct invalid_function_body_t
+    {
+        ::uwvm2::utils::container::u8string_view reason;
+        ::std::size_t function_index;
+    };
+
     /// @brief define IEEE 754 F32 and F64
     using error_f32 = ::uwvm2::utils::precfloat::float32_t;
     using error_f64 = ::uwvm2::utils::precfloat::float64_t;
@@ -273,6 +281,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
         static_assert(::std::is_trivially_copyable_v<illegal_custom_section_order_t> && ::std::is_trivially_destructible_v<illegal_custom_section_order_t>);
         exceed_the_max_parser_limit_t exceed_the_max_parser_limit;
         static_assert(::std::is_trivially_copyable_v<exceed_the_max_parser_limit_t> && ::std::is_trivially_destructible_v<exceed_the_max_parser_limit_t>);
+        invalid_function_body_t invalid_function_body;
+        static_assert(::std::is_trivially_copyable_v<invalid_function_body_t> && ::std::is_trivially_destructible_v<invalid_function_body_t>);
 
         ::std::byte const* err_end;
         ::std::size_t err_uz;
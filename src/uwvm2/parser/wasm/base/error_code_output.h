@@ -688,6 +688,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::base
 #include "error_code_outputs/eco_exceed_the_max_parser_limit.h"
                 return;
             }
+            case ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_function_body:
+            {
+#include "error_code_outputs/eco_invalid_function_body.h"
+                return;
+            }
         }
     }
 }
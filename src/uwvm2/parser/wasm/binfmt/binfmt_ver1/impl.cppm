@@ -29,6 +29,7 @@ export import :section;
 export import :def;
 export import :handler_def;
 export import :handler;
+export import :stream;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -29,4 +29,5 @@
 # include "def.h"
 # include "handler_def.h"
 # include "handler.h"
+# include "stream.h"
 #endif
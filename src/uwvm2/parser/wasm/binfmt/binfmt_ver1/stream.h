@@ -0,0 +1,275 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @brief       WebAssembly Release 1.0 (2019-07-20)
+ * @details     antecedent dependency: null
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <climits>
+# include <concepts>
+# include <type_traits>
+# include <utility>
+# include <limits>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/concepts/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/parser/wasm/binfmt/base/impl.h>
+# include "section.h"
+# include "def.h"
+# include "handler_def.h"
+# include "handler.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::binfmt::ver1
+{
+    /// @brief      A module image that a producer is still appending to (pipe, socket, stdin).
+    /// @details    `wait_for(context, size)` blocks until at least `size` bytes starting at `module_begin` are readable and returns the number of readable
+    ///             bytes. It returns less than `size` only once the producer has finished, the value returned then is the size of the whole module.
+    ///             Bytes that have been made readable never move or change, the parser keeps pointers into them.
+    struct wasm_binfmt_ver1_module_stream_t
+    {
+        ::std::byte const* module_begin{};
+        void* context{};
+        ::std::size_t (*wait_for)(void*, ::std::size_t) noexcept {};
+    };
+
+    /// @brief      Streaming counterpart of `wasm_binfmt_ver1_handle_func`: every section is handed to its handler as soon as its last byte is readable, so
+    ///             the sections already received are parsed while the rest of the module is still being transferred.
+    /// @details    Accepts exactly the modules `wasm_binfmt_ver1_handle_func` accepts and reports the same errors at the same positions. Only the final check
+    ///             waits for the producer to finish.
+    /// @throws     ::fast_io::error
+    template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+    [[nodiscard]] inline wasm_binfmt_ver1_module_extensible_storage_t<Fs...> wasm_binfmt_ver1_handle_stream_func(
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_stream_t const& stream,
+        ::uwvm2::parser::wasm::base::error_impl& err,
+        ::uwvm2::parser::wasm::concepts::feature_parameter_t<Fs...> const& fs_para) UWVM_THROWS
+    {
+        static_assert(sizeof...(Fs) != 0, "there are no section handlers to dispatch to, use wasm_binfmt_ver1_handle_func to check the format only");
+
+        using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+        auto const module_begin{stream.module_begin};
+
+        wasm_binfmt_ver1_module_extensible_storage_t<Fs...> ret{};
+
+        ret.module_span.module_begin = module_begin;
+
+        // Everything before module_begin + available is readable, available only grows.
+        ::std::size_t available{stream.wait_for(stream.context, 8uz)};
+
+        // 00 61 73 6D 01 00 00 00 sec_id sec_len ...
+        // ^^ module_begin
+
+        // Short-circuit summation, safe
+        if(available < 8uz || !::uwvm2::parser::wasm::binfmt::is_wasm_file_unchecked(module_begin)) [[unlikely]]
+        {
+            err.err_curr = module_begin;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_wasm_file_format;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        ::std::size_t module_offset{8uz};
+
+        if(available == module_offset) { available = stream.wait_for(stream.context, module_offset + 1uz); }
+
+        if(available == module_offset) [[unlikely]]
+        {
+            err.err_curr = module_begin + module_offset;
+            err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::no_wasm_section_found;
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+        }
+
+        max_section_id_map_sec_id_t max_order{};
+
+        do
+        {
+            // [... sec_id] sec_len ...
+            // [ readable ]
+            //      ^^ module_offset
+
+            auto const sec_id_module_ptr{module_begin + module_offset};  // for error
+
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte sec_id;
+            ::std::memcpy(::std::addressof(sec_id), sec_id_module_ptr, sizeof(::uwvm2::parser::wasm::standard::wasm1::type::wasm_byte));
+
+            // Avoid high invalid byte problem for platforms with CHAR_BIT greater than 8
+#if CHAR_BIT > 8
+            sec_id = static_cast<decltype(sec_id)>(static_cast<::std::uint_least8_t>(sec_id) & 0xFFu);
+#endif
+
+            static_assert(sizeof(sec_id) == 1uz);
+
+            // All standard sections (except custom sections, id: 0) must be in canonical order, same as wasm_binfmt_ver1_handle_func.
+
+            ::uwvm2::parser::wasm::binfmt::ver1::wasm_order_t curr_order_sec_id;  // No initialization necessary
+
+            if constexpr(::uwvm2::parser::wasm::binfmt::ver1::has_section_id_sequential_mapping_table_define<Fs...>)
+            {
+                constexpr auto& order_sec_id_table{
+                    ::uwvm2::parser::wasm::binfmt::ver1::final_section_sequential_packer_t<Fs...>::section_id_sequential_mapping_table};
+                constexpr auto order_sec_id_table_size{order_sec_id_table.size()};
+                if(sec_id >= order_sec_id_table_size) [[unlikely]] { curr_order_sec_id = 0u; }
+                else
+                {
+                    curr_order_sec_id = order_sec_id_table.index_unchecked(sec_id);
+                }
+            }
+            else
+            {
+                curr_order_sec_id = sec_id;
+            }
+
+            if(curr_order_sec_id != 0u)
+            {
+                if(curr_order_sec_id < max_order.max_section_id) [[unlikely]]
+                {
+                    err.err_curr = sec_id_module_ptr;
+                    err.err_selectable.u8arr[0] = sec_id;
+                    err.err_selectable.u8arr[1] = max_order.max_section_id_map_sec_id;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_section_canonical_order;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+
+                max_order.max_section_id = curr_order_sec_id;
+                max_order.max_section_id_map_sec_id = sec_id;
+            }
+
+            ++module_offset;
+
+            // [... sec_id] sec_len ... sec_begin ... sec_id (sec_end)
+            // [ readable ]
+            //              ^^ module_offset
+
+            // A leb128 cut off by the readable end fails like a malformed one, so the length is re-scanned with more bytes whenever the scan ran into the
+            // readable end. Redundant leb128 bytes are accepted exactly as wasm_binfmt_ver1_handle_func accepts them.
+            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 sec_len;  // No initialization necessary
+            ::std::size_t sec_len_offset;                                    // No initialization necessary
+            for(;;)
+            {
+                auto const [sec_len_next, sec_len_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(module_begin + module_offset),
+                                                                                reinterpret_cast<char8_t_const_may_alias_ptr>(module_begin + available),
+                                                                                ::fast_io::mnp::leb128_get(sec_len))};
+
+                if(sec_len_err != ::fast_io::parse_code::ok && reinterpret_cast<::std::byte const*>(sec_len_next) == module_begin + available)
+                {
+                    if(auto const more{stream.wait_for(stream.context, available + 1uz)}; more != available)
+                    {
+                        available = more;
+                        continue;
+                    }
+                }
+
+                if(sec_len_err != ::fast_io::parse_code::ok) [[unlikely]]
+                {
+                    err.err_curr = module_begin + module_offset;
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_section_length;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(sec_len_err);
+                }
+
+                sec_len_offset = static_cast<::std::size_t>(reinterpret_cast<::std::byte const*>(sec_len_next) - module_begin);
+                break;
+            }
+
+            // The size_t of some platforms is smaller than u32, in these platforms you need to do a size check before conversion
+            constexpr auto size_t_max{::std::numeric_limits<::std::size_t>::max()};
+            constexpr auto wasm_u32_max{::std::numeric_limits<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>::max()};
+            if constexpr(size_t_max < wasm_u32_max)
+            {
+                if(sec_len > size_t_max) [[unlikely]]
+                {
+                    err.err_curr = module_begin + sec_len_offset;
+                    err.err_selectable.u64 = static_cast<::std::uint_least64_t>(sec_len);
+                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::size_exceeds_the_maximum_value_of_size_t;
+                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+                }
+            }
+
+            module_offset = sec_len_offset;
+
+            // [... sec_id sec_len ...] sec_begin ... sec_id (sec_end)
+            // [       readable       ]
+            //                          ^^ module_offset
+
+            // Wait for the whole section, this is where the transfer and the parsing of the previous sections overlap.
+            auto const sec_size{static_cast<::std::size_t>(sec_len)};
+            if(available - module_offset < sec_size)
+            {
+                available = stream.wait_for(stream.context, sec_size > size_t_max - module_offset ? size_t_max : module_offset + sec_size);
+            }
+
+            if(available - module_offset < sec_size) [[unlikely]]
+            {
+                err.err_curr = module_begin + module_offset;
+                err.err_selectable.u32 = sec_len;
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::illegal_section_length;
+                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
+            }
+
+            // [... sec_id sec_len ... sec_begin ...] next_sec_id ...
+            // [              readable              ]
+            //                         ^^ module_offset
+
+            auto const sec_begin{module_begin + module_offset};
+            auto const sec_end{sec_begin + sec_size};
+
+            handle_all_binfmt_ver1_extensible_section(ret, sec_id, sec_begin, sec_end, err, fs_para, max_order, sec_id_module_ptr);
+
+            module_offset += sec_size;
+
+            // The producer is only asked for more once everything readable has been parsed.
+            if(module_offset == available) { available = stream.wait_for(stream.context, module_offset + 1uz); }
+        }
+        while(module_offset != available);
+
+        // The producer has finished, module_begin + available is the end of the module.
+        auto const module_end{module_begin + available};
+        ret.module_span.module_end = module_end;
+
+        if constexpr(has_final_check_handler<Fs...>)
+        {
+            constexpr ::uwvm2::parser::wasm::concepts::feature_reserve_type_t<::uwvm2::parser::wasm::binfmt::ver1::final_final_check_t<Fs...>> final_adl{};
+            define_final_check(final_adl, ret, module_end, err, fs_para);
+        }
+
+        return ret;
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
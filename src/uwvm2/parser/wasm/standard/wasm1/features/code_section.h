@@ -345,16 +345,28 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
                 //                                                       ^^ section_curr
 
                 ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 clocal_n;
+                ::std::byte const* clocal_n_next;  // No initialization necessary
 
-                auto const [clocal_n_next, clocal_n_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
-                                                                                  ::fast_io::mnp::leb128_get(clocal_n))};
-
-                if(clocal_n_err != ::fast_io::parse_code::ok) [[unlikely]]
+                // Nearly every group declares fewer than 128 locals, whose clocal_n is a single byte and needs no leb128 decoding.
+                if(section_curr != code_end && (::std::to_integer<::std::uint_least8_t>(*section_curr) & 0x80u) == 0u) [[likely]]
                 {
-                    err.err_curr = section_curr;
-                    err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_clocal_n;
-                    ::uwvm2::parser::wasm::base::throw_wasm_parse_code(clocal_n_err);
+                    clocal_n = static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(::std::to_integer<::std::uint_least8_t>(*section_curr));
+                    clocal_n_next = section_curr + 1u;
+                }
+                else
+                {
+                    auto const [clocal_n_next_scan, clocal_n_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
+                                                                                           reinterpret_cast<char8_t_const_may_alias_ptr>(code_end),
+                                                                                           ::fast_io::mnp::leb128_get(clocal_n))};
+
+                    if(clocal_n_err != ::fast_io::parse_code::ok) [[unlikely]]
+                    {
+                        err.err_curr = section_curr;
+                        err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_clocal_n;
+                        ::uwvm2::parser::wasm::base::throw_wasm_parse_code(clocal_n_err);
+                    }
+
+                    clocal_n_next = reinterpret_cast<::std::byte const*>(clocal_n_next_scan);
                 }
 
                 // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
@@ -386,7 +398,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
 
                 fle.count = clocal_n;
 
-                section_curr = reinterpret_cast<::std::byte const*>(clocal_n_next);
+                section_curr = clocal_n_next;
 
                 // [ ... body_size ... local_count(code_body_begin) ... clocal_n ...] clocal_type next_clocal_n ... code ...]
                 // [                             safe                               ]    ......                             ] unsafe
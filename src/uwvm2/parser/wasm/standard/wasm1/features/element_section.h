@@ -525,48 +525,37 @@ UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::standard::wasm1::features
         // [                     safe                 ] unsafe (could be the section_end)
         //                                              ^^ section_curr
 
-        for(::std::size_t funcidx_counter{}; funcidx_counter != funcidx_count; ++funcidx_counter)
-        {
-            // [ ...] func_curr ... func_next ...
-            // [safe] unsafe (could be the section_end)
-            //        ^^ section_curr
-
-            // No boundary check is needed here, parse_by_scan comes with its own checks
-
-            ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 funcidx;
+        // Decoded straight into the reserved storage, single-byte indices a whole run at a time.
+        // No boundary check is needed here, decode_uleb128_vector comes with its own checks
 
-            auto const [funcidx_next, funcidx_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(section_curr),
-                                                                            reinterpret_cast<char8_t_const_may_alias_ptr>(section_end),
-                                                                            ::fast_io::mnp::leb128_get(funcidx))};
+        auto const funcidx_res{::uwvm2::parser::wasm::utils::decode_uleb128_vector(
+            section_curr, section_end, wet.vec_funcidx.imp.curr_ptr, static_cast<::std::size_t>(funcidx_count), all_func_size)};
 
-            if(funcidx_err != ::fast_io::parse_code::ok) [[unlikely]]
-            {
-                err.err_curr = section_curr;
-                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_elem_funcidx;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(funcidx_err);
-            }
-
-            // [ ... func_curr ...] func_next ...
-            // [       safe       ] unsafe (could be the section_end)
-            //       ^^ section_curr
+        if(funcidx_res.code != ::fast_io::parse_code::ok) [[unlikely]]
+        {
+            err.err_curr = funcidx_res.curr;
 
-            if(funcidx >= all_func_size) [[unlikely]]
+            if(funcidx_res.out_of_bound)
             {
-                err.err_curr = section_curr;
-                err.err_selectable.elem_func_index_exceeds_maxvul.idx = funcidx;
+                err.err_selectable.elem_func_index_exceeds_maxvul.idx = wet.vec_funcidx.imp.curr_ptr[funcidx_res.count];
                 err.err_selectable.elem_func_index_exceeds_maxvul.maxval = all_func_size;
                 err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::elem_func_index_exceeds_maxvul;
-                ::uwvm2::parser::wasm::base::throw_wasm_parse_code(::fast_io::parse_code::invalid);
             }
+            else
+            {
+                err.err_code = ::uwvm2::parser::wasm::base::wasm_parse_error_code::invalid_elem_funcidx;
+            }
+
+            ::uwvm2::parser::wasm::base::throw_wasm_parse_code(funcidx_res.code);
+        }
 
-            wet.vec_funcidx.push_back_unchecked(funcidx);
+        wet.vec_funcidx.imp.curr_ptr += funcidx_res.count;
 
-            section_curr = reinterpret_cast<::std::byte const*>(funcidx_next);
+        section_curr = funcidx_res.curr;
 
-            // [ ... func_curr ...] func_next ...
-            // [       safe       ] unsafe (could be the section_end)
-            //                      ^^ section_curr
-        }
+        // [table_idx ... expr ... 0x0B func_count ... func ...] next_table_idx ...
+        // [                         safe                      ] unsafe (could be the section_end)
+        //                                                       ^^ section_curr
 
         return section_curr;
     }
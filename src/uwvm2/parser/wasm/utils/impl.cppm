@@ -24,6 +24,7 @@ module;
 
 export module uwvm2.parser.wasm.utils;
 export import :base;
+export import :varint;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -24,4 +24,5 @@
 
 #ifndef UWVM_MODULE
 # include "base.h"
+# include "varint.h"
 #endif
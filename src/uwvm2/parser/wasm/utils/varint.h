@@ -0,0 +1,213 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <cstring>
+# include <bit>
+# include <concepts>
+# include <limits>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::parser::wasm::utils
+{
+    /// @brief      Number of leading bytes in `[curr, end)` below 0x80, that is the number of leading uleb128 values that take a single byte.
+    /// @details    Indices, counts and value types in real modules are almost always single-byte encodings, so callers decode such a run by widening
+    ///             its bytes and only fall back to `::fast_io::mnp::leb128_get` at the byte that ends it. The run is found with the byte sign mask of
+    ///             16 or 32 bytes at a time where available, and 8 bytes at a time otherwise.
+    inline constexpr ::std::size_t uleb128_single_byte_run(::std::byte const* curr, ::std::byte const* const end) noexcept
+    {
+        auto const begin{curr};
+
+#if UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__vector_size__) && defined(__LITTLE_ENDIAN__) && defined(__AVX2__) && UWVM_HAS_BUILTIN(__builtin_ia32_pmovmskb256)
+        /// (Little Endian), [[gnu::vector_size]]
+        /// x86_64-avx2
+
+        using c8x32simd [[__gnu__::__vector_size__(32)]] = char;
+
+        while(static_cast<::std::size_t>(end - curr) >= 32uz)
+        {
+            c8x32simd simd_vector_str;  // No initialization necessary
+            ::std::memcpy(::std::addressof(simd_vector_str), curr, sizeof(c8x32simd));
+
+            auto const mask{static_cast<::std::uint_least32_t>(__builtin_ia32_pmovmskb256(simd_vector_str))};
+            if(mask != 0u) { return static_cast<::std::size_t>(curr - begin) + static_cast<::std::size_t>(::std::countr_zero(mask)); }
+
+            curr += 32uz;
+        }
+
+#elif UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__vector_size__) && defined(__LITTLE_ENDIAN__) &&                                                                        \
+    ((defined(__SSE2__) && UWVM_HAS_BUILTIN(__builtin_ia32_pmovmskb128)) || (defined(__wasm_simd128__) && UWVM_HAS_BUILTIN(__builtin_wasm_bitmask_i8x16)))
+        /// (Little Endian), [[gnu::vector_size]]
+        /// x86_64-sse2, wasm-wasmsimd128
+
+        using c8x16simd [[__gnu__::__vector_size__(16)]] [[maybe_unused]] = char;
+        using i8x16simd [[__gnu__::__vector_size__(16)]] [[maybe_unused]] = ::std::int8_t;
+
+        while(static_cast<::std::size_t>(end - curr) >= 16uz)
+        {
+            c8x16simd simd_vector_str;  // No initialization necessary
+            ::std::memcpy(::std::addressof(simd_vector_str), curr, sizeof(c8x16simd));
+
+            auto const mask{static_cast<::std::uint_least32_t>(
+# if defined(__SSE2__) && UWVM_HAS_BUILTIN(__builtin_ia32_pmovmskb128)
+                __builtin_ia32_pmovmskb128(simd_vector_str)
+# else
+                __builtin_wasm_bitmask_i8x16(::std::bit_cast<i8x16simd>(simd_vector_str))
+# endif
+                    )};
+            if(mask != 0u) { return static_cast<::std::size_t>(curr - begin) + static_cast<::std::size_t>(::std::countr_zero(mask)); }
+
+            curr += 16uz;
+        }
+#endif
+
+        // 8 bytes at a time (also the tail of the simd loops): the sign bits of a little-endian word, the lowest set one is the first long byte.
+        while(static_cast<::std::size_t>(end - curr) >= 8uz)
+        {
+            ::std::uint_least64_t word;  // No initialization necessary
+            ::std::memcpy(::std::addressof(word), curr, sizeof(word));
+
+            auto const mask{::fast_io::little_endian(word) & static_cast<::std::uint_least64_t>(0x8080'8080'8080'8080u)};
+            if(mask != 0u) { return static_cast<::std::size_t>(curr - begin) + static_cast<::std::size_t>(::std::countr_zero(mask)) / 8uz; }
+
+            curr += 8uz;
+        }
+
+        while(curr != end && (::std::to_integer<::std::uint_least8_t>(*curr) & 0x80u) == 0u) { ++curr; }
+
+        return static_cast<::std::size_t>(curr - begin);
+    }
+
+    /// @brief      Result of `decode_uleb128_vector`.
+    struct uleb128_vector_result_t
+    {
+        // One past the last value on success, otherwise the first byte of the value decoding stopped at.
+        ::std::byte const* curr{};
+        // Number of values written to the output.
+        ::std::size_t count{};
+        // `parse_code::ok` on success, the error of `::fast_io::mnp::leb128_get` for a malformed value, `parse_code::invalid` if out of bound.
+        ::fast_io::parse_code code{};
+        // The value at `curr` is well-formed but not below `bound`. It is stored at `out[count]` for diagnostics.
+        bool out_of_bound{};
+    };
+
+    /// @brief      Decode `count` uleb128 values below `bound` from `[curr, end)` into `out`, which must have room for `count` values.
+    /// @details    Runs of single-byte values (`uleb128_single_byte_run`) are widened into `out` in one loop, which the compiler vectorizes, and
+    ///             checked against `bound` through their largest byte. Two-byte values are decoded in place, longer ones by `::fast_io::mnp::leb128_get`.
+    ///             Used for index vectors whose length is known up front: element segment function indices and `br_table` labels.
+    template <::std::unsigned_integral U>
+    inline constexpr uleb128_vector_result_t
+        decode_uleb128_vector(::std::byte const* curr, ::std::byte const* const end, U* const out, ::std::size_t const count, U const bound) noexcept
+    {
+        ::std::size_t decoded{};
+
+        while(decoded != count)
+        {
+            // Never scan past the bytes the remaining values can occupy as single-byte encodings.
+            auto const remaining{count - decoded};
+            auto const scan_end{static_cast<::std::size_t>(end - curr) > remaining ? curr + remaining : end};
+            auto const run{::uwvm2::parser::wasm::utils::uleb128_single_byte_run(curr, scan_end)};
+
+            ::std::uint_least8_t max_byte{};
+            for(::std::size_t i{}; i != run; ++i)
+            {
+                auto const byte{::std::to_integer<::std::uint_least8_t>(curr[i])};
+                out[decoded + i] = static_cast<U>(byte);
+                max_byte = max_byte < byte ? byte : max_byte;
+            }
+
+            if(run != 0uz && static_cast<U>(max_byte) >= bound) [[unlikely]]
+            {
+                ::std::size_t i{};
+                while(out[decoded + i] < bound) { ++i; }
+                return {curr + i, decoded + i, ::fast_io::parse_code::invalid, true};
+            }
+
+            curr += run;
+            decoded += run;
+
+            if(decoded == count) { break; }
+
+            // The run ended at a multi-byte value or at `end`. Multi-byte values tend to come in runs too (large indices), so they are decoded here
+            // until the next single-byte value rather than scanning for a run before each of them.
+
+            using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+            do
+            {
+                U value;  // No initialization necessary
+
+                // Two-byte encodings (128 to 16383) are the common long case and are decoded in place.
+                if(::std::numeric_limits<U>::digits >= 14 && static_cast<::std::size_t>(end - curr) >= 2uz &&
+                   (::std::to_integer<::std::uint_least8_t>(curr[1]) & 0x80u) == 0u)
+                {
+                    value = static_cast<U>(static_cast<U>(::std::to_integer<::std::uint_least8_t>(curr[0]) & 0x7Fu) |
+                                           static_cast<U>(static_cast<U>(::std::to_integer<::std::uint_least8_t>(curr[1])) << 7u));
+
+                    out[decoded] = value;
+
+                    if(value >= bound) [[unlikely]] { return {curr, decoded, ::fast_io::parse_code::invalid, true}; }
+
+                    curr += 2uz;
+                }
+                else
+                {
+                    auto const [next, parse_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                          reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                          ::fast_io::mnp::leb128_get(value))};
+
+                    if(parse_err != ::fast_io::parse_code::ok) [[unlikely]] { return {curr, decoded, parse_err, false}; }
+
+                    out[decoded] = value;
+
+                    if(value >= bound) [[unlikely]] { return {curr, decoded, ::fast_io::parse_code::invalid, true}; }
+
+                    curr = reinterpret_cast<::std::byte const*>(next);
+                }
+
+                ++decoded;
+            }
+            while(decoded != count && curr != end && (::std::to_integer<::std::uint_least8_t>(*curr) & 0x80u) != 0u);
+        }
+
+        return {curr, decoded, ::fast_io::parse_code::ok, false};
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -97,6 +97,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::cmdline
         global = 0u,
         debug,
         wasm,
+        runtime,
         log,
 #if defined(UWVM_IMPORT_WASI)
         wasi,
@@ -595,3 +595,10 @@
 #if defined(__ELF__) && UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__weak__) && UWVM_HAS_CPP_ATTRIBUTE(__gnu__::__used__)
 # define UWVM_SUPPORT_WEAK_SYMBOL
 #endif
+
+/// @brief        Determine whether the platform can run additional threads (`::std::thread`)
+#pragma push_macro("UWVM_SUPPORT_MULTITHREAD")
+#undef UWVM_SUPPORT_MULTITHREAD
+#if !defined(__SINGLE_THREAD__) && !(defined(__MSDOS__) || defined(__DJGPP__)) && (!defined(__wasm__) || defined(_REENTRANT)) && __has_include(<thread>)
+# define UWVM_SUPPORT_MULTITHREAD
+#endif
@@ -70,7 +70,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         autosync,
         nocore,
         core,
-        protect
+        protect,
+        hugepage,
+        nohugepage
 #else
 # ifdef MADV_NORMAL
         normal = MADV_NORMAL
@@ -136,6 +138,19 @@ UWVM_MODULE_EXPORT namespace uwvm2::utils::madvise
         protect = MADV_PROTECT
 # else
         protect = -1
+# endif
+        ,
+        // Linux transparent huge pages
+# ifdef MADV_HUGEPAGE
+        hugepage = MADV_HUGEPAGE
+# else
+        hugepage = -1
+# endif
+        ,
+# ifdef MADV_NOHUGEPAGE
+        nohugepage = MADV_NOHUGEPAGE
+# else
+        nohugepage = -1
 # endif
 #endif
     };
@@ -0,0 +1,166 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-04-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstdint>
+# include <cstddef>
+# include <memory>
+// platform
+# if defined(__linux__)
+#  include <unistd.h>
+#  include <sys/syscall.h>
+# endif
+// import
+# include <fast_io.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::utils::numa
+{
+    /// @brief      Whether the NUMA memory policy system calls are available on this platform.
+#if defined(__linux__) && defined(__NR_getcpu) && defined(__NR_mbind) && defined(__NR_move_pages)
+    inline constexpr bool support_numa{true};
+#else
+    inline constexpr bool support_numa{false};
+#endif
+
+    namespace details
+    {
+        // <linux/mempolicy.h>, not included because it is not shipped by every libc.
+        inline constexpr int mpol_default{0};
+        inline constexpr int mpol_preferred{1};
+        inline constexpr unsigned mpol_mf_move{1u << 1u};
+
+        // Large enough for the node masks of every host in practice, `mbind` only reads `maxnode` bits.
+        inline constexpr ::std::size_t max_numa_node{1024uz};
+        inline constexpr ::std::size_t numa_node_mask_words{max_numa_node / (sizeof(unsigned long) * 8uz)};
+
+        // Number of pages handed to one `move_pages` call.
+        inline constexpr ::std::size_t move_pages_batch{64uz};
+    }  // namespace details
+
+    struct get_current_numa_node_result_t
+    {
+        unsigned node;
+        bool success;
+    };
+
+    /// @brief      The NUMA node of the CPU the calling thread currently runs on.
+    /// @note       The scheduler may move the thread afterwards unless it is pinned.
+    inline get_current_numa_node_result_t get_current_numa_node() noexcept
+    {
+#if defined(__linux__) && defined(__NR_getcpu) && defined(__NR_mbind) && defined(__NR_move_pages)
+        unsigned cpu{};
+        unsigned node{};
+        if(::fast_io::system_call<__NR_getcpu, int>(::std::addressof(cpu), ::std::addressof(node), nullptr) != 0) [[unlikely]] { return {0u, false}; }
+        return {node, true};
+#else
+        return {0u, false};
+#endif
+    }
+
+    /// @brief      Prefer `node` for every page of `[addr, addr + length)` allocated from now on, and with `move` also migrate the pages already present.
+    /// @details    `MPOL_PREFERRED` rather than `MPOL_BIND`: when the node runs out of memory the pages come from another node instead of failing.
+    /// @note       `addr` must be page-aligned. The policy belongs to the mapping, so it survives until `reset_numa_policy` or the mapping is replaced.
+    /// @return     false if the platform refused or does not support NUMA policies.
+    inline bool prefer_numa_node([[maybe_unused]] void* addr,
+                                 [[maybe_unused]] ::std::size_t length,
+                                 [[maybe_unused]] unsigned node,
+                                 [[maybe_unused]] bool move) noexcept
+    {
+#if defined(__linux__) && defined(__NR_getcpu) && defined(__NR_mbind) && defined(__NR_move_pages)
+        if(node >= details::max_numa_node) [[unlikely]] { return false; }
+
+        constexpr ::std::size_t word_bits{sizeof(unsigned long) * 8uz};
+
+        unsigned long node_mask[details::numa_node_mask_words]{};
+        node_mask[node / word_bits] = 1ul << (node % word_bits);
+
+        return ::fast_io::system_call<__NR_mbind, long>(addr,
+                                                        length,
+                                                        details::mpol_preferred,
+                                                        node_mask,
+                                                        details::max_numa_node + 1uz,
+                                                        move ? details::mpol_mf_move : 0u) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief      Drop the policy set by `prefer_numa_node`, pages are allocated on the node of the touching thread again.
+    inline bool reset_numa_policy([[maybe_unused]] void* addr, [[maybe_unused]] ::std::size_t length) noexcept
+    {
+#if defined(__linux__) && defined(__NR_getcpu) && defined(__NR_mbind) && defined(__NR_move_pages)
+        return ::fast_io::system_call<__NR_mbind, long>(addr, length, details::mpol_default, nullptr, 0uz, 0u) == 0;
+#else
+        return false;
+#endif
+    }
+
+    /// @brief      Migrate the pages backing `[addr, addr + length)` to `node` without changing any policy.
+    /// @details    Meant for heap storage: the range is widened to whole pages, which may hold unrelated objects of the same allocator; moving them as
+    ///             well is harmless. Pages that are not present are skipped.
+    /// @return     false if the platform refused or does not support NUMA policies.
+    inline bool move_to_numa_node([[maybe_unused]] void const* addr, [[maybe_unused]] ::std::size_t length, [[maybe_unused]] unsigned node) noexcept
+    {
+#if defined(__linux__) && defined(__NR_getcpu) && defined(__NR_mbind) && defined(__NR_move_pages)
+        if(addr == nullptr || length == 0uz) { return true; }
+
+        auto const page_size_l{::sysconf(_SC_PAGESIZE)};
+        if(page_size_l <= 0l) [[unlikely]] { return false; }
+        auto const page_size{static_cast<::std::size_t>(page_size_l)};
+
+        auto const first_page{reinterpret_cast<::std::uintptr_t>(addr) & ~(page_size - 1uz)};
+        auto const last_page{(reinterpret_cast<::std::uintptr_t>(addr) + (length - 1uz)) & ~(page_size - 1uz)};
+
+        void* pages[details::move_pages_batch];  // No initialization is required
+        int nodes[details::move_pages_batch];  // No initialization is required
+        int status[details::move_pages_batch];  // No initialization is required
+
+        auto page{first_page};
+        for(bool done{}; !done;)
+        {
+            ::std::size_t count{};
+            for(; count != details::move_pages_batch && !done; ++count)
+            {
+                pages[count] = reinterpret_cast<void*>(page);
+                nodes[count] = static_cast<int>(node);
+                done = page == last_page;
+                page += page_size;
+            }
+
+            // Per-page failures (such as pages not present) are reported in `status` and ignored.
+            if(::fast_io::system_call<__NR_move_pages, long>(0, count, pages, nodes, status, details::mpol_mf_move) < 0) [[unlikely]] { return false; }
+        }
+
+        return true;
+#else
+        return false;
+#endif
+    }
+}
@@ -0,0 +1,203 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <atomic>
+# include <limits>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+#  include <thread>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::utils::thread
+{
+    /// @brief      Number of threads that can run at the same time, at least 1.
+    inline ::std::size_t get_hardware_concurrency() noexcept
+    {
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        auto const concurrency{::std::thread::hardware_concurrency()};
+        return concurrency == 0u ? 1uz : static_cast<::std::size_t>(concurrency);
+#else
+        return 1uz;
+#endif
+    }
+
+    namespace details
+    {
+        /// @brief      Remaining tasks `[head, tail)` of one worker, packed as `head << 32 | tail` so that the owner and thieves agree through one CAS.
+        inline constexpr unsigned work_queue_head_shift{32u};
+        inline constexpr ::std::uint_least64_t work_queue_tail_mask{0xFFFF'FFFFu};
+
+        /// @brief      The owner takes the front of its queue.
+        inline bool work_queue_pop_front(::std::uint_least64_t& queue, ::std::size_t& position) noexcept
+        {
+            ::std::atomic_ref<::std::uint_least64_t> const bounds{queue};
+            auto curr{bounds.load(::std::memory_order_relaxed)};
+            for(;;)
+            {
+                auto const head{curr >> work_queue_head_shift};
+                auto const tail{curr & work_queue_tail_mask};
+                if(head >= tail) { return false; }
+                if(bounds.compare_exchange_weak(curr,
+                                                curr + (::std::uint_least64_t{1u} << work_queue_head_shift),
+                                                ::std::memory_order_acq_rel,
+                                                ::std::memory_order_relaxed))
+                {
+                    position = static_cast<::std::size_t>(head);
+                    return true;
+                }
+            }
+        }
+
+        /// @brief      Thieves take the back of another worker's queue.
+        inline bool work_queue_steal_back(::std::uint_least64_t& queue, ::std::size_t& position) noexcept
+        {
+            ::std::atomic_ref<::std::uint_least64_t> const bounds{queue};
+            auto curr{bounds.load(::std::memory_order_relaxed)};
+            for(;;)
+            {
+                auto const head{curr >> work_queue_head_shift};
+                auto const tail{curr & work_queue_tail_mask};
+                if(head >= tail) { return false; }
+                if(bounds.compare_exchange_weak(curr, curr - 1u, ::std::memory_order_acq_rel, ::std::memory_order_relaxed))
+                {
+                    position = static_cast<::std::size_t>(tail - 1u);
+                    return true;
+                }
+            }
+        }
+    }  // namespace details
+
+    /// @brief      Call `fn(i)` for every `i` in `[0, task_count)` on up to `thread_count` threads, the calling thread being one of them. Returns once
+    ///             every call has returned.
+    /// @details    Task `i` is dealt to worker `i % thread_count`. A worker runs its own tasks in increasing order and, once it runs out, steals the
+    ///             highest remaining tasks of the other workers. Callers order tasks by decreasing cost: the expensive tasks start first on every
+    ///             worker and the cheap ones fill the gaps at the end.
+    /// @note       `fn` is called concurrently and must be `noexcept`.
+    template <typename Fn>
+    inline void parallel_for_work_stealing(::std::size_t task_count, ::std::size_t thread_count, Fn& fn) noexcept
+    {
+        if(thread_count > task_count) { thread_count = task_count; }
+
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        if(thread_count > 1uz)
+        {
+            auto const per_worker_max{(task_count + thread_count - 1uz) / thread_count};
+            if(per_worker_max > static_cast<::std::size_t>(details::work_queue_tail_mask)) [[unlikely]] { ::fast_io::fast_terminate(); }
+
+            ::uwvm2::utils::container::vector<::std::uint_least64_t> queues{};
+            queues.resize(thread_count);
+            for(::std::size_t worker{}; worker != thread_count; ++worker)
+            {
+                // Tasks `worker + k * thread_count` for `k` in `[0, count)`.
+                auto const count{(task_count - worker + thread_count - 1uz) / thread_count};
+                queues.index_unchecked(worker) = static_cast<::std::uint_least64_t>(count);
+            }
+
+            auto const run_worker{[&](::std::size_t worker) noexcept
+                                  {
+                                      ::std::size_t position;  // No initialization necessary
+                                      while(details::work_queue_pop_front(queues.index_unchecked(worker), position))
+                                      {
+                                          fn(worker + position * thread_count);
+                                      }
+                                      for(::std::size_t i{1uz}; i != thread_count; ++i)
+                                      {
+                                          auto const victim{(worker + i) % thread_count};
+                                          while(details::work_queue_steal_back(queues.index_unchecked(victim), position))
+                                          {
+                                              fn(victim + position * thread_count);
+                                          }
+                                      }
+                                  }};
+
+            ::uwvm2::utils::container::vector<::std::thread> threads{};
+            threads.reserve(thread_count - 1uz);
+            for(::std::size_t worker{1uz}; worker != thread_count; ++worker) { threads.emplace_back(run_worker, worker); }
+            run_worker(0uz);
+            for(auto& worker_thread: threads) { worker_thread.join(); }
+            return;
+        }
+#endif
+
+        for(::std::size_t i{}; i != task_count; ++i) { fn(i); }
+    }
+
+    /// @brief      `parallel_for_work_stealing` on a coordinator thread of its own, so that the caller goes on while the tasks run.
+    /// @details    Where threads are unavailable, `start` runs the whole loop before returning.
+    struct background_work_stealing_t
+    {
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+        ::std::thread coordinator{};
+#endif
+
+        inline constexpr background_work_stealing_t() noexcept = default;
+
+        inline constexpr background_work_stealing_t(background_work_stealing_t const&) noexcept = delete;
+        inline constexpr background_work_stealing_t& operator= (background_work_stealing_t const&) noexcept = delete;
+
+        inline ~background_work_stealing_t() { this->join(); }
+
+        /// @note       `fn` is moved to the coordinator and called as in `parallel_for_work_stealing`.
+        template <typename Fn>
+        inline void start(::std::size_t task_count, ::std::size_t thread_count, Fn fn) noexcept
+        {
+            this->join();
+
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+            this->coordinator = ::std::thread{[task_count, thread_count, fn = ::std::move(fn)]() mutable noexcept
+                                              { ::uwvm2::utils::thread::parallel_for_work_stealing(task_count, thread_count, fn); }};
+#else
+            ::uwvm2::utils::thread::parallel_for_work_stealing(task_count, thread_count, fn);
+#endif
+        }
+
+        /// @brief      Wait until every task of the last `start` has returned.
+        inline void join() noexcept
+        {
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+            if(this->coordinator.joinable()) { this->coordinator.join(); }
+#endif
+        }
+    };
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -38,6 +38,14 @@ export import :wasm_register_dl;
 export import :wasm_depend_recursion_limit;
 export import :wasm_set_parser_limit;
 export import :wasm_list_weak_symbol_module;
+export import :wasm_memory_huge_pages;
+export import :wasm_memory_reservation_pool;
+
+// runtime
+export import :runtime_compile_mode;
+export import :runtime_compiler;
+export import :runtime_code_cache;
+export import :runtime_snapshot;
 
 // wasi
 export import :wasi_disable_utf8_check;
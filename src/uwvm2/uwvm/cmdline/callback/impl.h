@@ -38,6 +38,14 @@
 # include "wasm_depend_recursion_limit.h"
 # include "wasm_set_parser_limit.h"
 # include "wasm_list_weak_symbol_module.h"
+# include "wasm_memory_huge_pages.h"
+# include "wasm_memory_reservation_pool.h"
+
+// runtime
+# include "runtime_compile_mode.h"
+# include "runtime_compiler.h"
+# include "runtime_code_cache.h"
+# include "runtime_snapshot.h"
 
 // wasi
 # include "wasi_disable_utf8_check.h"
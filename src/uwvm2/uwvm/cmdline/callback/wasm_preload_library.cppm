@@ -39,7 +39,6 @@ import uwvm2.uwvm.cmdline;
 import uwvm2.uwvm.cmdline.params;
 import uwvm2.uwvm.wasm.base;
 import uwvm2.uwvm.wasm.storage;
-import uwvm2.uwvm.wasm.loader;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -37,7 +37,6 @@
 # include <uwvm2/uwvm/cmdline/params/impl.h>
 # include <uwvm2/uwvm/wasm/base/impl.h>
 # include <uwvm2/uwvm/wasm/storage/impl.h>
-# include <uwvm2/uwvm/wasm/loader/impl.h>
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -122,22 +121,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params::details
             rename_module_name = ::uwvm2::utils::container::u8string_view{currp2_str};
         }
 
+        // Parsing is deferred to `::uwvm2::uwvm::run::load_exec_wasm_module`, which parses all wasm files concurrently. Until then `module_name` holds
+        // the rename argument.
         auto& new_preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm.emplace_back()};
-
-        auto const load_wasm_file_rtl{
-            ::uwvm2::uwvm::wasm::loader::load_wasm_file(new_preloaded_wasm, file_name, rename_module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter)};
-
-        switch(load_wasm_file_rtl)
-        {
-            [[likely]] case ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok:
-            {
-                break;
-            }
-            [[unlikely]] default:
-            {
-                return ::uwvm2::utils::cmdline::parameter_return_type::return_m1_imme;
-            }
-        }
+        new_preloaded_wasm.file_name = file_name;
+        new_preloaded_wasm.module_name = rename_module_name;
 
         return ::uwvm2::utils::cmdline::parameter_return_type::def;
     }
@@ -68,6 +68,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_list_weak_symbol_module),
 #endif
             ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_grow_strict),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_grow_commit_ahead),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_numa_local),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_huge_pages),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::wasm_memory_reservation_pool),
+
+            // runtime
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compile_mode),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_compiler),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_code_cache),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_snapshot),
+            ::std::addressof(::uwvm2::uwvm::cmdline::params::runtime_int_superinst_census),
 
         // wasi
 #if defined(UWVM_IMPORT_WASI)
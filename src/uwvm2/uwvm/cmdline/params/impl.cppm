@@ -40,6 +40,17 @@ export import :wasm_depend_recursion_limit;
 export import :wasm_set_parser_limit;
 export import :wasm_list_weak_symbol_module;
 export import :wasm_memory_grow_strict;
+export import :wasm_memory_grow_commit_ahead;
+export import :wasm_memory_numa_local;
+export import :wasm_memory_huge_pages;
+export import :wasm_memory_reservation_pool;
+
+// runtime
+export import :runtime_compile_mode;
+export import :runtime_compiler;
+export import :runtime_code_cache;
+export import :runtime_snapshot;
+export import :runtime_int_superinst_census;
 
 // wasi
 export import :wasi_disable_utf8_check;
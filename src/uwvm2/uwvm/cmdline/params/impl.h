@@ -40,6 +40,17 @@
 # include "wasm_set_parser_limit.h"
 # include "wasm_list_weak_symbol_module.h"
 # include "wasm_memory_grow_strict.h"
+# include "wasm_memory_grow_commit_ahead.h"
+# include "wasm_memory_numa_local.h"
+# include "wasm_memory_huge_pages.h"
+# include "wasm_memory_reservation_pool.h"
+
+// runtime
+# include "runtime_compile_mode.h"
+# include "runtime_compiler.h"
+# include "runtime_code_cache.h"
+# include "runtime_snapshot.h"
+# include "runtime_int_superinst_census.h"
 
 // wasi
 # include "wasi_disable_utf8_check.h"
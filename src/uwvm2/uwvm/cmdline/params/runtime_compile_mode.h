@@ -0,0 +1,80 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-03-27
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/cmdline/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params
+{
+    namespace details
+    {
+        inline bool runtime_compile_mode_is_exist{};  // [global]
+        inline constexpr ::uwvm2::utils::container::u8string_view runtime_compile_mode_alias{u8"-Rcm"};
+#if defined(UWVM_MODULE)
+        extern "C++"
+#else
+        inline constexpr
+#endif
+            ::uwvm2::utils::cmdline::parameter_return_type runtime_compile_mode_callback(::uwvm2::utils::cmdline::parameter_parsing_results*,
+                                                                                         ::uwvm2::utils::cmdline::parameter_parsing_results*,
+                                                                                         ::uwvm2::utils::cmdline::parameter_parsing_results*) noexcept;
+
+    }  // namespace details
+
+#if defined(__clang__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wbraced-scalar-init"
+#endif
+    inline constexpr ::uwvm2::utils::cmdline::parameter runtime_compile_mode{
+        .name{u8"--runtime-compile-mode"},
+        .describe{
+            u8"Select when function bodies are translated: \"lazy\" translates each function on its first call, \"lazy-verify\" additionally verifies every function body in the background, \"full\" translates everything before running (DEFAULT: lazy-verify)."},
+        .usage{u8"[lazy,lazy-verify,full]"},
+        .alias{::uwvm2::utils::cmdline::kns_u8_str_scatter_t{::std::addressof(details::runtime_compile_mode_alias), 1uz}},
+        .handle{::std::addressof(details::runtime_compile_mode_callback)},
+        .is_exist{::std::addressof(details::runtime_compile_mode_is_exist)},
+        .cate{::uwvm2::utils::cmdline::categorization::runtime}};
+#if defined(__clang__)
+# pragma clang diagnostic pop
+#endif
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
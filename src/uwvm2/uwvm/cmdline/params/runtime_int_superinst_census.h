@@ -0,0 +1,69 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2025-03-27
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <memory>
+# include <type_traits>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/cmdline/impl.h>
+# include <uwvm2/compiler/uwvm_int/flags/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::cmdline::params
+{
+    namespace details
+    {
+        inline constexpr ::uwvm2::utils::container::u8string_view runtime_int_superinst_census_alias{u8"--int-superinst-census"};
+    }  // namespace details
+
+#if defined(__clang__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wbraced-scalar-init"
+#endif
+    inline constexpr ::uwvm2::utils::cmdline::parameter runtime_int_superinst_census{
+        .name{u8"--runtime-int-superinst-census"},
+        .describe{u8"Print a static census of the translated uwvm-int code: fused superinstruction sites and frequent opcode pairs, not execution counts."},
+        .alias{::uwvm2::utils::cmdline::kns_u8_str_scatter_t{::std::addressof(details::runtime_int_superinst_census_alias), 1uz}},
+        .is_exist{::std::addressof(::uwvm2::compiler::uwvm_int::flags::show_superinst_census)},
+        .cate{::uwvm2::utils::cmdline::categorization::runtime}};
+#if defined(__clang__)
+# pragma clang diagnostic pop
+#endif
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
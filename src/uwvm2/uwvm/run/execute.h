@@ -0,0 +1,266 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_push_macro.h>  // wasip1
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/debug/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/imported/wasi/wasip1/storage/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
+# include <uwvm2/uwvm/runtime/snapshot/impl.h>
+# include <uwvm2/compiler/uwvm_int/flags/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+# if defined(UWVM_USE_LLVM_JIT)
+#  include <uwvm2/compiler/jit/llvm_jit/impl.h>
+# endif
+# include "retval.h"
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
+{
+#if defined(UWVM_USE_DEFAULT_INT) || defined(UWVM_USE_UWVM_INT)
+    namespace details
+    {
+        inline void run_start_function(::uwvm2::compiler::uwvm_int::compiled_module_t const& module) noexcept
+        {
+            if(!module.has_start_function) { return; }
+
+            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                    u8"[info]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Run the start function of module \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    module.module_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\". ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
+                                    u8"[",
+                                    ::uwvm2::uwvm::io::get_local_realtime(),
+                                    u8"] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8"(verbose)\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+            }
+
+            // The start function has type [] -> [], which has been checked by the parser.
+            ::uwvm2::compiler::uwvm_int::call_function(module, module.start_function_index, nullptr, nullptr);
+        }
+
+        /// @brief      Function index of the WASI entry point `_start` of `module_name`, if exported.
+        inline bool find_wasi_start_function(::uwvm2::utils::container::u8string_view module_name, ::std::size_t& function_index) noexcept
+        {
+            auto const mod_it{::uwvm2::uwvm::wasm::storage::all_module_export.find(module_name)};
+            if(mod_it == ::uwvm2::uwvm::wasm::storage::all_module_export.end()) { return false; }
+
+            auto const name_it{mod_it->second.find(u8"_start")};
+            if(name_it == mod_it->second.end()) { return false; }
+
+            auto const& export_record{name_it->second};
+            if(export_record.type != ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm) [[unlikely]] { return false; }
+            if(export_record.storage.wasm_file_export_storage_ptr.binfmt_ver != 1u) [[unlikely]] { return false; }
+
+            auto const export_ptr{export_record.storage.wasm_file_export_storage_ptr.storage.wasm_binfmt_ver1_export_storage_ptr};
+            if(export_ptr == nullptr || export_ptr->type != ::uwvm2::parser::wasm::standard::wasm1::type::external_types::func) [[unlikely]]
+            {
+                return false;
+            }
+
+            function_index = static_cast<::std::size_t>(export_ptr->storage.func_idx);
+            return true;
+        }
+    }  // namespace details
+#endif
+
+    /// @brief      Execute the loaded modules after `initialize_runtime()`.
+    /// @details    The start functions of the preloaded modules run first, then the start function of the main module and finally its WASI entry
+    ///             point `_start`, if it exports one. With `--runtime-snapshot` the start functions are replaced by restoring their result.
+    inline int execute_wasm() noexcept
+    {
+#if defined(UWVM_USE_DEFAULT_INT) || defined(UWVM_USE_UWVM_INT)
+# if defined(UWVM_USE_LLVM_JIT)
+        // A failure leaves the tier-up compiler unset, which is reported below.
+        ::uwvm2::compiler::jit::llvm_jit::install_llvm_jit(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler,
+                                                           ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_code_cache);
+# endif
+
+        if(!::uwvm2::compiler::uwvm_int::is_runtime_compiler_available(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler))
+        {
+            if(::uwvm2::uwvm::io::show_vm_warning)
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    u8"[warn]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"No JIT engine is available, the modules are only interpreted. ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8"(vm)\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+
+                if(::uwvm2::uwvm::io::vm_warning_fatal) [[unlikely]]
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                        u8"[fatal] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Convert warnings to fatal errors. ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                        u8"(vm)\n\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                    ::fast_io::fast_terminate();
+                }
+            }
+        }
+
+        ::uwvm2::compiler::uwvm_int::instantiate(::uwvm2::uwvm::runtime::runtime_mode::global_runtime_mode,
+                                                 ::uwvm2::uwvm::runtime::runtime_mode::global_runtime_compiler);
+
+        // The census makes `instantiate` translate every function, and `_start` may not return.
+        if(::uwvm2::compiler::uwvm_int::flags::show_superinst_census) { ::uwvm2::compiler::uwvm_int::print_superinst_census(); }
+
+        ::uwvm2::compiler::uwvm_int::compiled_module_t const* exec_module{};
+        for(auto const& [module_name, mod]: ::uwvm2::uwvm::wasm::storage::all_module)
+        {
+            if(mod.type == ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm)
+            {
+                exec_module = ::uwvm2::compiler::uwvm_int::find_compiled_module(module_name);
+                break;
+            }
+        }
+
+        if(exec_module == nullptr) [[unlikely]]
+        {
+# if (defined(_DEBUG) || defined(DEBUG)) && defined(UWVM_ENABLE_DETAILED_DEBUG_CHECK)
+            ::uwvm2::utils::debug::trap_and_inform_bug_pos();
+# endif
+            ::fast_io::fast_terminate();
+        }
+
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  if defined(UWVM_IMPORT_WASI_WASIP1)
+        // WASI functions access the memory of the main module.
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::default_wasip1_env.wasip1_memory = exec_module->memory.native_memory;
+        // `proc_exit` does not return here, the module is still rejected if one of its bodies turns out to be invalid.
+        ::uwvm2::uwvm::imported::wasi::wasip1::storage::default_wasip1_env.wasip1_proc_exit_prepare_func_ptr =
+            ::uwvm2::compiler::uwvm_int::wait_for_background_verification;
+#  endif
+# endif
+
+        // A snapshot holds the state the start functions left behind, they only run (and write it) when there is none to restore.
+        auto const snapshot_path{::uwvm2::uwvm::runtime::runtime_mode::global_runtime_snapshot};
+        if(snapshot_path.empty() || !::uwvm2::uwvm::runtime::snapshot::restore_snapshot(snapshot_path))
+        {
+            for(auto const& module: ::uwvm2::compiler::uwvm_int::compiled_modules)
+            {
+                if(::std::addressof(module) != exec_module) { details::run_start_function(module); }
+            }
+            details::run_start_function(*exec_module);
+
+            if(!snapshot_path.empty()) { ::uwvm2::uwvm::runtime::snapshot::save_snapshot(snapshot_path); }
+        }
+
+        if(::std::size_t start_index{}; details::find_wasi_start_function(exec_module->module_name, start_index))
+        {
+            auto const& callee{exec_module->function_index_space.index_unchecked(start_index)};
+            if(::uwvm2::compiler::uwvm_int::get_param_count(callee.function_type_ptr) != 0uz ||
+               ::uwvm2::compiler::uwvm_int::get_result_count(callee.function_type_ptr) != 0uz) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                    u8"[fatal] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"The exported function \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    u8"_start",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\" of module \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    exec_module->module_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\" must have type [] -> [].\n\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                ::fast_io::fast_terminate();
+            }
+
+            ::uwvm2::compiler::uwvm_int::call_function(*exec_module, start_index, nullptr, nullptr);
+        }
+
+        ::uwvm2::compiler::uwvm_int::wait_for_background_verification();
+        ::uwvm2::compiler::uwvm_int::stop_tier_up_thread();
+
+        return static_cast<int>(::uwvm2::uwvm::run::retval::ok);
+#else
+        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                            u8"uwvm: ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                            u8"[fatal] ",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"No execution engine is enabled in this build (configure with \"",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                            u8"--enable-int=uwvm-int",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                            u8"\").\n\n",
+                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        ::fast_io::fast_terminate();
+#endif
+    }
+}  // namespace uwvm2::uwvm::run
+
+#ifndef UWVM_MODULE
+// macro
+# ifndef UWVM_DISABLE_LOCAL_IMPORTED_WASIP1
+#  include <uwvm2/imported/wasi/wasip1/feature/feature_pop_macro.h>  // wasip1
+# endif
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -25,6 +25,7 @@ module;
 export module uwvm2.uwvm.run;
 export import :retval;
 export import :loader;
+export import :execute;
 export import :run;
 
 #ifndef UWVM_MODULE
@@ -36,9 +36,11 @@
 # endif
 // import
 # include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
 # include <uwvm2/utils/ansies/impl.h>
 # include <uwvm2/utils/debug/impl.h>
 # include <uwvm2/utils/madvise/impl.h>
+# include <uwvm2/utils/thread/impl.h>
 # include <uwvm2/parser/wasm/base/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
 # include <uwvm2/parser/wasm/standard/impl.h>
@@ -61,7 +63,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
 {
     inline int load_exec_wasm_module() noexcept
     {
-        // The wasm preload has been fully parsed
+        // The wasm preload has been recorded, it is parsed together with the main module
         // The dl preload has been fully registered
 
         if(!::uwvm2::uwvm::cmdline::wasm_file_ppos) [[unlikely]]
@@ -91,15 +93,39 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
         }
 
         // get main module path
-        auto const module_file_name{::uwvm2::uwvm::cmdline::wasm_file_ppos->str};
+        ::uwvm2::uwvm::wasm::storage::execute_wasm.file_name = ::uwvm2::utils::container::u8cstring_view{::uwvm2::uwvm::cmdline::wasm_file_ppos->str};
 
-        // load main module
-        auto const load_wasm_file_rtl{::uwvm2::uwvm::wasm::loader::load_wasm_file(::uwvm2::uwvm::wasm::storage::execute_wasm,
-                                                                                  module_file_name,
-                                                                                  ::uwvm2::uwvm::wasm::storage::execute_wasm.module_name,
-                                                                                  ::uwvm2::uwvm::wasm::storage::wasm_parameter)};
+        // Task 0 is the main module, task `i` the preloaded module `i - 1`. The modules are independent, so they are parsed concurrently and duplicate
+        // module names are only checked once all of them are loaded. Every diagnostic, including a warning together with its fatal notice, is
+        // printed while holding the lock of `u8log_output`, so diagnostics of different modules do not interleave, but they follow no fixed order.
+        auto& preloaded_wasm{::uwvm2::uwvm::wasm::storage::preloaded_wasm};
+        auto const task_count{preloaded_wasm.size() + 1uz};
 
-        if(load_wasm_file_rtl != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+        ::uwvm2::utils::container::vector<::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl> load_wasm_file_rtls{};
+        load_wasm_file_rtls.resize(task_count);
+
+        auto load_task{[&](::std::size_t task) noexcept
+                       {
+                           auto& wf{task == 0uz ? ::uwvm2::uwvm::wasm::storage::execute_wasm : preloaded_wasm.index_unchecked(task - 1uz)};
+
+                           // Until the module is loaded, `module_name` holds the name given on the command line (`--wasm-set-main-module-name` or the
+                           // rename argument of `--wasm-preload-library`), which takes precedence over the custom name section.
+                           load_wasm_file_rtls.index_unchecked(task) =
+                               ::uwvm2::uwvm::wasm::loader::load_wasm_file(wf, wf.file_name, wf.module_name, ::uwvm2::uwvm::wasm::storage::wasm_parameter);
+                       }};
+
+        ::uwvm2::utils::thread::parallel_for_work_stealing(task_count, ::uwvm2::utils::thread::get_hardware_concurrency(), load_task);
+
+        // A failing preloaded module is a parameter error, as when it was loaded by its command line parameter.
+        for(::std::size_t task{1uz}; task != task_count; ++task)
+        {
+            if(load_wasm_file_rtls.index_unchecked(task) != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
+            {
+                return static_cast<int>(::uwvm2::uwvm::run::retval::parameter_error);
+            }
+        }
+
+        if(load_wasm_file_rtls.index_unchecked(0uz) != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok) [[unlikely]]
         {
             return static_cast<int>(::uwvm2::uwvm::run::retval::load_main_module_error);
         }
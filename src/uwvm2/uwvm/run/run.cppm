@@ -49,6 +49,7 @@ import uwvm2.uwvm.wasm;
 import uwvm2.uwvm.runtime;
 import :retval;
 import :loader;
+import :execute;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
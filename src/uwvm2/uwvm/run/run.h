@@ -48,6 +48,7 @@
 # include <uwvm2/uwvm/runtime/impl.h>
 # include "retval.h"
 # include "loader.h"
+# include "execute.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -136,7 +137,7 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::run
             case ::uwvm2::uwvm::wasm::base::mode::run:
             {
                 // non-img mode
-                /// @todo run interpreter
+                if(auto const ret{::uwvm2::uwvm::run::execute_wasm()}; ret != static_cast<int>(::uwvm2::uwvm::run::retval::ok)) [[unlikely]] { return ret; }
                 break;
             }
             /// @todo add more modes here
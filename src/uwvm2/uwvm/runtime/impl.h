@@ -25,4 +25,7 @@
 #ifndef UWVM_MODULE
 # include <uwvm2/uwvm/runtime/storage/impl.h>
 # include <uwvm2/uwvm/runtime/initializer/impl.h>
+# include <uwvm2/uwvm/runtime/snapshot/impl.h>
+# include <uwvm2/uwvm/runtime/numa/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
 #endif
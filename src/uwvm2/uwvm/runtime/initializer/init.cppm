@@ -45,6 +45,7 @@ import uwvm2.parser.wasm.standard.wasm1p1.type;
 import uwvm2.parser.wasm.standard.wasm3.type;
 import uwvm2.parser.wasm.binfmt.binfmt_ver1;
 import uwvm2.object;
+import uwvm2.object.memory.signal;
 import uwvm2.uwvm.io;
 import uwvm2.uwvm.utils.ansies;
 import uwvm2.uwvm.wasm;
@@ -44,6 +44,7 @@
 # include <uwvm2/parser/wasm/standard/wasm3/type/impl.h>
 # include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 # include <uwvm2/object/impl.h>
+# include <uwvm2/object/memory/signal/impl.h>
 # include <uwvm2/uwvm/io/impl.h>
 # include <uwvm2/uwvm/utils/ansies/impl.h>
 # include <uwvm2/uwvm/wasm/impl.h>
@@ -2217,6 +2218,16 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                     auto& rec{out.local_defined_memory_vec_storage.back()};
                     rec.memory_type_ptr = ::std::addressof(memory_type);
                     rec.memory.init_by_page_count(static_cast<::std::size_t>(memory_type.limits.min));
+
+#if defined(UWVM_SUPPORT_MMAP)
+                    // The whole reservation is registered: engines that elide bounds checks rely on faults anywhere past the committed length being
+                    // attributed to this memory.
+                    ::uwvm2::object::memory::signal::register_protected_segment(rec.memory.memory_begin,
+                                                                                rec.memory.memory_begin + rec.memory.get_acquire_reserved_space(),
+                                                                                rec.memory.memory_length_p,
+                                                                                out.imported_memory_vec_storage.size() +
+                                                                                    (out.local_defined_memory_vec_storage.size() - 1uz));
+#endif
                 }
             }
 
@@ -2733,6 +2744,59 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
             return page_count * page_size_bytes;
         }
 
+        /// @brief      Part of an active data segment mapped from the module file instead of copied, relative to the payload.
+        struct wasm1_file_mapped_range_t
+        {
+            ::std::size_t begin{};
+            ::std::size_t end{};
+        };
+
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        /// @brief      Active data segments shorter than this are always copied. A mapping splits the reservation and only pays off over many pages the module
+        ///             may never touch.
+        inline constexpr ::std::size_t min_file_mapped_data_segment_length{256uz * 1024uz};
+
+        /// @brief      Map the whole pages of an active data segment copy-on-write from the module file, see `mmap_memory_t::map_file_pages`.
+        /// @details    Only possible when the payload and its destination share the same offset within a platform page. The partial pages at both ends are
+        ///             left to the caller.
+        /// @return     The mapped range relative to the payload, empty when the whole segment has to be copied.
+        inline wasm1_file_mapped_range_t map_wasm1_data_segment_file_pages(::uwvm2::object::memory::linear::native_memory_t& memory,
+                                                                            ::std::size_t offset,
+                                                                            ::std::byte const* byte_begin,
+                                                                            ::std::size_t byte_count,
+                                                                            ::uwvm2::uwvm::wasm::type::wasm_file_t const* file_ptr) noexcept
+        {
+            if(file_ptr == nullptr || file_ptr->wasm_file_handle.fd == -1 || byte_count < min_file_mapped_data_segment_length) { return {}; }
+
+            // Modules that were not loaded from a file keep the handle closed, so the payload lies in the mapping of `wasm_file_handle`.
+            auto const file_begin{reinterpret_cast<::std::byte const*>(file_ptr->wasm_file.cbegin())};
+            auto const file_end{reinterpret_cast<::std::byte const*>(file_ptr->wasm_file.cend())};
+            if(byte_begin < file_begin || byte_begin > file_end || byte_count > static_cast<::std::size_t>(file_end - byte_begin)) [[unlikely]] { return {}; }
+
+            auto const file_offset{static_cast<::std::size_t>(byte_begin - file_begin)};
+
+            auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+            if(!success || page_size == 0uz) [[unlikely]] { return {}; }
+
+            auto const page_size_minus_1{page_size - 1uz};
+            if((offset & page_size_minus_1) != (file_offset & page_size_minus_1)) { return {}; }
+
+            // | head (copied) | whole pages (mapped) | tail (copied) |
+            auto const head{(page_size - (offset & page_size_minus_1)) & page_size_minus_1};
+            if(head >= byte_count) { return {}; }
+
+            auto const length{(byte_count - head) & ~page_size_minus_1};
+            if(length == 0uz) { return {}; }
+
+            if(!memory.map_file_pages(offset + head, length, file_ptr->wasm_file_handle.fd, static_cast<::std::uint_least64_t>(file_offset + head)))
+            {
+                return {};
+            }
+
+            return {head, head + length};
+        }
+#endif
+
         inline constexpr void apply_wasm1_active_element_and_data_segments_after_linking() noexcept
         {
             using table_elem_type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t;
@@ -3158,7 +3222,21 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                             ::fast_io::fast_terminate();
                         }
 
-                        ::fast_io::freestanding::my_memcpy(memory_begin + offset, byte_begin, byte_count);
+                        wasm1_file_mapped_range_t mapped{};
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+                        if(target_memory != nullptr)
+                        {
+                            mapped = map_wasm1_data_segment_file_pages(target_memory->memory, offset, byte_begin, byte_count, data.file_ptr);
+                        }
+#endif
+
+                        if(mapped.begin == mapped.end) { ::fast_io::freestanding::my_memcpy(memory_begin + offset, byte_begin, byte_count); }
+                        else
+                        {
+                            // Only the partial pages around the mapped range are copied.
+                            ::fast_io::freestanding::my_memcpy(memory_begin + offset, byte_begin, mapped.begin);
+                            ::fast_io::freestanding::my_memcpy(memory_begin + offset + mapped.end, byte_begin + mapped.end, byte_count - mapped.end);
+                        }
                     }
                 }
 
@@ -3189,6 +3267,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::initializer
                 case 1u:
                 {
                     initialize_from_binfmt_ver1_module_storage(wf.wasm_module_storage.wasm_binfmt_ver1_storage, out);
+
+                    // Payloads point into `wf.wasm_file`.
+                    for(auto& data_seg: out.local_defined_data_vec_storage) { data_seg.data.file_ptr = ::std::addressof(wf); }
                     break;
                 }
 
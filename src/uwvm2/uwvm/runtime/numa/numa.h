@@ -0,0 +1,98 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/numa/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::numa
+{
+    /// @brief      Move the state an instance touches on every call to `node`: linear memories, tables and globals defined by the module.
+    /// @details    Memories keep preferring `node` for the pages committed by later grows. Tables and globals are migrated page by page, their later
+    ///             allocations follow the thread that makes them. Code is left where it is, it is shared by every thread running the module.
+    /// @return     false if any part could not be moved, the parts that could stay on `node`.
+    /// @note       Must not run while the module executes on another thread, the pages of tables and globals are remapped under it.
+    inline bool migrate_module_to_numa_node(::uwvm2::uwvm::runtime::storage::wasm_module_storage_t& runtime_module, unsigned node) noexcept
+    {
+        if constexpr(!::uwvm2::utils::numa::support_numa) { return false; }
+
+        bool success{true};
+
+        for(auto& memory: runtime_module.local_defined_memory_vec_storage)
+        {
+            if constexpr(requires { memory.memory.migrate_to_numa_node(node); })
+            {
+                if(!memory.memory.migrate_to_numa_node(node)) { success = false; }
+            }
+            else
+            {
+                success = false;
+            }
+        }
+
+        for(auto const& table: runtime_module.local_defined_table_vec_storage)
+        {
+            if(table.elems.empty()) { continue; }
+            if(!::uwvm2::utils::numa::move_to_numa_node(table.elems.data(), table.elems.size() * sizeof(*table.elems.data()), node)) { success = false; }
+        }
+
+        auto const& globals{runtime_module.local_defined_global_vec_storage};
+        if(!globals.empty())
+        {
+            if(!::uwvm2::utils::numa::move_to_numa_node(globals.data(), globals.size() * sizeof(*globals.data()), node)) { success = false; }
+        }
+
+        return success;
+    }
+
+    /// @brief      Migrate every instantiated module to `node`, see `migrate_module_to_numa_node`.
+    inline bool migrate_all_modules_to_numa_node(unsigned node) noexcept
+    {
+        if constexpr(!::uwvm2::utils::numa::support_numa) { return false; }
+
+        bool success{true};
+        for(auto& [module_name, runtime_module]: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage)
+        {
+            if(!migrate_module_to_numa_node(runtime_module, node)) { success = false; }
+        }
+        return success;
+    }
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
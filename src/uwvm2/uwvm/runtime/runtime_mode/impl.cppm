@@ -22,8 +22,8 @@
 
 module;
 
-export module uwvm2.uwvm.runtime.storage;
-export import :wasm_module;
+export module uwvm2.uwvm.runtime.runtime_mode;
+export import :mode;
 export import :storage;
 
 #ifndef UWVM_MODULE
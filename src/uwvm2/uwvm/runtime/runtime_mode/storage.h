@@ -46,7 +46,17 @@
 
 UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::runtime_mode
 {
+    /// @brief  How function bodies are translated before they run, set by `--runtime-compile-mode`.
+    inline runtime_mode_t global_runtime_mode{runtime_mode_t::lazy_compile_with_full_code_verification};  // [global]
 
+    /// @brief  Which execution tiers run the translated functions, set by `--runtime-compiler`.
+    inline runtime_compiler_t global_runtime_compiler{runtime_compiler_t::uwvm_interpreter_only};  // [global]
+
+    /// @brief  Directory of the JIT code cache, set by `--runtime-code-cache`. Empty for no cache.
+    inline ::uwvm2::utils::container::u8string_view global_runtime_code_cache{};  // [global]
+
+    /// @brief  Snapshot file of the initialized instance, set by `--runtime-snapshot`. Empty for no snapshot.
+    inline ::uwvm2::utils::container::u8string_view global_runtime_snapshot{};  // [global]
 }
 
 #ifndef UWVM_MODULE
@@ -0,0 +1,562 @@
+/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <memory>
+# include <utility>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
+// platform
+# if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+#  include <sys/mman.h>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/hash/impl.h>
+# include <uwvm2/object/impl.h>
+# include <uwvm2/uwvm/io/impl.h>
+# include <uwvm2/uwvm/utils/ansies/impl.h>
+# include <uwvm2/uwvm/custom/impl.h>
+# include <uwvm2/uwvm/wasm/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::snapshot
+{
+    /// @brief      Snapshot of the instance once the start functions ran, so that a later run restores it instead of running them again.
+    /// @details    The snapshot holds the linear memories and globals defined by every module. Its key is the xxh3 hash of the names and bytes of the
+    ///             modules, seeded with the uwvm version and the format version, and a snapshot whose key differs is ignored. Layout, in host byte order:
+    ///
+    ///             | header | per module: record, name (padded to 8 bytes), globals, memories | padding | memory contents, each at a page boundary |
+    ///
+    ///             Tables are not stored: in wasm1 only the active element segments write them, and the initializer has applied those again. State outside
+    ///             of the modules (WASI files, environment, clocks) is not captured either, the restored instance holds what the start functions computed
+    ///             in the run that wrote the snapshot.
+    namespace details
+    {
+        /// @brief      "uwvmsnap" read as a little-endian integer, so a snapshot of the other byte order does not match.
+        inline constexpr ::std::uint_least64_t snapshot_magic{0x70616e736d767775u};
+
+        /// @brief      Bumped whenever the layout changes.
+        inline constexpr ::std::uint_least32_t snapshot_format_version{1u};
+
+        struct snapshot_header_t
+        {
+            ::std::uint_least64_t magic;
+            ::std::uint_least64_t key;
+            ::std::uint_least64_t module_count;
+        };
+
+        struct snapshot_module_t
+        {
+            ::std::uint_least64_t name_length;
+            ::std::uint_least64_t global_count;
+            ::std::uint_least64_t memory_count;
+        };
+
+        struct snapshot_global_t
+        {
+            ::std::uint_least64_t kind;
+            ::uwvm2::object::global::wasm_global_storage_u storage;
+        };
+
+        struct snapshot_memory_t
+        {
+            // In bytes.
+            ::std::uint_least64_t length;
+            ::std::uint_least64_t custom_page_size_log2;
+            // Offset of the contents in the snapshot, page-aligned when written.
+            ::std::uint_least64_t file_offset;
+        };
+
+        inline constexpr ::std::size_t snapshot_name_alignment{8uz};
+
+        inline ::std::uint_least64_t get_snapshot_key() noexcept
+        {
+            constexpr auto version{::uwvm2::uwvm::custom::uwvm_version};
+            ::std::uint_least32_t const seed_words[]{version.x, version.y, version.z, version.state, snapshot_format_version};
+            auto const seed{::uwvm2::utils::hash::xxh3_64bits(reinterpret_cast<::std::byte const*>(seed_words), sizeof(seed_words))};
+
+            ::std::uint_least64_t key{};
+            for(auto const& [module_name, runtime_module]: ::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage)
+            {
+                auto module_key{::uwvm2::utils::hash::xxh3_64bits(reinterpret_cast<::std::byte const*>(module_name.data()), module_name.size(), seed)};
+
+                auto const mod_it{::uwvm2::uwvm::wasm::storage::all_module.find(module_name)};
+                if(mod_it != ::uwvm2::uwvm::wasm::storage::all_module.end())
+                {
+                    auto const& mod{mod_it->second};
+                    if((mod.type == ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm ||
+                        mod.type == ::uwvm2::uwvm::wasm::type::module_type_t::preloaded_wasm) &&
+                       mod.module_storage_ptr.wf != nullptr)
+                    {
+                        auto const& wasm_file{mod.module_storage_ptr.wf->wasm_file};
+                        module_key =
+                            ::uwvm2::utils::hash::xxh3_64bits(reinterpret_cast<::std::byte const*>(wasm_file.cbegin()), wasm_file.size(), module_key);
+                    }
+                }
+
+                // Summed, so that the key does not depend on the iteration order of the map.
+                key += module_key;
+            }
+
+            return key;
+        }
+
+        inline ::std::size_t get_memory_length(::uwvm2::object::memory::linear::native_memory_t const& memory) noexcept
+        { return memory.get_page_size() << memory.custom_page_size_log2; }
+
+        inline void append_snapshot_bytes(::uwvm2::utils::container::vector<::std::byte>& out, void const* bytes, ::std::size_t size) noexcept
+        {
+            auto const old_size{out.size()};
+            out.resize(old_size + size);
+            ::fast_io::freestanding::my_memcpy(out.data() + old_size, bytes, size);
+        }
+
+        struct snapshot_reader_t
+        {
+            ::std::byte const* curr{};
+            ::std::byte const* end{};
+
+            inline bool read(void* bytes, ::std::size_t size) noexcept
+            {
+                if(size > static_cast<::std::size_t>(this->end - this->curr)) [[unlikely]] { return false; }
+                ::fast_io::freestanding::my_memcpy(bytes, this->curr, size);
+                this->curr += size;
+                return true;
+            }
+
+            inline bool read_name(::std::uint_least64_t name_length, ::uwvm2::utils::container::u8string_view& name) noexcept
+            {
+                auto const remaining{static_cast<::std::size_t>(this->end - this->curr)};
+                if(name_length > static_cast<::std::uint_least64_t>(remaining)) [[unlikely]] { return false; }
+
+                auto const length{static_cast<::std::size_t>(name_length)};
+                auto const padded_length{(length + (snapshot_name_alignment - 1uz)) & ~(snapshot_name_alignment - 1uz)};
+                if(padded_length > remaining) [[unlikely]] { return false; }
+
+                name = ::uwvm2::utils::container::u8string_view{reinterpret_cast<char8_t const*>(this->curr), length};
+                this->curr += padded_length;
+                return true;
+            }
+        };
+
+        struct snapshot_restore_memory_t
+        {
+            ::uwvm2::utils::container::u8string_view module_name{};
+            ::uwvm2::object::memory::linear::native_memory_t* memory{};
+            ::std::byte const* contents{};
+            ::std::size_t length{};
+            ::std::uint_least64_t file_offset{};
+        };
+
+        struct snapshot_restore_global_t
+        {
+            ::uwvm2::object::global::wasm_global_storage_t* global{};
+            ::uwvm2::object::global::wasm_global_storage_u storage{};
+        };
+
+        template <typename... Args>
+        inline constexpr void verbose_info(Args&&... args) noexcept
+        {
+            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                u8"uwvm: ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                u8"[info]  ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                u8"snapshot: ",
+                                ::std::forward<Args>(args)...,
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_GREEN),
+                                u8"[",
+                                ::uwvm2::uwvm::io::get_local_realtime(),
+                                u8"] ",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                u8"(verbose)\n",
+                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+        }
+
+        /// @brief      Validate the snapshot against the instance and collect what has to be restored, without changing anything yet.
+        inline bool parse_snapshot(::std::byte const* file_begin,
+                                   ::std::byte const* file_end,
+                                   ::uwvm2::utils::container::vector<snapshot_restore_memory_t>& memories,
+                                   ::uwvm2::utils::container::vector<snapshot_restore_global_t>& globals) noexcept
+        {
+            auto& runtime_storage{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage};
+            auto const file_size{static_cast<::std::size_t>(file_end - file_begin)};
+
+            snapshot_reader_t reader{file_begin, file_end};
+
+            snapshot_header_t header;  // No initialization necessary
+            if(!reader.read(::std::addressof(header), sizeof(header))) { return false; }
+            if(header.magic != snapshot_magic || header.key != get_snapshot_key() ||
+               header.module_count != static_cast<::std::uint_least64_t>(runtime_storage.size()))
+            {
+                return false;
+            }
+
+            for(::std::uint_least64_t module_index{}; module_index != header.module_count; ++module_index)
+            {
+                snapshot_module_t module_record;  // No initialization necessary
+                if(!reader.read(::std::addressof(module_record), sizeof(module_record))) [[unlikely]] { return false; }
+
+                ::uwvm2::utils::container::u8string_view module_name{};
+                if(!reader.read_name(module_record.name_length, module_name)) [[unlikely]] { return false; }
+
+                auto const runtime_it{runtime_storage.find(module_name)};
+                if(runtime_it == runtime_storage.end()) [[unlikely]] { return false; }
+                auto& runtime_module{runtime_it->second};
+
+                if(module_record.global_count != static_cast<::std::uint_least64_t>(runtime_module.local_defined_global_vec_storage.size())) [[unlikely]]
+                {
+                    return false;
+                }
+
+                for(auto& global: runtime_module.local_defined_global_vec_storage)
+                {
+                    snapshot_global_t global_record;  // No initialization necessary
+                    if(!reader.read(::std::addressof(global_record), sizeof(global_record))) [[unlikely]] { return false; }
+                    if(global_record.kind != static_cast<::std::uint_least64_t>(global.global.kind)) [[unlikely]] { return false; }
+
+                    globals.push_back({::std::addressof(global.global), global_record.storage});
+                }
+
+                if(module_record.memory_count != static_cast<::std::uint_least64_t>(runtime_module.local_defined_memory_vec_storage.size())) [[unlikely]]
+                {
+                    return false;
+                }
+
+                for(auto& memory: runtime_module.local_defined_memory_vec_storage)
+                {
+                    snapshot_memory_t memory_record;  // No initialization necessary
+                    if(!reader.read(::std::addressof(memory_record), sizeof(memory_record))) [[unlikely]] { return false; }
+
+                    if(memory_record.custom_page_size_log2 != static_cast<::std::uint_least64_t>(memory.memory.custom_page_size_log2)) [[unlikely]]
+                    {
+                        return false;
+                    }
+
+                    // The contents must lie in the file, which also bounds the length by `size_t`.
+                    if(memory_record.file_offset > static_cast<::std::uint_least64_t>(file_size) ||
+                       memory_record.length > static_cast<::std::uint_least64_t>(file_size) - memory_record.file_offset) [[unlikely]]
+                    {
+                        return false;
+                    }
+
+                    // Memories only grow, by whole pages.
+                    auto const length{static_cast<::std::size_t>(memory_record.length)};
+                    auto const current_length{get_memory_length(memory.memory)};
+                    if(length < current_length || (((length - current_length) >> memory.memory.custom_page_size_log2) << memory.memory.custom_page_size_log2) !=
+                                                      length - current_length) [[unlikely]]
+                    {
+                        return false;
+                    }
+
+                    memories.push_back(
+                        {module_name, ::std::addressof(memory.memory), file_begin + memory_record.file_offset, length, memory_record.file_offset});
+                }
+            }
+
+            return true;
+        }
+    }  // namespace details
+
+    /// @brief      Restore the instance from the snapshot at `path`, in place of running the start functions. Must be called after the initializer and
+    ///             before any wasm code runs.
+    /// @details    On POSIX mmap memories the whole pages of the contents are mapped copy-on-write from the snapshot, so only the pages the module
+    ///             touches are read. Everything else is copied.
+    /// @return     false if there is no snapshot or it does not match the instance. Nothing has been changed then, and the start functions have to run.
+    inline bool restore_snapshot(::uwvm2::utils::container::u8string_view path) noexcept
+    {
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        ::fast_io::native_file file{};
+#endif
+        ::fast_io::native_file_loader loader{};
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+            file = ::fast_io::native_file{path, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+            // Not populated: the contents are mapped into the memories below.
+            loader = ::fast_io::native_file_loader{::fast_io::posix_mmap_options{PROT_READ, MAP_PRIVATE}, ::fast_io::posix_at_entry{file.fd}};
+#else
+            loader = ::fast_io::native_file_loader{path, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+#endif
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+            {
+                details::verbose_info(u8"No snapshot \"",
+                                      ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                      path,
+                                      ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                      u8"\" to restore. ");
+            }
+            return false;
+        }
+#endif
+
+        ::uwvm2::utils::container::vector<details::snapshot_restore_memory_t> memories{};
+        ::uwvm2::utils::container::vector<details::snapshot_restore_global_t> globals{};
+        if(!details::parse_snapshot(reinterpret_cast<::std::byte const*>(loader.cbegin()),
+                                    reinterpret_cast<::std::byte const*>(loader.cend()),
+                                    memories,
+                                    globals))
+        {
+            if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+            {
+                details::verbose_info(u8"The snapshot \"",
+                                      ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                      path,
+                                      ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                      u8"\" does not match the modules, it is written again. ");
+            }
+            return false;
+        }
+
+        for(auto const& restore: memories)
+        {
+            auto const current_length{details::get_memory_length(*restore.memory)};
+            if(!restore.memory->grow_strictly((restore.length - current_length) >> restore.memory->custom_page_size_log2)) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                    u8"[fatal] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Cannot grow the memory of module \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    restore.module_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\" to the ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    restore.length,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8" bytes of the snapshot.\n\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                ::fast_io::fast_terminate();
+            }
+
+            ::std::size_t mapped_length{};
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+            if(auto const [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()}; success && page_size != 0uz)
+            {
+                auto const page_size_minus_1{page_size - 1uz};
+                auto const whole_pages_length{restore.length & ~page_size_minus_1};
+                // A snapshot written with a smaller page size may not be aligned here.
+                if(whole_pages_length != 0uz && (restore.file_offset & static_cast<::std::uint_least64_t>(page_size_minus_1)) == 0u &&
+                   restore.memory->map_file_pages(0uz, whole_pages_length, file.fd, restore.file_offset))
+                {
+                    mapped_length = whole_pages_length;
+                }
+            }
+#endif
+
+            ::fast_io::freestanding::my_memcpy(restore.memory->memory_begin + mapped_length, restore.contents + mapped_length, restore.length - mapped_length);
+        }
+
+        for(auto const& restore: globals) { restore.global->storage = restore.storage; }
+
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+            details::verbose_info(u8"Restored the instance from \"",
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                  path,
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                  u8"\" (memories=",
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                  memories.size(),
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                  u8", globals=",
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                  globals.size(),
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                  u8"), the start functions are skipped. ");
+        }
+
+        return true;
+    }
+
+    /// @brief      Write the instance to the snapshot at `path`, once the start functions ran.
+    /// @details    The snapshot is written to `<path>.tmp`, which then replaces `path`, so a concurrent run never reads a partial snapshot. A failure is
+    ///             reported as a warning, the next run then runs the start functions again.
+    inline void save_snapshot(::uwvm2::utils::container::u8string_view path) noexcept
+    {
+        auto const& runtime_storage{::uwvm2::uwvm::runtime::storage::wasm_module_runtime_storage};
+
+        // Aligning the contents to the page size lets a later run map them instead of copying.
+        auto [page_size, success]{::uwvm2::object::memory::platform_page::get_platform_page_size()};
+        if(!success || page_size == 0uz) [[unlikely]] { page_size = 1uz; }
+        auto const page_size_minus_1{page_size - 1uz};
+
+        ::uwvm2::utils::container::vector<::std::byte> records{};
+        ::uwvm2::utils::container::vector<::uwvm2::object::memory::linear::native_memory_t const*> memories{};
+        // Position of the record of each memory in `records`, its offset is only known once all records are written.
+        ::uwvm2::utils::container::vector<::std::size_t> memory_record_positions{};
+
+        details::snapshot_header_t const header{.magic{details::snapshot_magic},
+                                                .key{details::get_snapshot_key()},
+                                                .module_count{static_cast<::std::uint_least64_t>(runtime_storage.size())}};
+        details::append_snapshot_bytes(records, ::std::addressof(header), sizeof(header));
+
+        for(auto const& [module_name, runtime_module]: runtime_storage)
+        {
+            auto const global_count{runtime_module.local_defined_global_vec_storage.size()};
+            auto const memory_count{runtime_module.local_defined_memory_vec_storage.size()};
+            details::snapshot_module_t const module_record{.name_length{static_cast<::std::uint_least64_t>(module_name.size())},
+                                                           .global_count{static_cast<::std::uint_least64_t>(global_count)},
+                                                           .memory_count{static_cast<::std::uint_least64_t>(memory_count)}};
+            details::append_snapshot_bytes(records, ::std::addressof(module_record), sizeof(module_record));
+
+            details::append_snapshot_bytes(records, module_name.data(), module_name.size());
+            records.resize((records.size() + (details::snapshot_name_alignment - 1uz)) & ~(details::snapshot_name_alignment - 1uz));
+
+            for(auto const& global: runtime_module.local_defined_global_vec_storage)
+            {
+                // Value-initialized, so that the padding of the record is written as zeros.
+                details::snapshot_global_t global_record{};
+                global_record.kind = static_cast<::std::uint_least64_t>(global.global.kind);
+                global_record.storage = global.global.storage;
+                details::append_snapshot_bytes(records, ::std::addressof(global_record), sizeof(global_record));
+            }
+
+            for(auto const& memory: runtime_module.local_defined_memory_vec_storage)
+            {
+                details::snapshot_memory_t const memory_record{.length{static_cast<::std::uint_least64_t>(details::get_memory_length(memory.memory))},
+                                                               .custom_page_size_log2{static_cast<::std::uint_least64_t>(memory.memory.custom_page_size_log2)},
+                                                               .file_offset{}};
+                memories.push_back(::std::addressof(memory.memory));
+                memory_record_positions.push_back(records.size());
+                details::append_snapshot_bytes(records, ::std::addressof(memory_record), sizeof(memory_record));
+            }
+        }
+
+        // | records | padding | contents of memory 0 | padding | contents of memory 1 | ...
+        records.resize((records.size() + page_size_minus_1) & ~page_size_minus_1);
+        auto file_offset{static_cast<::std::uint_least64_t>(records.size())};
+        for(auto const memory_record_position: memory_record_positions)
+        {
+            details::snapshot_memory_t memory_record;  // No initialization necessary
+            ::fast_io::freestanding::my_memcpy(::std::addressof(memory_record), records.data() + memory_record_position, sizeof(memory_record));
+            memory_record.file_offset = file_offset;
+            ::fast_io::freestanding::my_memcpy(records.data() + memory_record_position, ::std::addressof(memory_record), sizeof(memory_record));
+
+            file_offset += (memory_record.length + page_size_minus_1) & ~static_cast<::std::uint_least64_t>(page_size_minus_1);
+        }
+
+        ::uwvm2::utils::container::vector<::std::byte> padding{};
+        padding.resize(page_size);
+
+        auto const temp_path{::uwvm2::utils::container::u8concat_uwvm(path, u8".tmp")};
+
+#ifdef UWVM_CPP_EXCEPTIONS
+        try
+#endif
+        {
+            {
+                ::fast_io::native_file out{temp_path, ::fast_io::open_mode::out};
+                ::fast_io::operations::write_all_bytes(out, records.data(), records.data() + records.size());
+                for(auto const memory: memories)
+                {
+                    auto const length{details::get_memory_length(*memory)};
+                    ::fast_io::operations::write_all_bytes(out, memory->memory_begin, memory->memory_begin + length);
+                    auto const padding_length{((length + page_size_minus_1) & ~page_size_minus_1) - length};
+                    ::fast_io::operations::write_all_bytes(out, padding.data(), padding.data() + padding_length);
+                }
+            }
+
+            ::fast_io::native_renameat(::fast_io::at_fdcwd(), temp_path, ::fast_io::at_fdcwd(), path);
+        }
+#ifdef UWVM_CPP_EXCEPTIONS
+        catch(::fast_io::error)
+        {
+            if(::uwvm2::uwvm::io::show_vm_warning)
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    u8"[warn]  ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Cannot write the snapshot \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                    path,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\". ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                    u8"(vm)\n",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+
+                if(::uwvm2::uwvm::io::vm_warning_fatal) [[unlikely]]
+                {
+                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                        u8"uwvm: ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                        u8"[fatal] ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                        u8"Convert warnings to fatal errors. ",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                        u8"(vm)\n\n",
+                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                    ::fast_io::fast_terminate();
+                }
+            }
+            return;
+        }
+#endif
+
+        if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
+        {
+            details::verbose_info(u8"Wrote the snapshot \"",
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                  path,
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                  u8"\" (",
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                  file_offset,
+                                  ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                  u8" bytes). ");
+        }
+    }
+}  // namespace uwvm2::uwvm::runtime::snapshot
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/uwvm/utils/ansies/uwvm_color_pop_macro.h>
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
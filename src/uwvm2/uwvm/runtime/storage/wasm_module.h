@@ -558,6 +558,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::runtime::storage
         // meaningful only for passive segments; when true the payload is not available.
         // `data.drop` will set `byte_begin`/`byte_end` to nullptr, making it easier to validate.
         bool dropped{};
+
+        // module file the payload was parsed from; lets the initializer map page-aligned payloads instead of copying them.
+        ::uwvm2::uwvm::wasm::type::wasm_file_t const* file_ptr{};
     };
 
     template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
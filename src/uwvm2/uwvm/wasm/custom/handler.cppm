@@ -36,6 +36,7 @@ export module uwvm2.uwvm.wasm.custom:handler;
 
 import fast_io;
 import uwvm2.utils.container;
+import uwvm2.utils.mutex;
 import uwvm2.parser.wasm.concepts;
 import uwvm2.parser.wasm.standard.wasm1.type;
 import uwvm2.parser.wasm.standard.wasm1.features;
@@ -35,6 +35,7 @@
 // import
 # include <fast_io.h>
 # include <uwvm2/utils/container/impl.h>
+# include <uwvm2/utils/mutex/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/type/impl.h>
 # include <uwvm2/parser/wasm/standard/wasm1/features/impl.h>
@@ -60,6 +61,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::custom
         bool is_imported_c{};
     };
 
+    /// @brief      Imported C handlers are not required to be reentrant, while modules are loaded concurrently. Calls into them are serialized.
+    inline ::uwvm2::utils::mutex::mutex_t imported_c_handler_mutex{};  // [global]
+
     inline void handle_binfmtver1_custom_section(
         ::uwvm2::uwvm::wasm::type::wasm_file_t & wasm_file,
         ::uwvm2::utils::container::unordered_flat_map<::uwvm2::utils::container::u8string_view, handlefunc_t> const& custom_handler) noexcept
@@ -111,6 +115,8 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::custom
                     try
 #endif
                     {
+                        ::uwvm2::utils::mutex::mutex_guard_t imported_c_handler_guard{imported_c_handler_mutex};
+
                         using imported_c_handlefunc_may_alias_ptr_t UWVM_GNU_MAY_ALIAS = ::uwvm2::uwvm::wasm::type::imported_c_handlefunc_ptr_t;
                         reinterpret_cast<imported_c_handlefunc_may_alias_ptr_t>(
                             curr_custom_handler->second.handler)(cs.custom_begin, reinterpret_cast<wasm_byte_const_may_alias_ptr>(cs.sec_span.sec_end));
@@ -120,30 +126,43 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::custom
                     {
                         if(::uwvm2::uwvm::io::show_vm_warning)
                         {
-                            ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                                u8"uwvm: ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                                u8"[warn]  ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                u8"Caught to c++ exception when handling externally imported custom handler. ",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                u8"(vm)\n",
-                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-
-                            if(::uwvm2::uwvm::io::vm_warning_fatal) [[unlikely]]
                             {
-                                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                // Here, as an entire output, the mutex needs to be controlled uniformly.
+                                // Modules are loaded concurrently, the fatal notice must directly follow its warning.
+
+                                // No copies will be made here.
+                                auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+                                // Add raii locks while unlocking operations
+                                ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+                                    ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+                                // No copies will be made here.
+                                auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
+
+                                ::fast_io::io::perr(u8log_output_ul,
                                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                                     u8"uwvm: ",
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                                    u8"[fatal] ",
+                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                    u8"[warn]  ",
                                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                    u8"Convert warnings to fatal errors. ",
+                                                    u8"Caught to c++ exception when handling externally imported custom handler. ",
                                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                    u8"(vm)\n\n",
+                                                    u8"(vm)\n",
                                                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                                ::fast_io::fast_terminate();
+
+                                if(::uwvm2::uwvm::io::vm_warning_fatal) [[unlikely]]
+                                {
+                                    ::fast_io::io::perr(u8log_output_ul,
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                                        u8"uwvm: ",
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                                        u8"[fatal] ",
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                        u8"Convert warnings to fatal errors. ",
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                                        u8"(vm)\n\n",
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                                    ::fast_io::fast_terminate();
+                                }
                             }
                         }
                         // An exception may be thrown to catch.
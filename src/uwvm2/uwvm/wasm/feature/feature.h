@@ -31,6 +31,7 @@
 # include <uwvm2/utils/container/impl.h>
 # include <uwvm2/parser/wasm/concepts/impl.h>
 # include <uwvm2/parser/wasm/standard/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -70,6 +71,17 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::feature
     /// @brief binfmt ver1 module wasm parser (func pointer)
     inline constexpr auto binfmt_ver1_handler{::uwvm2::parser::wasm::concepts::operation::get_binfmt_handler_func_p_from_tuple<1u>(wasm_binfmt1_features)};
     static_assert(::std::is_pointer_v<decltype(binfmt_ver1_handler)>);  // check is func pointer
+
+    namespace details
+    {
+        template <::uwvm2::parser::wasm::concepts::wasm_feature... Fs>
+        inline consteval auto get_binfmt_ver1_stream_handler_func_p(::uwvm2::utils::container::tuple<Fs...>) noexcept
+        { return ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_stream_func<Fs...>; }
+    }  // namespace details
+
+    /// @brief binfmt ver1 module wasm parser for modules that are still arriving (func pointer), same features and results as binfmt_ver1_handler
+    inline constexpr auto binfmt_ver1_stream_handler{details::get_binfmt_ver1_stream_handler_func_p(wasm_binfmt1_features)};
+    static_assert(::std::is_pointer_v<decltype(binfmt_ver1_stream_handler)>);  // check is func pointer
     /// @brief binfmt ver1 module parameter storage_t (feature_parameter_t)
     using wasm_binfmt_ver1_feature_parameter_storage_t =
         decltype(::uwvm2::parser::wasm::concepts::get_feature_parameter_type_from_tuple(wasm_binfmt1_features));
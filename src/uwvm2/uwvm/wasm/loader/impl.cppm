@@ -23,6 +23,7 @@
 module;
 
 export module uwvm2.uwvm.wasm.loader;
+export import :stream;
 export import :wasm_file;
 export import :dl;
 export import :weak_symbol;
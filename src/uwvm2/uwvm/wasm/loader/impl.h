@@ -22,6 +22,7 @@
 #pragma once
 
 #ifndef UWVM_MODULE
+# include "stream.h"
 # include "wasm_file.h"
 # include "dl.h"
 # include "weak_symbol.h"
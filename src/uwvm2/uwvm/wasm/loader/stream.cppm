@@ -0,0 +1,55 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+module;
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <climits>
+#include <cerrno>
+#include <new>
+#include <atomic>
+#include <memory>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+// platform
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+#if defined(UWVM_SUPPORT_MULTITHREAD)
+# include <thread>
+#endif
+
+export module uwvm2.uwvm.wasm.loader:stream;
+
+import fast_io;
+import uwvm2.parser.wasm.binfmt.binfmt_ver1;
+
+#ifndef UWVM_MODULE
+# define UWVM_MODULE
+#endif
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT export
+#endif
+
+#include "stream.h"
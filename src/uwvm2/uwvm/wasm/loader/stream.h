@@ -0,0 +1,317 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#pragma once
+
+#ifndef UWVM_MODULE
+// std
+# include <cstddef>
+# include <cstdint>
+# include <climits>
+# include <cerrno>
+# include <new>
+# include <atomic>
+# include <memory>
+// macro
+# include <uwvm2/utils/macro/push_macros.h>
+// platform
+# if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+#  include <sys/mman.h>
+#  include <unistd.h>
+# endif
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+#  include <thread>
+# endif
+// import
+# include <fast_io.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+#endif
+
+#ifndef UWVM_MODULE_EXPORT
+# define UWVM_MODULE_EXPORT
+#endif
+
+UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
+{
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+    namespace details
+    {
+        /// @brief      Address space reserved for one streamed module. The parser keeps pointers into the bytes it has seen, so the buffer cannot grow by
+        ///             reallocation; it is reserved once and pages are only backed once the reader writes to them.
+        inline constexpr ::std::size_t wasm_file_stream_reservation_size{
+            static_cast<::std::size_t>(sizeof(::std::size_t) >= 8uz ? 4ull * 1024ull * 1024ull * 1024ull : 256ull * 1024ull * 1024ull)};
+
+        /// @brief      Bytes requested per read, a pipe returns at most its buffer (64 KB by default on Linux) anyway.
+        inline constexpr ::std::size_t wasm_file_stream_chunk_size{static_cast<::std::size_t>(1u) << 20u};
+
+        /// @brief      Set in `published` once the source is exhausted, the remaining bits are the number of readable bytes.
+        inline constexpr ::std::size_t wasm_file_stream_end_bit{static_cast<::std::size_t>(1u) << (sizeof(::std::size_t) * CHAR_BIT - 1uz)};
+
+        static_assert(wasm_file_stream_reservation_size < wasm_file_stream_end_bit);
+
+        /// @brief      State shared with the reader thread. Allocated on its own so that a reader still blocked on the source can outlive the stream.
+        struct wasm_file_stream_state_t
+        {
+            ::std::byte* begin{};
+            // Duplicate of the source descriptor, owned and closed by whoever reads the last chunk.
+            int fd{-1};
+            // errno of the failed read, 0 if the source ended normally. Written before the end bit is published.
+            int read_errno{};
+            // The module did not fit into the reservation. Written before the end bit is published.
+            bool overflow{};
+            // The parser gave up, stop after the current read.
+            ::std::atomic_bool cancelled{};
+            ::std::atomic_size_t published{};
+        };
+
+        inline void publish_wasm_file_stream_end(wasm_file_stream_state_t& state, ::std::size_t size) noexcept
+        {
+            ::fast_io::noexcept_call(::close, state.fd);
+            state.fd = -1;
+
+            state.published.store(size | wasm_file_stream_end_bit, ::std::memory_order_release);
+            state.published.notify_all();
+        }
+
+        /// @brief      Append one chunk from the source, false once the source is exhausted, failed or the stream was abandoned.
+        /// @note       Only one thread reads chunks: the reader thread, or the parser itself without thread support.
+        inline bool read_wasm_file_stream_chunk(wasm_file_stream_state_t& state) noexcept
+        {
+            // relaxed: only the reading thread stores to `published`.
+            auto const size{state.published.load(::std::memory_order_relaxed)};
+
+            if(state.cancelled.load(::std::memory_order_relaxed)) [[unlikely]]
+            {
+                publish_wasm_file_stream_end(state, size);
+                return false;
+            }
+
+            auto const room{wasm_file_stream_reservation_size - size};
+            if(room == 0uz) [[unlikely]]
+            {
+                state.overflow = true;
+                publish_wasm_file_stream_end(state, size);
+                return false;
+            }
+
+            auto const request{room < wasm_file_stream_chunk_size ? room : wasm_file_stream_chunk_size};
+
+            ::std::ptrdiff_t got;  // No initialization necessary
+            do {
+                got = static_cast<::std::ptrdiff_t>(::fast_io::noexcept_call(::read, state.fd, state.begin + size, request));
+            }
+            while(got < 0 && errno == EINTR);
+
+            if(got <= 0)
+            {
+                if(got < 0) [[unlikely]] { state.read_errno = errno; }
+                publish_wasm_file_stream_end(state, size);
+                return false;
+            }
+
+            state.published.store(size + static_cast<::std::size_t>(got), ::std::memory_order_release);
+            state.published.notify_all();
+            return true;
+        }
+    }  // namespace details
+
+    /// @brief      Module bytes read from a pipe, FIFO or stdin in chunks and handed to the parser while the transfer is still running.
+    /// @details    A reader thread appends every chunk to an address-stable reservation and publishes the new size. `module_stream()` feeds
+    ///             `binfmt_ver1_stream_handler`, which parses each section as soon as it is complete instead of waiting for the whole module. Without thread
+    ///             support the parser reads the chunks itself whenever it runs out of bytes.
+    struct wasm_file_stream_t
+    {
+        details::wasm_file_stream_state_t* state{};
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+        ::std::thread reader{};
+# endif
+
+        inline wasm_file_stream_t() noexcept = default;
+
+        inline wasm_file_stream_t(wasm_file_stream_t const&) = delete;
+        inline wasm_file_stream_t& operator= (wasm_file_stream_t const&) = delete;
+
+        inline ~wasm_file_stream_t() { this->abandon(); }
+
+        /// @brief      Start reading `source_fd`, which is duplicated and may be closed by the caller afterwards.
+        /// @return     errno of the failed `dup` or `mmap`, 0 on success.
+        inline int start(int source_fd) noexcept
+        {
+            auto const fd{::fast_io::noexcept_call(::dup, source_fd)};
+            if(fd < 0) [[unlikely]] { return errno; }
+
+            constexpr auto mmap_flags{MAP_PRIVATE |
+                                      MAP_ANONYMOUS
+# if defined(MAP_NORESERVE)
+                                      | MAP_NORESERVE
+# endif
+            };
+
+            auto const reserved{
+                ::fast_io::noexcept_call(::mmap, nullptr, details::wasm_file_stream_reservation_size, PROT_READ | PROT_WRITE, mmap_flags, -1, 0)};
+            if(reserved == MAP_FAILED) [[unlikely]]
+            {
+                auto const mmap_errno{errno};
+                ::fast_io::noexcept_call(::close, fd);
+                return mmap_errno;
+            }
+
+            using state_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, details::wasm_file_stream_state_t>;
+
+            this->state = state_allocator_t::allocate(1uz);
+            ::new(this->state) details::wasm_file_stream_state_t{};
+            this->state->begin = reinterpret_cast<::std::byte*>(reserved);
+            this->state->fd = fd;
+
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+            this->reader = ::std::thread{[state = this->state]() noexcept
+                                         {
+                                             while(details::read_wasm_file_stream_chunk(*state)) {}
+                                         }};
+# endif
+
+            return 0;
+        }
+
+        /// @brief      Block until at least `size` bytes are readable, return the number of readable bytes (less than `size` only at the end of the source).
+        inline ::std::size_t wait_for(::std::size_t size) noexcept
+        {
+            for(;;)
+            {
+                auto const published{this->state->published.load(::std::memory_order_acquire)};
+                auto const available{published & ~details::wasm_file_stream_end_bit};
+                if(available >= size || (published & details::wasm_file_stream_end_bit) != 0uz) { return available; }
+
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+                this->state->published.wait(published, ::std::memory_order_acquire);
+# else
+                details::read_wasm_file_stream_chunk(*this->state);
+# endif
+            }
+        }
+
+        inline static ::std::size_t wait_for_callback(void* context, ::std::size_t size) noexcept
+        { return static_cast<wasm_file_stream_t*>(context)->wait_for(size); }
+
+        [[nodiscard]] inline ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_stream_t module_stream() noexcept
+        { return {this->state->begin, this, wait_for_callback}; }
+
+        [[nodiscard]] inline ::std::byte const* data() const noexcept { return this->state->begin; }
+
+        /// @brief      Bytes readable so far.
+        [[nodiscard]] inline ::std::size_t size() const noexcept
+        { return this->state->published.load(::std::memory_order_acquire) & ~details::wasm_file_stream_end_bit; }
+
+        /// @brief      The source has ended and every byte is readable.
+        [[nodiscard]] inline bool ended() const noexcept
+        { return (this->state->published.load(::std::memory_order_acquire) & details::wasm_file_stream_end_bit) != 0uz; }
+
+        /// @brief      errno of the read that ended the source, 0 if it ended normally. Only meaningful once `ended()`.
+        [[nodiscard]] inline int read_errno() const noexcept { return this->state->read_errno; }
+
+        /// @brief      The module is larger than the reservation and was cut off. Only meaningful once `ended()`.
+        [[nodiscard]] inline bool overflow() const noexcept { return this->state->overflow; }
+
+        /// @brief      Block until the source has ended, return the size of the module.
+        inline ::std::size_t wait_for_end() noexcept { return this->wait_for(details::wasm_file_stream_reservation_size + 1uz); }
+
+        /// @brief      Wait for the end of the source and hand the module over to `loader`, which then owns and unmaps it like a file it loaded itself.
+        /// @note       The bytes stay at the same address, so everything parsed from `module_stream()` remains valid.
+        inline void finish(::fast_io::native_file_loader& loader) noexcept
+        {
+            auto const size{this->wait_for_end()};
+
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+            this->reader.join();
+# endif
+
+            auto const begin{this->state->begin};
+
+            auto const page_size_l{::sysconf(_SC_PAGESIZE)};
+            auto const page_size{page_size_l > 0l ? static_cast<::std::size_t>(page_size_l) : 4096uz};
+            auto const kept{(size + (page_size - 1uz)) & ~(page_size - 1uz)};
+
+            // Give back the part of the reservation the module does not use, the loader unmaps the rest.
+            if(kept != details::wasm_file_stream_reservation_size &&
+               ::fast_io::details::sys_munmap_nothrow(begin + kept, details::wasm_file_stream_reservation_size - kept)) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            loader = ::fast_io::native_file_loader{};
+            if(size != 0uz)
+            {
+                loader.address_begin = reinterpret_cast<char*>(begin);
+                loader.address_end = reinterpret_cast<char*>(begin + size);
+            }
+
+            this->release_state();
+        }
+
+        /// @brief      Give up on the stream, for example after a parse error.
+        /// @details    A reader still blocked on the source cannot be interrupted: it is detached together with the reservation and its state, and stops after
+        ///             its current read. Both are leaked, the caller is about to report the error.
+        inline void abandon() noexcept
+        {
+            if(this->state == nullptr) { return; }
+
+            if(!this->ended())
+            {
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+                this->state->cancelled.store(true, ::std::memory_order_relaxed);
+                this->reader.detach();
+                this->state = nullptr;
+                return;
+# else
+                // The parser is the reader, nothing else touches the state.
+                details::publish_wasm_file_stream_end(*this->state, this->size());
+# endif
+            }
+
+# if defined(UWVM_SUPPORT_MULTITHREAD)
+            this->reader.join();
+# endif
+
+            if(::fast_io::details::sys_munmap_nothrow(this->state->begin, details::wasm_file_stream_reservation_size)) [[unlikely]]
+            {
+                ::fast_io::fast_terminate();
+            }
+
+            this->release_state();
+        }
+
+    private:
+        inline void release_state() noexcept
+        {
+            using state_allocator_t = ::fast_io::typed_generic_allocator_adapter<::fast_io::native_global_allocator, details::wasm_file_stream_state_t>;
+
+            ::std::destroy_at(this->state);
+            state_allocator_t::deallocate_n(this->state, 1uz);
+            this->state = nullptr;
+        }
+    };
+#endif
+}
+
+#ifndef UWVM_MODULE
+// macro
+# include <uwvm2/utils/macro/pop_macros.h>
+#endif
@@ -26,6 +26,7 @@ module;
 #include <cstdint>
 #include <climits>
 #include <type_traits>
+#include <atomic>
 // macro
 #include <uwvm2/utils/macro/push_macros.h>
 #include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -52,6 +53,7 @@ import uwvm2.uwvm.wasm.storage;
 import uwvm2.uwvm.wasm.feature;
 import uwvm2.uwvm.wasm.custom;
 import uwvm2.uwvm.wasm.warning;
+import :stream;
 
 #ifndef UWVM_MODULE
 # define UWVM_MODULE
@@ -27,6 +27,7 @@
 # include <cstdint>
 # include <climits>
 # include <type_traits>
+# include <atomic>
 // macro
 # include <uwvm2/utils/macro/push_macros.h>
 # include <uwvm2/uwvm/utils/ansies/uwvm_color_push_macro.h>
@@ -51,6 +52,7 @@
 # include <uwvm2/uwvm/wasm/feature/impl.h>
 # include <uwvm2/uwvm/wasm/custom/impl.h>
 # include <uwvm2/uwvm/wasm/warning/impl.h>
+# include "stream.h"
 #endif
 
 #ifndef UWVM_MODULE_EXPORT
@@ -66,6 +68,60 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
         wasm_parser_error
     };
 
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+    namespace details
+    {
+        /// @brief      Report a streamed module whose source failed or did not fit, false if the source ended normally.
+        /// @note       Only meaningful once the stream has ended.
+        inline bool report_wasm_file_stream_error(::uwvm2::utils::container::u8cstring_view load_file_name,
+                                                  ::uwvm2::uwvm::wasm::loader::wasm_file_stream_t const& wasm_stream) noexcept
+        {
+            if(wasm_stream.overflow()) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Unable to read WASM file \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    load_file_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": The module exceeds the streaming limit of ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    ::uwvm2::uwvm::wasm::loader::details::wasm_file_stream_reservation_size,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8" bytes.",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                    u8"\n\n");
+                return true;
+            }
+
+            if(auto const read_errno{wasm_stream.read_errno()}; read_errno != 0) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Unable to read WASM file \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    load_file_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    ::fast_io::error{::fast_io::posix_domain_value, static_cast<::std::size_t>(static_cast<unsigned>(read_errno))},
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                    u8"\n\n");
+                return true;
+            }
+
+            return false;
+        }
+    }  // namespace details
+#endif
+
     inline constexpr load_wasm_file_rtl load_wasm_file(::uwvm2::uwvm::wasm::type::wasm_file_t & wf,
                                                        ::uwvm2::utils::container::u8cstring_view load_file_name,
                                                        ::uwvm2::utils::container::u8string_view rename_module_name,
@@ -232,6 +288,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 #else
         // win9x and posix
 
+# if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        // Descriptor of a pipe, FIFO or stdin the module is streamed from, -1 for regular files.
+        int stream_source_fd{-1};
+# endif
+
 # ifdef UWVM_CPP_EXCEPTIONS
         try
 # endif
@@ -242,7 +303,30 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 
             // On platforms where CHAR_BIT is greater than 8, there is no need to clear the utf-8 non-low 8 bits here
             // allow symlink
+# if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+            if(load_file_name == u8"-")
+            {
+                // "-" is stdin
+                stream_source_fd = 0;
+            }
+            else
+            {
+                // Keep the descriptor: the initializer maps page-aligned data segments from it.
+                wf.wasm_file_handle = ::fast_io::native_file{load_file_name, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+
+                if(status(wf.wasm_file_handle).type == ::fast_io::file_type::regular)
+                {
+                    wf.wasm_file = ::fast_io::native_file_loader{::fast_io::posix_at_entry{wf.wasm_file_handle.fd}};
+                }
+                else
+                {
+                    // Pipes, FIFOs and character devices have no size to map, they are read in chunks and parsed while they arrive.
+                    stream_source_fd = wf.wasm_file_handle.fd;
+                }
+            }
+# else
             wf.wasm_file = ::fast_io::native_file_loader{load_file_name, ::fast_io::open_mode::in | ::fast_io::open_mode::follow};
+# endif
         }
 # ifdef UWVM_CPP_EXCEPTIONS
         catch(::fast_io::error e)
@@ -271,9 +355,59 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 # endif
 #endif
 
-        // binfmt_ver has to be modified by the change_binfmt_ver function.
-        wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                                       reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        // Abandoned on every early return: a reader still blocked on the source is detached.
+        ::uwvm2::uwvm::wasm::loader::wasm_file_stream_t wasm_stream{};
+
+        bool is_streaming{};
+
+        if(stream_source_fd != -1)
+        {
+            if(auto const start_errno{wasm_stream.start(stream_source_fd)}; start_errno != 0) [[unlikely]]
+            {
+                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                    u8"uwvm: ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RED),
+                                    u8"[error] ",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"Unable to open WASM file \"",
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_CYAN),
+                                    load_file_name,
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                    u8"\": ",
+                                    ::fast_io::error{::fast_io::posix_domain_value, static_cast<::std::size_t>(static_cast<unsigned>(start_errno))},
+                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                    u8"\n\n");
+
+                return load_wasm_file_rtl::load_error;
+            }
+
+            // The stream reads from its own descriptor, and nothing can be mapped from a pipe.
+            wf.wasm_file_handle = ::fast_io::native_file{};
+
+            // Only the header is needed to pick the parser.
+            auto const header_size{wasm_stream.wait_for(8uz)};
+            wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(wasm_stream.data(), wasm_stream.data() + header_size));
+
+            if(wf.binfmt_ver == static_cast<::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32>(1u)) { is_streaming = true; }
+            else
+            {
+                // No streaming parser for this version, take the whole module and continue as if it had been mapped.
+                wasm_stream.wait_for_end();
+
+                if(details::report_wasm_file_stream_error(load_file_name, wasm_stream)) [[unlikely]] { return load_wasm_file_rtl::load_error; }
+
+                wasm_stream.finish(wf.wasm_file);
+            }
+        }
+        else
+#endif
+        {
+            // binfmt_ver has to be modified by the change_binfmt_ver function.
+            wf.change_binfmt_ver(::uwvm2::parser::wasm::binfmt::detect_wasm_binfmt_version(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                           reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())));
+        }
 
         // verbose
         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
@@ -304,7 +438,13 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 
         // After detect
         // Instructs to read the file all the way into memory
-        ::uwvm2::utils::madvise::my_madvise(wf.wasm_file.cbegin(), wf.wasm_file.size(), ::uwvm2::utils::madvise::madvise_flag::willneed);
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        // A streamed module is written into memory by the reader, there is no file behind it.
+        if(!is_streaming)
+#endif
+        {
+            ::uwvm2::utils::madvise::my_madvise(wf.wasm_file.cbegin(), wf.wasm_file.size(), ::uwvm2::utils::madvise::madvise_flag::willneed);
+        }
 
 #if CHAR_BIT > 8
         // Since files are either private page mapped or memory allocated and read, they can be modified directly.
@@ -403,11 +543,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 #endif
                         }
 
-                        wf.wasm_module_storage.wasm_binfmt_ver1_storage =
-                            ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
-                                                                              reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
-                                                                              execute_wasm_binfmt_ver1_storage_wasm_err,
-                                                                              wf.wasm_parameter.binfmt1_para);
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+                        if(is_streaming)
+                        {
+                            // Sections are parsed as they arrive, the parser returns once the source has ended.
+                            wf.wasm_module_storage.wasm_binfmt_ver1_storage =
+                                ::uwvm2::uwvm::wasm::feature::binfmt_ver1_stream_handler(wasm_stream.module_stream(),
+                                                                                         execute_wasm_binfmt_ver1_storage_wasm_err,
+                                                                                         wf.wasm_parameter.binfmt1_para);
+
+                            // A failed read looks like a module that ends early, which may still be well-formed.
+                            bool const stream_failed{details::report_wasm_file_stream_error(load_file_name, wasm_stream)};
+
+                            // The parsed storage points into the stream, the file loader takes it over.
+                            wasm_stream.finish(wf.wasm_file);
+
+                            if(stream_failed) [[unlikely]] { return load_wasm_file_rtl::load_error; }
+                        }
+                        else
+#endif
+                        {
+                            wf.wasm_module_storage.wasm_binfmt_ver1_storage =
+                                ::uwvm2::uwvm::wasm::feature::binfmt_ver1_handler(reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                                                                                  reinterpret_cast<::std::byte const*>(wf.wasm_file.cend()),
+                                                                                  execute_wasm_binfmt_ver1_storage_wasm_err,
+                                                                                  wf.wasm_parameter.binfmt1_para);
+                        }
 
                         ::fast_io::unix_timestamp parser_end_time{};
                         if(::uwvm2::uwvm::io::show_verbose) [[unlikely]]
@@ -460,14 +621,32 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                         }
 #  endif
 
+                        auto module_image_begin{reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin())};
+                        auto module_image_end{reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())};
+
+#  if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+                        if(is_streaming)
+                        {
+                            // A source that failed ends the module early, report the cause rather than the truncation.
+                            if(wasm_stream.ended() && details::report_wasm_file_stream_error(load_file_name, wasm_stream)) [[unlikely]]
+                            {
+                                return load_wasm_file_rtl::load_error;
+                            }
+
+                            // Show what had arrived when the parser gave up, the rest may still be in transfer.
+                            module_image_begin = wasm_stream.data();
+                            module_image_end = module_image_begin + wasm_stream.size();
+                        }
+#  endif
+
                         // default print_memory
-                        ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin()),
+                        ::uwvm2::uwvm::utils::memory::print_memory const memory_printer{module_image_begin,
                                                                                         execute_wasm_binfmt_ver1_storage_wasm_err.err_curr,
-                                                                                        reinterpret_cast<::std::byte const*>(wf.wasm_file.cend())};
+                                                                                        module_image_end};
 
                         // set errout
                         ::uwvm2::parser::wasm::base::error_output_t errout;
-                        errout.module_begin = reinterpret_cast<::std::byte const*>(wf.wasm_file.cbegin());
+                        errout.module_begin = module_image_begin;
                         errout.err = execute_wasm_binfmt_ver1_storage_wasm_err;
                         errout.flag.enable_ansi = static_cast<::std::uint_least8_t>(::uwvm2::uwvm::utils::ansies::put_color);
 #  if defined(_WIN32) && (_WIN32_WINNT < 0x0A00 || defined(_WIN32_WINDOWS))
@@ -667,47 +846,61 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
                                                                                                     reinterpret_cast<::std::byte const*>(module_name.cend())};
 
                                     // Output the main information and memory indication
-                                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                                        // 1
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                                        u8"uwvm: ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                                        u8"[warn]  ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                        u8"(offset=",
-                                                        ::fast_io::mnp::addrvw(utf8pos - module_name.cbegin()),
-                                                        u8") Module Name contains characters that are not recommended. Details: \"",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                                        ::uwvm2::utils::utf::get_utf_error_description<char8_t>(utf8err),
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                        u8"\". ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                        u8"(parser)\n",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                                        u8"\n"
-                                                        // 2
-                                                        u8"uwvm: ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
-                                                        u8"[info]  ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                        u8"Parser Memory Indication: ",
-                                                        memory_printer,
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
-                                                        u8"\n");
-
-                                    if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
                                     {
-                                        ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                        // Here, as an entire output, the mutex needs to be controlled uniformly.
+                                        // Modules are loaded concurrently, the fatal notice must directly follow its warning.
+
+                                        // No copies will be made here.
+                                        auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+                                        // Add raii locks while unlocking operations
+                                        ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+                                            ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+                                        // No copies will be made here.
+                                        auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
+
+                                        ::fast_io::io::perr(u8log_output_ul,
+                                                            // 1
                                                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                                             u8"uwvm: ",
-                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                                            u8"[fatal] ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                            u8"[warn]  ",
                                                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                            u8"Convert warnings to fatal errors. ",
+                                                            u8"(offset=",
+                                                            ::fast_io::mnp::addrvw(utf8pos - module_name.cbegin()),
+                                                            u8") Module Name contains characters that are not recommended. Details: \"",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                            ::uwvm2::utils::utf::get_utf_error_description<char8_t>(utf8err),
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                            u8"\". ",
                                                             ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                            u8"(parser)\n\n",
-                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                                        ::fast_io::fast_terminate();
+                                                            u8"(parser)\n",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                                            u8"\n"
+                                                            // 2
+                                                            u8"uwvm: ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_GREEN),
+                                                            u8"[info]  ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                            u8"Parser Memory Indication: ",
+                                                            memory_printer,
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL),
+                                                            u8"\n");
+
+                                        if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
+                                        {
+                                            ::fast_io::io::perr(
+                                                u8log_output_ul,
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                                u8"uwvm: ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                                u8"[fatal] ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                u8"Convert warnings to fatal errors. ",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                                u8"(parser)\n\n",
+                                                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                                            ::fast_io::fast_terminate();
+                                        }
                                     }
                                 }
                             }
@@ -776,31 +969,44 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::loader
 #ifndef UWVM_DISABLE_OUTPUT_WHEN_PARSE
                             if(::uwvm2::uwvm::io::show_parser_warning)
                             {
-                                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                                    // 1
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                                    u8"uwvm: ",
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                                                    u8"[warn]  ",
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                    u8"Module name is empty (zero length). ",
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                    u8"(parser)\n",
-                                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-
-                                if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
                                 {
-                                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                                    // Here, as an entire output, the mutex needs to be controlled uniformly.
+                                    // Modules are loaded concurrently, the fatal notice must directly follow its warning.
+
+                                    // No copies will be made here.
+                                    auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+                                    // Add raii locks while unlocking operations
+                                    ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+                                        ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+                                    // No copies will be made here.
+                                    auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
+
+                                    ::fast_io::io::perr(u8log_output_ul,
+                                                        // 1
                                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                                         u8"uwvm: ",
-                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                                        u8"[fatal] ",
+                                                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                                                        u8"[warn]  ",
                                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                                        u8"Convert warnings to fatal errors. ",
+                                                        u8"Module name is empty (zero length). ",
                                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                                        u8"(parser)\n\n",
+                                                        u8"(parser)\n",
                                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                                    ::fast_io::fast_terminate();
+
+                                    if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
+                                    {
+                                        ::fast_io::io::perr(u8log_output_ul,
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                                            u8"uwvm: ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                                            u8"[fatal] ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                                            u8"Convert warnings to fatal errors. ",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                                            u8"(parser)\n\n",
+                                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                                        ::fast_io::fast_terminate();
+                                    }
                                 }
                             }
 #endif
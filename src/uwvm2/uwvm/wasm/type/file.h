@@ -81,6 +81,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
         ::uwvm2::parser::wasm::standard::wasm1::type::wasm_u32 binfmt_ver{};
         // Memory-mapped or memory-copy (for platforms that don't support memory mapping) open wasm files
         ::fast_io::native_file_loader wasm_file{};
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+        // The file `wasm_file` was mapped from, kept open so that page-aligned data segments can be mapped copy-on-write into linear memory.
+        // Closed when the module does not come from a file.
+        ::fast_io::native_file wasm_file_handle{};
+#endif
         // Module parsing results
         wasm_file_module_storage_u wasm_module_storage{};
         // wasm_parameter_t
@@ -113,7 +118,11 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
 
         inline constexpr wasm_file_t(wasm_file_t&& other) noexcept :
             file_name{::std::move(other.file_name)}, module_name{::std::move(other.module_name)}, binfmt_ver{::std::move(other.binfmt_ver)},
-            wasm_file{::std::move(other.wasm_file)}, wasm_parameter{::std::move(other.wasm_parameter)}, wasm_custom_name{::std::move(other.wasm_custom_name)}
+            wasm_file{::std::move(other.wasm_file)},
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+            wasm_file_handle{::std::move(other.wasm_file_handle)},
+#endif
+            wasm_parameter{::std::move(other.wasm_parameter)}, wasm_custom_name{::std::move(other.wasm_custom_name)}
         {
             switch(this->binfmt_ver)
             {
@@ -157,6 +166,9 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::type
             this->module_name = ::std::move(other.module_name);
             this->binfmt_ver = ::std::move(other.binfmt_ver);
             this->wasm_file = ::std::move(other.wasm_file);
+#if defined(UWVM_SUPPORT_MMAP) && !(defined(_WIN32) || defined(__CYGWIN__)) && !defined(__wasm__)
+            this->wasm_file_handle = ::std::move(other.wasm_file_handle);
+#endif
             this->wasm_parameter = ::std::move(other.wasm_parameter);
             this->wasm_custom_name = ::std::move(other.wasm_custom_name);
 
@@ -69,49 +69,31 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::warning
 
         if(curr_memory.limits.min > theoretical_page_limit_of_32b_plat) [[unlikely]]
         {
-            ::fast_io::io::perr(
-                ::uwvm2::uwvm::io::u8log_output,
-                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                u8"uwvm: ",
-                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
-                u8"[warn]  ",
-                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                u8"The initial value of memory is greater than 65536 (this is the theoretical maximum size of wasm32, which may cause instantiation to fail).",
-                ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-
-            if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
             {
-                ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
-                                    u8"uwvm: ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
-                                    u8"[fatal] ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                                    u8"Convert warnings to fatal errors. ",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
-                                    u8"(parser)\n\n",
-                                    ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
-                ::fast_io::fast_terminate();
-            }
-        }
+                // Here, as an entire output, the mutex needs to be controlled uniformly.
+                // Modules are loaded concurrently, the fatal notice must directly follow its warning.
+
+                // No copies will be made here.
+                auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+                // Add raii locks while unlocking operations
+                ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+                    ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+                // No copies will be made here.
+                auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
 
-        if(curr_memory.limits.present_max)
-        {
-            if(curr_memory.limits.max > theoretical_page_limit_of_32b_plat) [[unlikely]]
-            {
                 ::fast_io::io::perr(
-                    ::uwvm2::uwvm::io::u8log_output,
+                    u8log_output_ul,
                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                     u8"uwvm: ",
                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
                     u8"[warn]  ",
                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
-                    u8"The maximum value of memory is greater than 65536 (this is the theoretical maximum size of wasm32, which may cause instantiation to fail).",
+                    u8"The initial value of memory is greater than 65536 (this is the theoretical maximum size of wasm32, which may cause instantiation to fail).",
                     ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
 
                 if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
                 {
-                    ::fast_io::io::perr(::uwvm2::uwvm::io::u8log_output,
+                    ::fast_io::io::perr(u8log_output_ul,
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
                                         u8"uwvm: ",
                                         ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
@@ -125,6 +107,50 @@ UWVM_MODULE_EXPORT namespace uwvm2::uwvm::wasm::warning
                 }
             }
         }
+
+        if(curr_memory.limits.present_max)
+        {
+            if(curr_memory.limits.max > theoretical_page_limit_of_32b_plat) [[unlikely]]
+            {
+                {
+                    // Here, as an entire output, the mutex needs to be controlled uniformly.
+                    // Modules are loaded concurrently, the fatal notice must directly follow its warning.
+
+                    // No copies will be made here.
+                    auto u8log_output_osr{::fast_io::operations::output_stream_ref(::uwvm2::uwvm::io::u8log_output)};
+                    // Add raii locks while unlocking operations
+                    ::fast_io::operations::decay::stream_ref_decay_lock_guard u8log_output_lg{
+                        ::fast_io::operations::decay::output_stream_mutex_ref_decay(u8log_output_osr)};
+                    // No copies will be made here.
+                    auto u8log_output_ul{::fast_io::operations::decay::output_stream_unlocked_ref_decay(u8log_output_osr)};
+
+                    ::fast_io::io::perr(
+                        u8log_output_ul,
+                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                        u8"uwvm: ",
+                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_YELLOW),
+                        u8"[warn]  ",
+                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                        u8"The maximum value of memory is greater than 65536 (this is the theoretical maximum size of wasm32, which may cause instantiation to fail).",
+                        ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+
+                    if(::uwvm2::uwvm::io::parser_warning_fatal) [[unlikely]]
+                    {
+                        ::fast_io::io::perr(u8log_output_ul,
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL_AND_SET_WHITE),
+                                            u8"uwvm: ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_LT_RED),
+                                            u8"[fatal] ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_WHITE),
+                                            u8"Convert warnings to fatal errors. ",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_ORANGE),
+                                            u8"(parser)\n\n",
+                                            ::fast_io::mnp::cond(::uwvm2::uwvm::utils::ansies::put_color, UWVM_COLOR_U8_RST_ALL));
+                        ::fast_io::fast_terminate();
+                    }
+                }
+            }
+        }
     }
 
     inline constexpr void show_wasm_memory_section_warning(::uwvm2::uwvm::wasm::type::wasm_file_t const& wasm,
@@ -0,0 +1,167 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+#ifndef UWVM_MODULE
+# include <fast_io.h>
+# include <fast_io_dsal/string.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/base/impl.h>
+# include <uwvm2/parser/wasm/binfmt/binfmt_ver1/impl.h>
+# include <uwvm2/parser/wasm/standard/wasm1/features/binfmt.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+namespace test
+{
+    using ::uwvm2::utils::container::u8string;
+
+    inline void append_byte(u8string& out, ::std::uint8_t b) noexcept { out.push_back(static_cast<char8_t>(b)); }
+
+    // Hands out a module a few bytes at a time, like a slow pipe.
+    struct chunked_source
+    {
+        ::std::size_t total{};
+        ::std::size_t available{};
+        ::std::uint_least32_t seed{};
+
+        inline static ::std::size_t wait_for(void* context, ::std::size_t size) noexcept
+        {
+            auto& source{*static_cast<chunked_source*>(context)};
+            while(source.available < size && source.available != source.total)
+            {
+                source.seed = source.seed * 1103515245u + 12345u;
+                auto const chunk{static_cast<::std::size_t>((source.seed >> 16u) % 64u) + 1uz};
+                source.available = source.total - source.available < chunk ? source.total : source.available + chunk;
+            }
+            return source.available;
+        }
+    };
+
+    struct parse_result
+    {
+        bool success{};
+        ::uwvm2::parser::wasm::base::wasm_parse_error_code err_code{};
+        ::std::byte const* err_curr{};
+    };
+
+    template <typename Feature>
+    inline parse_result parse_whole(::std::byte const* begin, ::std::byte const* end)
+    {
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        try
+        {
+            (void)::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_func<Feature>(begin, end, err, {});
+            return {true, {}, nullptr};
+        }
+        catch(::fast_io::error const&)
+        {
+            return {false, err.err_code, err.err_curr};
+        }
+    }
+
+    template <typename Feature>
+    inline parse_result parse_stream(::std::byte const* begin, ::std::byte const* end, ::std::uint_least32_t seed)
+    {
+        chunked_source source{static_cast<::std::size_t>(end - begin), 0uz, seed};
+        ::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_module_stream_t const stream{begin, ::std::addressof(source), chunked_source::wait_for};
+
+        ::uwvm2::parser::wasm::base::error_impl err{};
+        try
+        {
+            auto const storage{::uwvm2::parser::wasm::binfmt::ver1::wasm_binfmt_ver1_handle_stream_func<Feature>(stream, err, {})};
+            if(storage.module_span.module_begin != begin || storage.module_span.module_end != end) { ::fast_io::fast_terminate(); }
+            return {true, {}, nullptr};
+        }
+        catch(::fast_io::error const&)
+        {
+            return {false, err.err_code, err.err_curr};
+        }
+    }
+}  // namespace test
+
+int main()
+{
+    using Feature = ::uwvm2::parser::wasm::standard::wasm1::features::wasm1;
+
+    ::fast_io::io::perr("Checking that streamed modules parse like mapped modules ...\n");
+
+    ::fast_io::ibuf_white_hole_engine eng;
+    ::std::uniform_int_distribution<int> prob{0, 99};
+    ::std::uniform_int_distribution<::std::uint32_t> len_eng{0u, 256u};
+
+    for(unsigned round{}; round != 20000u; ++round)
+    {
+        ::uwvm2::utils::container::u8string mod;
+
+        // wasm magic + version, corrupted now and then
+        for(::std::uint8_t const b: {0x00u, 0x61u, 0x73u, 0x6Du, 0x01u, 0x00u, 0x00u, 0x00u}) { test::append_byte(mod, b); }
+        if(prob(eng) < 5) { mod[3] = u8'X'; }
+
+        // Sections with random ids and payloads, some lengths are wrong or unterminated
+        ::std::uniform_int_distribution<int> sec_cnt_eng{0, 12};
+        for(int i{}, sec_cnt{sec_cnt_eng(eng)}; i != sec_cnt; ++i)
+        {
+            test::append_byte(mod, static_cast<::std::uint8_t>(prob(eng) % 13));
+
+            auto const len{len_eng(eng)};
+            if(prob(eng) < 3)
+            {
+                test::append_byte(mod, 0x80u);
+                continue;
+            }
+
+            auto v{len};
+            do {
+                ::std::uint8_t byte{static_cast<::std::uint8_t>(v & 0x7Fu)};
+                v >>= 7u;
+                if(v != 0u) { byte = static_cast<::std::uint8_t>(byte | 0x80u); }
+                test::append_byte(mod, byte);
+            }
+            while(v != 0u);
+
+            auto const real_len{prob(eng) < 5 ? len / 2u : len};
+            for(::std::uint32_t j{}; j != real_len; ++j) { test::append_byte(mod, static_cast<::std::uint8_t>(prob(eng))); }
+        }
+
+        // Truncate now and then so that the source ends in the middle of a section
+        auto size{mod.size()};
+        if(prob(eng) < 10 && size != 0uz) { size = static_cast<::std::size_t>(len_eng(eng)) % size; }
+
+        auto const* begin = reinterpret_cast<::std::byte const*>(mod.data());
+        auto const* end = begin + size;
+
+        auto const whole{test::parse_whole<Feature>(begin, end)};
+        auto const streamed{test::parse_stream<Feature>(begin, end, round)};
+
+        if(whole.success != streamed.success || whole.err_code != streamed.err_code || whole.err_curr != streamed.err_curr) [[unlikely]]
+        {
+            ::fast_io::io::perrln("mismatch in round ", round);
+            ::fast_io::fast_terminate();
+        }
+    }
+
+    ::fast_io::io::perr("Streamed modules match.\n");
+}
@@ -0,0 +1,296 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+// macro
+#include <uwvm2/utils/macro/push_macros.h>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/parser/wasm/utils/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+// `uleb128_single_byte_run` and `decode_uleb128_vector` against a value-by-value `leb128_get` decoder: runs ending on every position around the
+// 32, 16 and 8 byte blocks of the vector paths and the scalar tail, out-of-bound values inside a run and after it, multi-byte values at the end
+// of the input, truncated and over-long encodings, and random vectors.
+
+namespace
+{
+    using ::uwvm2::parser::wasm::utils::decode_uleb128_vector;
+    using ::uwvm2::parser::wasm::utils::uleb128_single_byte_run;
+    using ::uwvm2::parser::wasm::utils::uleb128_vector_result_t;
+    using byte_vector = ::uwvm2::utils::container::vector<::std::byte>;
+    using u32_vector = ::uwvm2::utils::container::vector<::std::uint_least32_t>;
+
+    [[noreturn]] inline void fail(::uwvm2::utils::container::u8string_view msg, ::std::size_t a, ::std::size_t b) noexcept
+    {
+        ::fast_io::io::perr(::fast_io::u8err(), u8"varint vector test error: ", msg, u8" (", a, u8", ", b, u8")\n");
+        ::fast_io::fast_terminate();
+    }
+
+    inline void append_uleb128(byte_vector& out, ::std::uint_least64_t value) noexcept
+    {
+        do
+        {
+            auto byte{static_cast<::std::uint_least8_t>(value & 0x7Fu)};
+            value >>= 7u;
+            if(value != 0u) { byte |= 0x80u; }
+            out.push_back(static_cast<::std::byte>(byte));
+        }
+        while(value != 0u);
+    }
+
+    // What the parser did before the kernel, one `leb128_get` and one bound check per value.
+    inline uleb128_vector_result_t reference_decode(::std::byte const* curr,
+                                                    ::std::byte const* const end,
+                                                    ::std::uint_least32_t* const out,
+                                                    ::std::size_t const count,
+                                                    ::std::uint_least32_t const bound) noexcept
+    {
+        using char8_t_const_may_alias_ptr UWVM_GNU_MAY_ALIAS = char8_t const*;
+
+        for(::std::size_t i{}; i != count; ++i)
+        {
+            ::std::uint_least32_t value;  // No initialization necessary
+            auto const [next, parse_err]{::fast_io::parse_by_scan(reinterpret_cast<char8_t_const_may_alias_ptr>(curr),
+                                                                  reinterpret_cast<char8_t_const_may_alias_ptr>(end),
+                                                                  ::fast_io::mnp::leb128_get(value))};
+            if(parse_err != ::fast_io::parse_code::ok) { return {curr, i, parse_err, false}; }
+            out[i] = value;
+            if(value >= bound) { return {curr, i, ::fast_io::parse_code::invalid, true}; }
+            curr = reinterpret_cast<::std::byte const*>(next);
+        }
+        return {curr, count, ::fast_io::parse_code::ok, false};
+    }
+
+    // Decode `bytes` as `count` values with both decoders. The input is copied to a buffer of its exact size so that reads past the end are
+    // visible to sanitizers.
+    inline uleb128_vector_result_t check_decode(byte_vector const& bytes, ::std::size_t count, ::std::uint_least32_t bound) noexcept
+    {
+        byte_vector input{};
+        input.reserve(bytes.size());
+        for(auto const b: bytes) { input.push_back(b); }
+
+        u32_vector out{};
+        out.resize(count);
+        u32_vector expected_out{};
+        expected_out.resize(count);
+
+        auto const begin{input.data()};
+        auto const end{input.data() + input.size()};
+        auto const res{decode_uleb128_vector(begin, end, out.data(), count, bound)};
+        auto const expected{reference_decode(begin, end, expected_out.data(), count, bound)};
+
+        if(res.code != expected.code) { fail(u8"parse code", static_cast<::std::size_t>(res.code), static_cast<::std::size_t>(expected.code)); }
+        if(res.out_of_bound != expected.out_of_bound) { fail(u8"out_of_bound", res.out_of_bound, expected.out_of_bound); }
+        if(res.curr != expected.curr) { fail(u8"curr", static_cast<::std::size_t>(res.curr - begin), static_cast<::std::size_t>(expected.curr - begin)); }
+        if(res.count != expected.count) { fail(u8"count", res.count, expected.count); }
+
+        // Values written before the stop, plus the offending one when it is out of bound.
+        auto const written{res.count + (res.out_of_bound ? 1uz : 0uz)};
+        for(::std::size_t i{}; i != written; ++i)
+        {
+            if(out.index_unchecked(i) != expected_out.index_unchecked(i)) { fail(u8"value", i, expected_out.index_unchecked(i)); }
+        }
+
+        return res;
+    }
+
+    inline void test_single_byte_run() noexcept
+    {
+        // Every run length up to past two 32 byte blocks, from every alignment of a 32 byte block, ending at a multi-byte value or at `end`.
+        for(::std::size_t offset{}; offset != 32uz; ++offset)
+        {
+            for(::std::size_t len{}; len != 80uz; ++len)
+            {
+                byte_vector buffer{};
+                for(::std::size_t i{}; i != offset + len; ++i) { buffer.push_back(static_cast<::std::byte>(i & 0x7Fu)); }
+
+                auto const begin{buffer.data() + offset};
+                if(auto const run{uleb128_single_byte_run(begin, begin + len)}; run != len) { fail(u8"run to end", len, run); }
+
+                buffer.push_back(::std::byte{0x80});
+                buffer.push_back(::std::byte{0x01});
+                for(::std::size_t i{}; i != 40uz; ++i) { buffer.push_back(::std::byte{0x05}); }
+
+                auto const begin2{buffer.data() + offset};
+                if(auto const run{uleb128_single_byte_run(begin2, buffer.data() + buffer.size())}; run != len) { fail(u8"run to multi-byte", len, run); }
+            }
+        }
+    }
+
+    inline void test_run_boundaries() noexcept
+    {
+        // A run of `len` single-byte values followed by two-byte values and another run, for every run length around the block sizes.
+        for(::std::size_t len{}; len != 100uz; ++len)
+        {
+            byte_vector bytes{};
+            ::std::size_t count{};
+            for(::std::size_t i{}; i != len; ++i, ++count) { append_uleb128(bytes, i & 0x7Fu); }
+            for(::std::size_t i{}; i != 3uz; ++i, ++count) { append_uleb128(bytes, 128u + i * 1000u); }
+            for(::std::size_t i{}; i != len % 37uz; ++i, ++count) { append_uleb128(bytes, i); }
+
+            auto const res{check_decode(bytes, count, 100000u)};
+            if(res.code != ::fast_io::parse_code::ok || res.count != count) { fail(u8"run boundary", len, res.count); }
+
+            // Fewer values than encoded: the decoder must stop after `count` of them.
+            if(count != 0uz) { check_decode(bytes, count - 1uz, 100000u); }
+        }
+    }
+
+    inline void test_out_of_bound_in_run() noexcept
+    {
+        // One value of a single-byte run is not below the bound, at every position of runs around the block sizes.
+        for(::std::size_t len{1uz}; len != 80uz; ++len)
+        {
+            for(::std::size_t pos{}; pos != len; ++pos)
+            {
+                byte_vector bytes{};
+                for(::std::size_t i{}; i != len; ++i) { append_uleb128(bytes, i == pos ? 100u : i % 50u); }
+                append_uleb128(bytes, 300u);
+
+                auto const res{check_decode(bytes, len + 1uz, 50u)};
+                if(!res.out_of_bound || res.count != pos || res.code != ::fast_io::parse_code::invalid) { fail(u8"out of bound in run", len, pos); }
+            }
+        }
+
+        // A two-byte value out of bound after a run.
+        for(::std::size_t len{}; len != 40uz; ++len)
+        {
+            byte_vector bytes{};
+            for(::std::size_t i{}; i != len; ++i) { append_uleb128(bytes, 7u); }
+            append_uleb128(bytes, 5000u);
+            append_uleb128(bytes, 1u);
+
+            auto const res{check_decode(bytes, len + 2uz, 4096u)};
+            if(!res.out_of_bound || res.count != len) { fail(u8"out of bound multi-byte", len, res.count); }
+        }
+    }
+
+    inline void test_end_of_input() noexcept
+    {
+        // Two-byte (and longer) values as the last bytes of the input.
+        for(::std::size_t len{}; len != 40uz; ++len)
+        {
+            for(::std::uint_least32_t const last: {128u, 16383u, 16384u, 0xFFFFFFFFu})
+            {
+                byte_vector bytes{};
+                for(::std::size_t i{}; i != len; ++i) { append_uleb128(bytes, 3u); }
+                append_uleb128(bytes, last);
+
+                auto const res{check_decode(bytes, len + 1uz, ::std::numeric_limits<::std::uint_least32_t>::max())};
+                if(res.code != ::fast_io::parse_code::ok && last != 0xFFFFFFFFu) { fail(u8"value at end", len, last); }
+
+                // Cut the last value short.
+                bytes.pop_back();
+                auto const truncated{check_decode(bytes, len + 1uz, ::std::numeric_limits<::std::uint_least32_t>::max())};
+                if(truncated.code == ::fast_io::parse_code::ok || truncated.out_of_bound || truncated.count != len) { fail(u8"truncated", len, last); }
+            }
+
+            // Fewer bytes than values.
+            byte_vector bytes{};
+            for(::std::size_t i{}; i != len; ++i) { append_uleb128(bytes, 3u); }
+            auto const res{check_decode(bytes, len + 5uz, 100u)};
+            if(res.code == ::fast_io::parse_code::ok || res.count != len) { fail(u8"short input", len, res.count); }
+        }
+    }
+
+    inline void test_over_long() noexcept
+    {
+        // Encodings of more than five bytes, or whose fifth byte sets bits past 32, do not fit a u32.
+        byte_vector const over_long[]{
+            byte_vector{::std::byte{0x80}, ::std::byte{0x80}, ::std::byte{0x80}, ::std::byte{0x80}, ::std::byte{0x80}, ::std::byte{0x00}},
+            byte_vector{::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0x1F}},
+            byte_vector{::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0xFF}, ::std::byte{0x01}}
+        };
+
+        for(auto const& tail: over_long)
+        {
+            for(::std::size_t len{}; len != 40uz; ++len)
+            {
+                byte_vector bytes{};
+                for(::std::size_t i{}; i != len; ++i) { append_uleb128(bytes, 9u); }
+                for(auto const b: tail) { bytes.push_back(b); }
+                append_uleb128(bytes, 1u);
+
+                auto const res{check_decode(bytes, len + 2uz, ::std::numeric_limits<::std::uint_least32_t>::max())};
+                if(res.code == ::fast_io::parse_code::ok || res.out_of_bound || res.count != len) { fail(u8"over-long", len, res.count); }
+            }
+        }
+
+        // Redundant zero continuation bytes within five bytes are valid.
+        byte_vector const padded{::std::byte{0x85}, ::std::byte{0x80}, ::std::byte{0x80}, ::std::byte{0x00}, ::std::byte{0x06}};
+        if(auto const res{check_decode(padded, 2uz, 100u)}; res.code != ::fast_io::parse_code::ok) { fail(u8"padded", res.count, 0uz); }
+    }
+
+    inline void test_random() noexcept
+    {
+        ::std::mt19937 eng{20261018u};
+
+        for(unsigned round{}; round != 20000u; ++round)
+        {
+            auto const count{static_cast<::std::size_t>(eng() % 200u)};
+            auto const multi_byte_per_mille{eng() % 1001u};
+            auto const bound{eng() % 4u == 0u ? static_cast<::std::uint_least32_t>(eng() % 20000u + 1u) : 0xFFFFFFFFu};
+
+            byte_vector bytes{};
+            for(::std::size_t i{}; i != count; ++i)
+            {
+                auto const value{eng() % 1000u < multi_byte_per_mille ? (eng() % 3u == 0u ? eng() : eng() % 16384u) : eng() % 128u};
+                append_uleb128(bytes, value);
+            }
+
+            // Occasionally corrupt the input: drop the tail or set a continuation bit.
+            if(!bytes.empty() && eng() % 8u == 0u)
+            {
+                auto const pos{static_cast<::std::size_t>(eng() % bytes.size())};
+                if(eng() % 2u == 0u)
+                {
+                    while(bytes.size() != pos) { bytes.pop_back(); }
+                }
+                else
+                {
+                    bytes.index_unchecked(pos) |= ::std::byte{0x80};
+                }
+            }
+
+            check_decode(bytes, count, bound);
+        }
+    }
+}  // namespace
+
+int main()
+{
+    test_single_byte_run();
+    test_run_boundaries();
+    test_out_of_bound_in_run();
+    test_end_of_input();
+    test_over_long();
+    test_random();
+}
@@ -48,9 +48,25 @@ namespace
     using ::uwvm2::object::memory::signal::clear_protected_segments;
     using ::uwvm2::object::memory::signal::register_protected_segment;
 
+    enum class child_mode : unsigned
+    {
+        // No protected fault handler: the fault terminates the process.
+        guard_fault,
+        // A protected fault handler exits cleanly: a fault past the memory length reaches it.
+        guard_fault_handled,
+        // Same handler, but the memory length covers the faulting page (as for a file mapping whose file was truncated): the fault must not be
+        // reported as a guard trap and terminates the process.
+        in_bounds_fault
+    };
+
+    [[noreturn]] inline void exit_from_fault_handler(::uwvm2::object::memory::signal::protected_memory_segment_t const&, ::std::byte const*) noexcept
+    {
+        ::std::_Exit(0);
+    }
+
     // Child path: install signal handler, register a protected mmap segment,
     // then intentionally perform an out-of-bounds access to trigger the handler.
-    [[noreturn]] inline void run_child() noexcept
+    [[noreturn]] inline void run_child([[maybe_unused]] child_mode mode) noexcept
     {
 #if !defined(UWVM_SUPPORT_MMAP)
         // mmap backend not available on this platform; nothing to test.
@@ -81,8 +97,16 @@ namespace
         auto* const seg_begin{memory.memory_begin};
         auto* const seg_end{memory.memory_begin + segment_end_offset};
 
+        // Reported length of the in-bounds case, the faulting page is not committed but lies below it.
+        ::std::atomic_size_t const in_bounds_length{segment_end_offset};
+
+        if(mode != child_mode::guard_fault) { ::uwvm2::object::memory::signal::protected_fault_handler = exit_from_fault_handler; }
+
         clear_protected_segments();
-        register_protected_segment(seg_begin, seg_end, memory.memory_length_p, 0uz);
+        register_protected_segment(seg_begin,
+                                   seg_end,
+                                   mode == child_mode::in_bounds_fault ? ::std::addressof(in_bounds_length) : memory.memory_length_p,
+                                   0uz);
 
         // Perform a volatile write to the non-committed page to trigger a fault.
         auto* const fault_ptr{memory.memory_begin + fault_offset};
@@ -96,8 +120,9 @@ namespace
 #endif
     }
 
-    // Parent path: spawn a child process that runs run_child() and verify that it
-    // terminates abnormally (non-zero wait status).
+    // Parent path: spawn a child process per mode that runs run_child() and verify
+    // that it terminates abnormally (non-zero wait status), or exits cleanly from the
+    // protected fault handler.
     inline int run_parent(char const* self_path) noexcept
     {
 #if !defined(UWVM_SUPPORT_MMAP)
@@ -111,18 +136,33 @@ namespace
             ::fast_io::fast_terminate();
         }
 
-        ::fast_io::native_process child(::fast_io::mnp::os_c_str(self_path), {"child"});
-        auto const status{::fast_io::wait(child)};
-        auto const status_int{::fast_io::wait_status_to_int(status)};
+        auto const run{[self_path](char const* mode) noexcept -> int
+                       {
+                           ::fast_io::native_process child(::fast_io::mnp::os_c_str(self_path), {"child", mode});
+                           auto const status{::fast_io::wait(child)};
+                           return ::fast_io::wait_status_to_int(status);
+                       }};
 
         // A zero status means the child exited cleanly, which would imply that
         // the signal handler was not invoked as expected.
-        if(status_int == 0)
+        if(run("guard_fault") == 0)
         {
             ::fast_io::io::perr(::fast_io::u8err(), u8"signal test: child process exited with status 0 (expected abnormal termination)\n");
             ::fast_io::fast_terminate();
         }
 
+        if(run("guard_fault_handled") != 0)
+        {
+            ::fast_io::io::perr(::fast_io::u8err(), u8"signal test: guard fault did not reach the protected fault handler\n");
+            ::fast_io::fast_terminate();
+        }
+
+        if(run("in_bounds_fault") == 0)
+        {
+            ::fast_io::io::perr(::fast_io::u8err(), u8"signal test: fault below the memory length was reported as a guard trap\n");
+            ::fast_io::fast_terminate();
+        }
+
         return 0;
 #endif
     }
@@ -134,7 +174,12 @@ int main(int argc, char** argv)
     // Child branch: run the fault-inducing code in a separate process so that
     // the test harness sees a normal exit from the parent when the signal
     // handler and fast_terminate behave as expected.
-    if(argc > 1 && argv != nullptr && argv[1] != nullptr && std::strcmp(argv[1], "child") == 0) { run_child(); }
+    if(argc > 2 && argv != nullptr && argv[1] != nullptr && argv[2] != nullptr && std::strcmp(argv[1], "child") == 0)
+    {
+        if(std::strcmp(argv[2], "guard_fault_handled") == 0) { run_child(child_mode::guard_fault_handled); }
+        if(std::strcmp(argv[2], "in_bounds_fault") == 0) { run_child(child_mode::in_bounds_fault); }
+        run_child(child_mode::guard_fault);
+    }
 
     char const* self_path{(argv != nullptr && argc > 0) ? argv[0] : nullptr};
     return run_parent(self_path);
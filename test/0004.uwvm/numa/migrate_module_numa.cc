@@ -0,0 +1,116 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/numa/impl.h>
+# include <uwvm2/uwvm/runtime/storage/impl.h>
+# include <uwvm2/uwvm/runtime/numa/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+// Migrates a module with a memory, a table and globals to the node of the calling thread and to a node that cannot exist. Without NUMA support
+// both report failure. With it, the first may still be refused (containers commonly deny `mbind`), but neither may disturb the contents.
+
+namespace
+{
+    using ::uwvm2::uwvm::runtime::storage::wasm_module_storage_t;
+
+    inline constexpr ::std::size_t table_size{4096uz};
+    inline constexpr ::std::size_t global_count{512uz};
+
+    [[noreturn]] inline void fail(::uwvm2::utils::container::u8string_view msg) noexcept
+    {
+        ::fast_io::io::perr(::fast_io::u8err(), u8"numa migrate test error: ", msg, u8"\n");
+        ::fast_io::fast_terminate();
+    }
+
+    inline void fill_module(wasm_module_storage_t& module) noexcept
+    {
+        auto& memory{module.local_defined_memory_vec_storage.emplace_back()};
+        memory.memory.init_by_page_count(2u);
+        if(memory.memory.memory_begin == nullptr) { fail(u8"memory init"); }
+        for(::std::size_t i{}; i != 2uz * 65536uz; i += 4096uz) { memory.memory.memory_begin[i] = static_cast<::std::byte>(i >> 12u); }
+
+        auto& table{module.local_defined_table_vec_storage.emplace_back()};
+        table.elems.resize(table_size);
+        for(::std::size_t i{}; i != table_size; ++i)
+        {
+            table.elems[i].type = ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_defined;
+        }
+
+        module.local_defined_global_vec_storage.resize(global_count);
+    }
+
+    inline void check_module(wasm_module_storage_t const& module) noexcept
+    {
+        auto const& memory{module.local_defined_memory_vec_storage.front_unchecked()};
+        for(::std::size_t i{}; i != 2uz * 65536uz; i += 4096uz)
+        {
+            if(memory.memory.memory_begin[i] != static_cast<::std::byte>(i >> 12u)) { fail(u8"memory contents changed"); }
+        }
+
+        auto const& table{module.local_defined_table_vec_storage.front_unchecked()};
+        if(table.elems.size() != table_size) { fail(u8"table size changed"); }
+        for(auto const& elem: table.elems)
+        {
+            if(elem.type != ::uwvm2::uwvm::runtime::storage::local_defined_table_elem_storage_type_t::func_ref_defined) { fail(u8"table contents changed"); }
+        }
+
+        if(module.local_defined_global_vec_storage.size() != global_count) { fail(u8"global count changed"); }
+    }
+}  // namespace
+
+int main()
+{
+    wasm_module_storage_t module{};
+    fill_module(module);
+
+    auto const [current_node, current_node_success]{::uwvm2::utils::numa::get_current_numa_node()};
+
+    if constexpr(!::uwvm2::utils::numa::support_numa)
+    {
+        if(::uwvm2::uwvm::runtime::numa::migrate_module_to_numa_node(module, 0u)) { fail(u8"migrated without NUMA support"); }
+        if(::uwvm2::uwvm::runtime::numa::migrate_all_modules_to_numa_node(0u)) { fail(u8"migrated all modules without NUMA support"); }
+    }
+    else
+    {
+        if(!current_node_success) { fail(u8"getcpu"); }
+
+        // Success depends on the host, the result only has to be clean.
+        auto const migrated{::uwvm2::uwvm::runtime::numa::migrate_module_to_numa_node(module, current_node)};
+        ::fast_io::io::perr(::fast_io::u8err(), u8"numa migrate test: node ", current_node, u8", migrated: ", migrated ? ::uwvm2::utils::container::u8string_view{u8"yes"} : ::uwvm2::utils::container::u8string_view{u8"no"}, u8"\n");
+
+        // Beyond the node mask every migration has to be refused.
+        if(::uwvm2::uwvm::runtime::numa::migrate_module_to_numa_node(module, 1u << 20u)) { fail(u8"migrated to an impossible node"); }
+    }
+
+    check_module(module);
+}
@@ -0,0 +1,193 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      MacroModel
+ * @version     2.0.0
+ * @date        2026-10-18
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <version>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/object/memory/linear/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+// Races grows of allocator memories against single, nested and re-entered memory operation guards. Nested guards take the memories in
+// descending index order on every thread; the deepest kind is inside all six memories, more than one chunk of held slots, and re-enters two of
+// them. A deadlock of the epoch protocol shows up as the watchdog below firing.
+
+namespace
+{
+    using ::uwvm2::object::memory::linear::allocator_memory_t;
+    using ::uwvm2::object::memory::linear::memory_operation_guard_t;
+
+    inline constexpr ::std::uint_least32_t magic{0xA5A5'5A5Au};
+    inline constexpr ::std::size_t memory_count{6uz};
+
+    inline bool check_magic(allocator_memory_t const& mem) noexcept
+    {
+        ::std::uint_least32_t v;  // No initialization necessary
+        ::std::memcpy(::std::addressof(v), mem.memory_begin, sizeof(v));
+        return v == magic;
+    }
+}  // namespace
+
+int main()
+{
+#if __cpp_lib_atomic_wait >= 201907L
+    allocator_memory_t mems[memory_count]{};
+    for(auto& mem: mems)
+    {
+        mem.init_by_page_count(1u);
+        if(mem.memory_begin == nullptr) { ::fast_io::fast_terminate(); }
+        ::std::memcpy(mem.memory_begin, ::std::addressof(magic), sizeof(magic));
+    }
+
+    constexpr unsigned grows_per_thread{32u};
+    constexpr unsigned rounds{200000u};
+    constexpr unsigned threads_per_kind{2u};
+
+    ::std::atomic<unsigned> mismatch_count{0u};
+    ::std::atomic<unsigned> finished_count{0u};
+
+    ::std::vector<::fast_io::native_thread> threads;
+
+    for(auto& mem: mems)
+    {
+        threads.emplace_back(
+            [&mem, &finished_count]()
+            {
+                for(unsigned i{}; i != grows_per_thread; ++i) { mem.grow_silently(1u); }
+                finished_count.fetch_add(1u, ::std::memory_order_release);
+            });
+    }
+
+    // 0: memory 0 only, 1: memory 1 only, 2: 1 then 0, 3: 1 then 0 then 1 again, 4: 5 down to 0, then 5 and 1 again
+    for(unsigned kind{}; kind != 5u; ++kind)
+    {
+        for(unsigned t{}; t != threads_per_kind; ++t)
+        {
+            threads.emplace_back(
+                [kind, &mems, &mismatch_count, &finished_count]()
+                {
+                    auto& mem_a{mems[0]};
+                    auto& mem_b{mems[1]};
+
+                    for(unsigned round{}; round != rounds; ++round)
+                    {
+                        bool ok{};
+
+                        switch(kind)
+                        {
+                            case 0u:
+                            {
+                                memory_operation_guard_t guard_a{mem_a.growing_flag_p};
+                                ok = check_magic(mem_a);
+                                break;
+                            }
+                            case 1u:
+                            {
+                                memory_operation_guard_t guard_b{mem_b.growing_flag_p};
+                                ok = check_magic(mem_b);
+                                break;
+                            }
+                            case 2u:
+                            {
+                                memory_operation_guard_t guard_b{mem_b.growing_flag_p};
+                                memory_operation_guard_t guard_a{mem_a.growing_flag_p};
+                                ok = check_magic(mem_a) && check_magic(mem_b);
+                                break;
+                            }
+                            case 3u:
+                            {
+                                memory_operation_guard_t guard_b{mem_b.growing_flag_p};
+                                memory_operation_guard_t guard_a{mem_a.growing_flag_p};
+                                memory_operation_guard_t guard_b_again{mem_b.growing_flag_p};
+                                ok = check_magic(mem_a) && check_magic(mem_b);
+                                break;
+                            }
+                            default:
+                            {
+                                memory_operation_guard_t guard_5{mems[5].growing_flag_p};
+                                memory_operation_guard_t guard_4{mems[4].growing_flag_p};
+                                memory_operation_guard_t guard_3{mems[3].growing_flag_p};
+                                memory_operation_guard_t guard_2{mems[2].growing_flag_p};
+                                memory_operation_guard_t guard_1{mems[1].growing_flag_p};
+                                memory_operation_guard_t guard_0{mems[0].growing_flag_p};
+                                memory_operation_guard_t guard_5_again{mems[5].growing_flag_p};
+                                memory_operation_guard_t guard_1_again{mems[1].growing_flag_p};
+                                ok = true;
+                                for(auto const& mem: mems) { ok = ok && check_magic(mem); }
+                                break;
+                            }
+                        }
+
+                        if(!ok) [[unlikely]]
+                        {
+                            mismatch_count.fetch_add(1u, ::std::memory_order_relaxed);
+                            break;
+                        }
+                    }
+
+                    finished_count.fetch_add(1u, ::std::memory_order_release);
+                });
+        }
+    }
+
+    // Watchdog: a deadlocked grow never lets its threads finish.
+    auto const deadline{::std::chrono::steady_clock::now() + ::std::chrono::seconds(60)};
+    while(finished_count.load(::std::memory_order_acquire) != threads.size())
+    {
+        if(::std::chrono::steady_clock::now() > deadline)
+        {
+            ::fast_io::io::perr(::fast_io::u8err(), u8"allocator memory nested guard test deadlocked\n");
+            ::fast_io::fast_terminate();
+        }
+
+        ::std::this_thread::sleep_for(::std::chrono::milliseconds(10));
+    }
+
+    for(auto& t: threads) { t.join(); }
+
+    if(mismatch_count.load(::std::memory_order_relaxed) != 0u)
+    {
+        ::fast_io::io::perr(::fast_io::u8err(), u8"allocator memory nested guard test error\n");
+        ::fast_io::fast_terminate();
+    }
+
+    for(auto const& mem: mems)
+    {
+        if(mem.memory_length != (1u + grows_per_thread) << 16u)
+        {
+            ::fast_io::io::perr(::fast_io::u8err(), u8"allocator memory nested guard test: unexpected memory length\n");
+            ::fast_io::fast_terminate();
+        }
+    }
+#endif
+}
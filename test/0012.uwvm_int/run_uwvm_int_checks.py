@@ -0,0 +1,384 @@
+#!/usr/bin/env python3
+from __future__ import annotations
+
+import argparse
+import shutil
+import subprocess
+import sys
+import tempfile
+from dataclasses import dataclass, field
+from pathlib import Path
+from typing import Optional
+
+
+@dataclass(frozen=True)
+class Preload:
+    wasm: str
+    module_name: str
+
+
+@dataclass(frozen=True)
+class Case:
+    name: str
+    wasm: str
+    expect_success: bool
+    preloads: list[Preload] = field(default_factory=list)
+    options: list[str] = field(default_factory=list)
+    expect_stdout: Optional[str] = None
+    expect_stderr: Optional[str] = None
+    # Pipe the module through stdin ("--run -") instead of passing its path.
+    stream: bool = False
+
+
+def _repo_root() -> Path:
+    return Path(__file__).resolve().parents[2]
+
+
+def _case_root() -> Path:
+    return Path(__file__).resolve().parent
+
+
+def _compile_wat(case_root: Path) -> None:
+    script = case_root / "compile_wat.py"
+    subprocess.run([sys.executable, str(script)], cwd=case_root, check=True)
+
+
+def _run_uwvm(repo_root: Path, case: Case) -> subprocess.CompletedProcess[str]:
+    args = ["xmake", "run", "uwvm"]
+    for p in case.preloads:
+        args += ["--wasm-preload-library", str(Path(p.wasm).resolve()), p.module_name]
+    args += case.options
+    if case.stream:
+        args += ["--run", "-"]
+        proc = subprocess.run(args, cwd=repo_root, input=Path(case.wasm).read_bytes(), stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+        return subprocess.CompletedProcess(args, proc.returncode, proc.stdout.decode(errors="replace"), proc.stderr.decode(errors="replace"))
+    args += ["--run", str(Path(case.wasm).resolve())]
+    return subprocess.run(args, cwd=repo_root, text=True, stdout=subprocess.PIPE, stderr=subprocess.PIPE)
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Run uwvm-int interpreter cases via xmake.")
+    parser.add_argument("--case", default="all", help='Case name, or "all" (default)')
+    args = parser.parse_args()
+
+    repo_root = _repo_root()
+    case_root = _case_root()
+    wat_dir = case_root / "wat"
+
+    _compile_wat(case_root)
+
+    def wasm(name: str) -> str:
+        return str(wat_dir / f"{name}.wasm")
+
+    # Shared by the cold and the warm run of the code cache cases, which must stay in this order.
+    code_cache = tempfile.mkdtemp(prefix="uwvm_code_cache_")
+    # Same for the snapshot cases: the cold run writes the snapshot, the warm run restores it instead of running the start function.
+    snapshot_dir = tempfile.mkdtemp(prefix="uwvm_snapshot_")
+    snapshot = str(Path(snapshot_dir) / "snapshot.bin")
+
+    cases = [
+        Case(name="ok.control_flow", wasm=wasm("control_flow"), expect_success=True),
+        Case(name="ok.numeric", wasm=wasm("numeric"), expect_success=True),
+        Case(name="ok.memory_global_table", wasm=wasm("memory_global_table"), expect_success=True),
+        Case(name="ok.register_ir", wasm=wasm("register_ir"), expect_success=True),
+        Case(name="ok.superinst", wasm=wasm("superinst"), expect_success=True),
+        Case(name="ok.tos_cache", wasm=wasm("tos_cache"), expect_success=True),
+        Case(name="ok.lazy_compile", wasm=wasm("control_flow"), expect_success=True, options=["--runtime-compile-mode", "lazy"]),
+        Case(name="ok.full_compile", wasm=wasm("control_flow"), expect_success=True, options=["--runtime-compile-mode", "full"]),
+        Case(name="ok.full_compile.superinst", wasm=wasm("superinst"), expect_success=True, options=["--runtime-compile-mode", "full"]),
+        Case(
+            name="ok.full_compile.cross_module",
+            wasm=wasm("consumer"),
+            expect_success=True,
+            options=["--runtime-compile-mode", "full"],
+            preloads=[Preload(wasm=wasm("provider"), module_name="provider")],
+        ),
+        Case(
+            name="ok.lazy_compile.cross_module",
+            wasm=wasm("consumer"),
+            expect_success=True,
+            options=["--runtime-compile-mode", "lazy"],
+            preloads=[Preload(wasm=wasm("provider"), module_name="provider")],
+        ),
+        Case(
+            name="trap.lazy_compile.indirect_type",
+            wasm=wasm("trap_indirect_type"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "lazy"],
+            expect_stderr="indirect call type mismatch",
+        ),
+        Case(
+            name="ok.superinst_census",
+            wasm=wasm("superinst"),
+            expect_success=True,
+            options=["--runtime-int-superinst-census"],
+            expect_stderr="superinstruction static census",
+        ),
+        Case(
+            name="ok.cross_module",
+            wasm=wasm("consumer"),
+            expect_success=True,
+            preloads=[Preload(wasm=wasm("provider"), module_name="provider")],
+        ),
+        Case(
+            name="ok.cross_module.many_preloads",
+            wasm=wasm("consumer"),
+            expect_success=True,
+            preloads=[
+                Preload(wasm=wasm("control_flow"), module_name="control_flow"),
+                Preload(wasm=wasm("provider"), module_name="provider"),
+                Preload(wasm=wasm("numeric"), module_name="numeric"),
+                Preload(wasm=wasm("tos_cache"), module_name="tos_cache"),
+            ],
+        ),
+        Case(
+            name="reject.verification.invalid_body",
+            wasm=wasm("invalid_body"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "lazy-verify"],
+            expect_stderr="Invalid Function Body",
+        ),
+        Case(
+            name="reject.verification.invalid_body_proc_exit",
+            wasm=wasm("invalid_body_proc_exit"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "lazy-verify"],
+            expect_stderr="Invalid Function Body",
+        ),
+        Case(
+            name="reject.verification.invalid_body_trap",
+            wasm=wasm("invalid_body_trap"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "lazy-verify"],
+            expect_stderr="Invalid Function Body",
+        ),
+        Case(
+            name="reject.full_compile.invalid_body",
+            wasm=wasm("invalid_body"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="operand stack underflow",
+        ),
+        Case(
+            name="reject.full_compile.invalid_type",
+            wasm=wasm("invalid_type"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="type mismatch",
+        ),
+        Case(
+            name="reject.full_compile.br_table_types",
+            wasm=wasm("invalid_br_table_types"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="br_table labels have inconsistent types",
+        ),
+        Case(
+            name="reject.full_compile.if_else_result",
+            wasm=wasm("invalid_if_else_result"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="type mismatch",
+        ),
+        Case(
+            name="reject.full_compile.polymorphic_unreachable",
+            wasm=wasm("invalid_polymorphic_unreachable"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="type mismatch",
+        ),
+        Case(
+            name="reject.full_compile.polymorphic_br",
+            wasm=wasm("invalid_polymorphic_br"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="type mismatch",
+        ),
+        Case(
+            name="reject.full_compile.align",
+            wasm=wasm("invalid_align"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="alignment must not be larger than natural",
+        ),
+        Case(
+            name="reject.full_compile.immutable_global",
+            wasm=wasm("invalid_immutable_global"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="global.set on an immutable global",
+        ),
+        Case(
+            name="reject.full_compile.local_index",
+            wasm=wasm("invalid_local_index"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="invalid local index",
+        ),
+        Case(
+            name="reject.full_compile.label_index",
+            wasm=wasm("invalid_label_index"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="invalid label index",
+        ),
+        Case(
+            name="reject.full_compile.no_memory",
+            wasm=wasm("invalid_no_memory"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="memory instruction in a module without memory",
+        ),
+        Case(
+            name="reject.full_compile.lowest_invalid_body",
+            wasm=wasm("invalid_multiple"),
+            expect_success=False,
+            options=["--runtime-compile-mode", "full"],
+            expect_stderr="type mismatch",
+        ),
+        Case(name="ok.tiered", wasm=wasm("control_flow"), expect_success=True, options=["--runtime-compiler", "int-jit-tiered"]),
+        Case(name="ok.jit", wasm=wasm("control_flow"), expect_success=True, options=["--runtime-compiler", "jit"]),
+        Case(
+            name="trap.div_zero.jit",
+            wasm=wasm("trap_div_zero"),
+            expect_success=False,
+            options=["--runtime-compiler", "jit"],
+            expect_stderr="integer divide by zero",
+        ),
+        Case(
+            name="ok.jit.code_cache.cold",
+            wasm=wasm("control_flow"),
+            expect_success=True,
+            options=["--runtime-compiler", "jit", "--runtime-code-cache", code_cache],
+        ),
+        Case(
+            name="ok.jit.code_cache.warm",
+            wasm=wasm("control_flow"),
+            expect_success=True,
+            options=["--runtime-compiler", "jit", "--runtime-code-cache", code_cache],
+        ),
+        Case(name="ok.snapshot.cold", wasm=wasm("snapshot"), expect_success=True, options=["--runtime-snapshot", snapshot]),
+        Case(
+            name="ok.snapshot.warm",
+            wasm=wasm("snapshot"),
+            expect_success=True,
+            options=["--log-verbose", "--runtime-snapshot", snapshot],
+            expect_stderr="Restored the instance",
+        ),
+        Case(
+            name="ok.huge_pages",
+            wasm=wasm("memory_global_table"),
+            expect_success=True,
+            options=["--wasm-memory-huge-pages", "transparent"],
+        ),
+        Case(
+            name="ok.numa_local",
+            wasm=wasm("memory_global_table"),
+            expect_success=True,
+            options=["--wasm-memory-numa-local"],
+        ),
+        Case(
+            name="ok.reservation_pool.disabled",
+            wasm=wasm("memory_global_table"),
+            expect_success=True,
+            options=["--wasm-memory-reservation-pool", "0"],
+        ),
+        Case(
+            name="reject.reservation_pool.invalid",
+            wasm=wasm("memory_global_table"),
+            expect_success=False,
+            options=["--wasm-memory-reservation-pool", "many"],
+            expect_stderr="Invalid reservation pool size",
+        ),
+        Case(name="ok.wasi_start", wasm=wasm("wasi_hello"), expect_success=True, expect_stdout="hello from uwvm-int\n"),
+        Case(name="ok.stream_stdin", wasm=wasm("wasi_hello"), expect_success=True, expect_stdout="hello from uwvm-int\n", stream=True),
+        Case(name="trap.div_zero", wasm=wasm("trap_div_zero"), expect_success=False, expect_stderr="integer divide by zero"),
+        Case(name="trap.int_overflow", wasm=wasm("trap_int_overflow"), expect_success=False, expect_stderr="integer overflow"),
+        Case(
+            name="trap.invalid_conversion",
+            wasm=wasm("trap_invalid_conversion"),
+            expect_success=False,
+            expect_stderr="invalid conversion to integer",
+        ),
+        Case(
+            name="trap.out_of_bounds",
+            wasm=wasm("trap_out_of_bounds"),
+            expect_success=False,
+            expect_stderr="out of bounds memory access",
+        ),
+        Case(
+            name="trap.out_of_bounds.guard",
+            wasm=wasm("trap_out_of_bounds_guard"),
+            expect_success=False,
+            expect_stderr="out of bounds memory access",
+        ),
+        Case(
+            name="trap.out_of_bounds.huge_pages",
+            wasm=wasm("trap_out_of_bounds_guard"),
+            expect_success=False,
+            options=["--wasm-memory-huge-pages", "hugetlb"],
+            expect_stderr="out of bounds memory access",
+        ),
+        Case(
+            name="trap.out_of_bounds.commit_ahead",
+            wasm=wasm("trap_out_of_bounds_commit_ahead"),
+            expect_success=False,
+            options=["--wasm-memory-grow-commit-ahead"],
+            expect_stderr="out of bounds memory access",
+        ),
+        Case(
+            name="trap.indirect_type",
+            wasm=wasm("trap_indirect_type"),
+            expect_success=False,
+            expect_stderr="indirect call type mismatch",
+        ),
+        Case(name="trap.null_element", wasm=wasm("trap_null_element"), expect_success=False, expect_stderr="uninitialized element"),
+        Case(name="trap.stack_overflow", wasm=wasm("trap_stack_overflow"), expect_success=False, expect_stderr="call stack exhausted"),
+    ]
+
+    selected = cases if args.case == "all" else [c for c in cases if c.name == args.case]
+    if not selected:
+        sys.stderr.write(f"Unknown --case: {args.case}\n")
+        sys.stderr.write("Available:\n")
+        for c in cases:
+            sys.stderr.write(f"  - {c.name}\n")
+        shutil.rmtree(code_cache, ignore_errors=True)
+        shutil.rmtree(snapshot_dir, ignore_errors=True)
+        return 2
+
+    failed = 0
+    for c in selected:
+        proc = _run_uwvm(repo_root=repo_root, case=c)
+
+        ok = (proc.returncode == 0)
+        reason = None
+        if ok != c.expect_success:
+            reason = f"returncode={proc.returncode} expected_success={c.expect_success}"
+        elif c.expect_stdout is not None and c.expect_stdout not in proc.stdout:
+            reason = f"stdout does not contain {c.expect_stdout!r}"
+        elif c.expect_stderr is not None and c.expect_stderr not in proc.stderr:
+            reason = f"stderr does not contain {c.expect_stderr!r}"
+
+        if reason is not None:
+            failed += 1
+            sys.stderr.write(f"[FAIL] {c.name}: {reason}\n")
+            if proc.stdout:
+                sys.stderr.write("---- stdout ----\n")
+                sys.stderr.write(proc.stdout)
+                if not proc.stdout.endswith("\n"):
+                    sys.stderr.write("\n")
+            if proc.stderr:
+                sys.stderr.write("---- stderr ----\n")
+                sys.stderr.write(proc.stderr)
+                if not proc.stderr.endswith("\n"):
+                    sys.stderr.write("\n")
+        else:
+            sys.stdout.write(f"[OK] {c.name}\n")
+
+    shutil.rmtree(code_cache, ignore_errors=True)
+    shutil.rmtree(snapshot_dir, ignore_errors=True)
+    return 1 if failed else 0
+
+
+if __name__ == "__main__":
+    raise SystemExit(main())
@@ -0,0 +1,187 @@
+﻿/*************************************************************
+ * Ultimate WebAssembly Virtual Machine (Version 2)          *
+ * Copyright (c) 2025-present UlteSoft. All rights reserved. *
+ * Licensed under the APL-2.0 License (see LICENSE file).    *
+ *************************************************************/
+
+/**
+ * @author      GPT
+ * @version     2.0.0
+ * @copyright   APL-2.0 License
+ */
+
+/****************************************
+ *  _   _ __        ____     __ __  __  *
+ * | | | |\ \      / /\ \   / /|  \/  | *
+ * | | | | \ \ /\ / /  \ \ / / | |\/| | *
+ * | |_| |  \ V  V /    \ V /  | |  | | *
+ *  \___/    \_/\_/      \_/   |_|  |_| *
+ *                                      *
+ ****************************************/
+
+// std
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+
+#ifndef UWVM_MODULE
+// import
+# include <fast_io.h>
+# include <uwvm2/utils/container/impl.h>
+# include <uwvm2/uwvm/cmdline/callback/impl.h>
+# include <uwvm2/uwvm/wasm/loader/impl.h>
+# include <uwvm2/uwvm/wasm/storage/impl.h>
+# include <uwvm2/uwvm/runtime/runtime_mode/impl.h>
+# include <uwvm2/uwvm/runtime/initializer/impl.h>
+# include <uwvm2/compiler/uwvm_int/impl.h>
+#else
+# error "Module testing is not currently supported"
+#endif
+
+// Traps raised by the interpreter (`unreachable`, integer division by zero) and by a fault in the guard region of a memory must unwind to
+// `try_call_function`, which reports them and leaves the call depth as it was. The module stays callable afterwards.
+
+namespace
+{
+    using ::uwvm2::compiler::uwvm_int::trap_kind;
+    using ::uwvm2::compiler::uwvm_int::wasm_value_slot_t;
+
+    // (type 0 (func))
+    // (type 1 (func (param i32) (result i32)))
+    // (type 2 (func (param i32 i32) (result i32)))
+    // (memory 1)
+    // (func 0 (type 0) unreachable)
+    // (func 1 (type 1) (i32.div_u (i32.const 1) (local.get 0)))
+    // (func 2 (type 0) (i32.store (i32.const 65536) (i32.const 0)))
+    // (func 3 (type 2) (i32.add (local.get 0) (local.get 1)))
+    inline constexpr ::std::uint_least8_t trap_module[]{
+        0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,                                                              // header
+        0x01, 0x0f, 0x03, 0x60, 0x00, 0x00, 0x60, 0x01, 0x7f, 0x01, 0x7f, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,        // type
+        0x03, 0x05, 0x04, 0x00, 0x01, 0x00, 0x02,                                                                    // function
+        0x05, 0x03, 0x01, 0x00, 0x01,                                                                                // memory
+        0x0a, 0x21, 0x04,                                                                                            // code
+        0x03, 0x00, 0x00, 0x0b,                                                                                      // func 0
+        0x07, 0x00, 0x41, 0x01, 0x20, 0x00, 0x6e, 0x0b,                                                              // func 1
+        0x0b, 0x00, 0x41, 0x80, 0x80, 0x04, 0x41, 0x00, 0x36, 0x02, 0x00, 0x0b,                                      // func 2
+        0x07, 0x00, 0x20, 0x00, 0x20, 0x01, 0x6a, 0x0b                                                               // func 3
+    };
+
+    inline constexpr char8_t trap_module_path[]{u8"trap_recovery_test.wasm"};
+
+    [[noreturn]] inline void fail(::uwvm2::utils::container::u8string_view msg) noexcept
+    {
+        ::std::remove(reinterpret_cast<char const*>(trap_module_path));
+        ::fast_io::io::perr(::fast_io::u8err(), u8"trap recovery test error: ", msg, u8"\n");
+        ::fast_io::fast_terminate();
+    }
+
+    inline ::uwvm2::compiler::uwvm_int::compiled_module_t const* load_trap_module() noexcept
+    {
+        {
+            ::fast_io::native_file out{trap_module_path, ::fast_io::open_mode::out};
+            ::fast_io::operations::write_all_bytes(out,
+                                                   reinterpret_cast<::std::byte const*>(trap_module),
+                                                   reinterpret_cast<::std::byte const*>(trap_module) + sizeof(trap_module));
+        }
+
+        auto& wf{::uwvm2::uwvm::wasm::storage::execute_wasm};
+        if(::uwvm2::uwvm::wasm::loader::load_wasm_file(wf,
+                                                       ::uwvm2::utils::container::u8cstring_view{trap_module_path},
+                                                       ::uwvm2::utils::container::u8string_view{},
+                                                       ::uwvm2::uwvm::wasm::storage::wasm_parameter) != ::uwvm2::uwvm::wasm::loader::load_wasm_file_rtl::ok)
+        {
+            fail(u8"load_wasm_file");
+        }
+
+        if(::uwvm2::uwvm::wasm::loader::construct_all_module_and_check_duplicate_module() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok ||
+           ::uwvm2::uwvm::wasm::loader::check_import_exist_and_detect_cycles() != ::uwvm2::uwvm::wasm::loader::load_and_check_modules_rtl::ok)
+        {
+            fail(u8"check modules");
+        }
+
+        ::uwvm2::uwvm::runtime::initializer::initialize_runtime();
+        ::uwvm2::compiler::uwvm_int::instantiate(::uwvm2::uwvm::runtime::runtime_mode::runtime_mode_t::full_compile,
+                                                 ::uwvm2::uwvm::runtime::runtime_mode::runtime_compiler_t::uwvm_interpreter_only);
+
+        for(auto const& [module_name, mod]: ::uwvm2::uwvm::wasm::storage::all_module)
+        {
+            if(mod.type == ::uwvm2::uwvm::wasm::type::module_type_t::exec_wasm) { return ::uwvm2::compiler::uwvm_int::find_compiled_module(module_name); }
+        }
+        return nullptr;
+    }
+
+    inline wasm_value_slot_t make_i32(::std::uint_least32_t value) noexcept
+    {
+        wasm_value_slot_t slot{};
+        ::uwvm2::compiler::uwvm_int::slot_store(::std::addressof(slot), value);
+        return slot;
+    }
+
+    inline void expect_trap(::uwvm2::compiler::uwvm_int::compiled_module_t const& module,
+                            ::std::size_t function_index,
+                            wasm_value_slot_t const* args,
+                            trap_kind expected,
+                            ::uwvm2::utils::container::u8string_view what) noexcept
+    {
+        auto& ctx{::uwvm2::compiler::uwvm_int::main_execution_context};
+        auto const call_depth{ctx.call_depth};
+
+        wasm_value_slot_t result{make_i32(0xdeadbeefu)};
+        auto const ret{::uwvm2::compiler::uwvm_int::try_call_function(module, function_index, args, ::std::addressof(result))};
+
+        if(!ret.trapped) { fail(what); }
+        if(ret.trap != expected) { fail(what); }
+        if(ctx.call_depth != call_depth) { fail(u8"call depth not restored"); }
+        if(::uwvm2::compiler::uwvm_int::current_trap_frame != nullptr) { fail(u8"trap frame not restored"); }
+        if(::uwvm2::compiler::uwvm_int::slot_load<::std::uint_least32_t>(::std::addressof(result)) != 0xdeadbeefu) { fail(u8"result written by a trap"); }
+    }
+
+    // The module must still run normally after each trap.
+    inline void expect_callable(::uwvm2::compiler::uwvm_int::compiled_module_t const& module) noexcept
+    {
+        wasm_value_slot_t const add_args[2]{make_i32(2u), make_i32(3u)};
+        wasm_value_slot_t result{};
+        if(::uwvm2::compiler::uwvm_int::try_call_function(module, 3uz, add_args, ::std::addressof(result)).trapped ||
+           ::uwvm2::compiler::uwvm_int::slot_load<::std::uint_least32_t>(::std::addressof(result)) != 5u)
+        {
+            fail(u8"add after trap");
+        }
+
+        wasm_value_slot_t const div_arg{make_i32(1u)};
+        if(::uwvm2::compiler::uwvm_int::try_call_function(module, 1uz, ::std::addressof(div_arg), ::std::addressof(result)).trapped ||
+           ::uwvm2::compiler::uwvm_int::slot_load<::std::uint_least32_t>(::std::addressof(result)) != 1u)
+        {
+            fail(u8"div after trap");
+        }
+    }
+}  // namespace
+
+int main()
+{
+    auto const module{load_trap_module()};
+    ::std::remove(reinterpret_cast<char const*>(trap_module_path));
+    if(module == nullptr) { fail(u8"exec module not instantiated"); }
+
+    expect_callable(*module);
+
+    for(unsigned round{}; round != 3u; ++round)
+    {
+        expect_trap(*module, 0uz, nullptr, trap_kind::unreachable, u8"unreachable");
+        expect_callable(*module);
+
+        wasm_value_slot_t const zero{make_i32(0u)};
+        expect_trap(*module, 1uz, ::std::addressof(zero), trap_kind::integer_divide_by_zero, u8"divide by zero");
+        expect_callable(*module);
+
+        // With elided bounds checks the store faults in the guard region past the memory, otherwise the interpreter's check traps.
+        expect_trap(*module, 2uz, nullptr, trap_kind::out_of_bounds_memory_access, u8"out of bounds store");
+        expect_callable(*module);
+    }
+
+    if(module->memory.elide_bounds_checks) { ::fast_io::io::perr(::fast_io::u8err(), u8"trap recovery test: out of bounds store trapped by a guard fault\n"); }
+    else
+    {
+        ::fast_io::io::perr(::fast_io::u8err(), u8"trap recovery test: out of bounds store trapped by a bounds check\n");
+    }
+}
@@ -0,0 +1,24 @@
+(module
+  (import "provider" "add" (func $add (param i32 i32) (result i32)))
+  (import "provider" "bump" (func $bump))
+  (import "provider" "memory" (memory 1))
+  (import "provider" "g" (global $g (mut i32)))
+
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  (func $start
+    (call $check (i32.eq (call $add (i32.const 40) (i32.const 2)) (i32.const 42)))
+    (call $bump)
+    (call $check (i32.eq (global.get $g) (i32.const 2)))
+    (global.set $g (i32.const 10))
+    (call $bump)
+    (call $check (i32.eq (global.get $g) (i32.const 11)))
+    (i32.store (i32.const 0) (i32.const 1234))
+    (call $check (i32.eq (i32.load (i32.const 0)) (i32.const 1234))))
+
+  (start $start))
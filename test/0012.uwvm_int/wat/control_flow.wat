@@ -0,0 +1,105 @@
+(module
+  (func $fac (param i64) (result i64)
+    local.get 0
+    i64.eqz
+    if (result i64)
+      i64.const 1
+    else
+      local.get 0
+      local.get 0
+      i64.const 1
+      i64.sub
+      call $fac
+      i64.mul
+    end)
+
+  (func $sum_to (param i32) (result i32)
+    (local i32)
+    block
+      loop
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 1
+        local.get 0
+        i32.add
+        local.set 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+
+  (func $classify (param i32) (result i32)
+    block
+      block
+        block
+          local.get 0
+          br_table 0 1 2
+        end
+        i32.const 100
+        return
+      end
+      i32.const 200
+      return
+    end
+    i32.const 300)
+
+  (func $block_result (param i32) (result i32)
+    block (result i32)
+      i32.const 7
+      local.get 0
+      br_if 0
+      drop
+      i32.const 9
+    end)
+
+  ;; dead code after br is skipped, including the blocks nested in it, and later blocks still find their end
+  (func $dead_code (param i32) (result i32)
+    block $out (result i32)
+      local.get 0
+      if (result i32)
+        i32.const 1
+        br $out
+        block
+          loop
+            br 0
+          end
+        end
+        i32.add
+      else
+        i32.const 2
+      end
+      block (result i32)
+        i32.const 3
+        br 0
+        i32.const 99
+        drop
+      end
+      i32.add
+    end)
+
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  (func $start
+    (call $check (i64.eq (call $fac (i64.const 20)) (i64.const 2432902008176640000)))
+    (call $check (i32.eq (call $sum_to (i32.const 100)) (i32.const 5050)))
+    (call $check (i32.eq (call $classify (i32.const 0)) (i32.const 100)))
+    (call $check (i32.eq (call $classify (i32.const 1)) (i32.const 200)))
+    (call $check (i32.eq (call $classify (i32.const 2)) (i32.const 300)))
+    (call $check (i32.eq (call $classify (i32.const 99)) (i32.const 300)))
+    (call $check (i32.eq (call $block_result (i32.const 1)) (i32.const 7)))
+    (call $check (i32.eq (call $block_result (i32.const 0)) (i32.const 9)))
+    (call $check (i32.eq (call $dead_code (i32.const 1)) (i32.const 1)))
+    (call $check (i32.eq (call $dead_code (i32.const 0)) (i32.const 5)))
+    (call $check (i32.eq (select (i32.const 1) (i32.const 2) (i32.const 0)) (i32.const 2))))
+
+  (start $start))
@@ -0,0 +1,11 @@
+(module
+  (memory 1)
+
+  ;; the natural alignment of i32.load is 4 bytes
+  (func $invalid (result i32)
+    i32.const 0
+    i32.load align=8)
+
+  (func $start)
+
+  (start $start))
@@ -0,0 +1,9 @@
+(module
+  ;; never called: only verification of every body can find that i32.add has a single operand
+  (func $invalid (result i32)
+    i32.const 1
+    i32.add)
+
+  (func $start)
+
+  (start $start))
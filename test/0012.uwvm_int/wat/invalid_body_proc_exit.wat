@@ -0,0 +1,11 @@
+(module
+  (import "wasi_snapshot_preview1" "proc_exit" (func $proc_exit (param i32)))
+  (memory (export "memory") 1)
+
+  ;; never called: proc_exit must still wait for the verification of every body
+  (func $invalid (result i32)
+    i32.const 1
+    i32.add)
+
+  (func (export "_start")
+    (call $proc_exit (i32.const 0))))
@@ -0,0 +1,10 @@
+(module
+  ;; never called: the trap below must not end the process before every body is verified
+  (func $invalid (result i32)
+    i32.const 1
+    i32.add)
+
+  (func $start
+    unreachable)
+
+  (start $start))
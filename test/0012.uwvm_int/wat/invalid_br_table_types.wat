@@ -0,0 +1,16 @@
+(module
+  ;; the labels of br_table must take the same types: $a takes an i32, $b an i64
+  (func $invalid (param i32) (result i32)
+    block $a (result i32)
+      block $b (result i64)
+        i32.const 1
+        local.get 0
+        br_table $a $b $a
+      end
+      drop
+      i32.const 0
+    end)
+
+  (func $start)
+
+  (start $start))
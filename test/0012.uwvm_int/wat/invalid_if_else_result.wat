@@ -0,0 +1,13 @@
+(module
+  ;; both arms of an if must produce its result type, the else arm produces an i64
+  (func $invalid (param i32) (result i32)
+    local.get 0
+    if (result i32)
+      i32.const 1
+    else
+      i64.const 1
+    end)
+
+  (func $start)
+
+  (start $start))
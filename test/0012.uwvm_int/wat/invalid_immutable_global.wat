@@ -0,0 +1,11 @@
+(module
+  (global $g i32 (i32.const 0))
+
+  ;; $g is not mutable
+  (func $invalid
+    i32.const 1
+    global.set $g)
+
+  (func $start)
+
+  (start $start))
@@ -0,0 +1,10 @@
+(module
+  ;; only the block and the function frame can be branched to
+  (func $invalid
+    block
+      br 2
+    end)
+
+  (func $start)
+
+  (start $start))
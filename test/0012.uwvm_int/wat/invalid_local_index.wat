@@ -0,0 +1,9 @@
+(module
+  ;; the function has one parameter and one local
+  (func $invalid (param i32) (result i32)
+    (local i32)
+    local.get 2)
+
+  (func $start)
+
+  (start $start))
@@ -0,0 +1,21 @@
+(module
+  ;; two invalid bodies: the larger one is validated first, but the lower function index is the one reported
+  (func $type_mismatch (result i32)
+    i32.const 1
+    i64.const 2
+    i32.add)
+
+  (func $underflow (result i32)
+    i32.const 1
+    i32.const 2
+    i32.add
+    i32.const 3
+    i32.add
+    i32.const 4
+    i32.add
+    drop
+    i32.add)
+
+  (func $start)
+
+  (start $start))
@@ -0,0 +1,9 @@
+(module
+  ;; the module has no memory
+  (func $invalid (result i32)
+    i32.const 0
+    i32.load)
+
+  (func $start)
+
+  (start $start))
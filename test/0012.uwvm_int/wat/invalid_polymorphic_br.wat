@@ -0,0 +1,14 @@
+(module
+  ;; the code after br is dead but still validated: i32.eqz gets an f32 operand
+  (func $invalid (result i32)
+    block
+      br 0
+      f32.const 0
+      i32.eqz
+      drop
+    end
+    i32.const 0)
+
+  (func $start)
+
+  (start $start))
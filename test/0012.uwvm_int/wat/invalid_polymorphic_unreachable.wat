@@ -0,0 +1,10 @@
+(module
+  ;; the operand stack is polymorphic after unreachable, but the values pushed after it keep their types
+  (func $invalid (result i32)
+    unreachable
+    i64.const 1
+    i32.add)
+
+  (func $start)
+
+  (start $start))
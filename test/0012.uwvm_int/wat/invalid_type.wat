@@ -0,0 +1,10 @@
+(module
+  ;; well-formed for the stack height, but i32.add gets an i64 operand
+  (func $invalid (result i32)
+    i32.const 1
+    i64.const 2
+    i32.add)
+
+  (func $start)
+
+  (start $start))
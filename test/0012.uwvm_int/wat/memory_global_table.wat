@@ -0,0 +1,65 @@
+(module
+  (type $i32_to_i32 (func (param i32) (result i32)))
+
+  (memory 1 2)
+  (data (i32.const 16) "\01\02\03\04\ff")
+
+  (global $counter (mut i32) (i32.const 10))
+  (global $base i64 (i64.const 40))
+
+  (table 4 funcref)
+  (elem (i32.const 0) $double $square)
+
+  (func $double (type $i32_to_i32)
+    local.get 0
+    i32.const 2
+    i32.mul)
+
+  (func $square (type $i32_to_i32)
+    local.get 0
+    local.get 0
+    i32.mul)
+
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  (func $start
+    ;; data segment and little-endian loads
+    (call $check (i32.eq (i32.load (i32.const 16)) (i32.const 0x04030201)))
+    (call $check (i32.eq (i32.load8_s (i32.const 20)) (i32.const -1)))
+    (call $check (i32.eq (i32.load8_u offset=4 (i32.const 16)) (i32.const 255)))
+    (call $check (i32.eq (i32.load16_s (i32.const 19)) (i32.const 0xffffff04)))
+
+    ;; store / load round trip
+    (i64.store offset=8 (i32.const 100) (i64.const 0x1122334455667788))
+    (call $check (i64.eq (i64.load (i32.const 108)) (i64.const 0x1122334455667788)))
+    (call $check (i64.eq (i64.load32_u (i32.const 112)) (i64.const 0x11223344)))
+    (f64.store (i32.const 200) (f64.const 1.25))
+    (call $check (f64.eq (f64.load (i32.const 200)) (f64.const 1.25)))
+
+    ;; last in-bounds byte
+    (i32.store8 (i32.const 65535) (i32.const 42))
+    (call $check (i32.eq (i32.load8_u (i32.const 65535)) (i32.const 42)))
+
+    ;; memory.size / memory.grow with a declared maximum
+    (call $check (i32.eq (memory.size) (i32.const 1)))
+    (call $check (i32.eq (memory.grow (i32.const 1)) (i32.const 1)))
+    (call $check (i32.eq (memory.size) (i32.const 2)))
+    (call $check (i32.eq (memory.grow (i32.const 1)) (i32.const -1)))
+    (i32.store (i32.const 131068) (i32.const 7))
+    (call $check (i32.eq (i32.load (i32.const 131068)) (i32.const 7)))
+
+    ;; globals
+    (global.set $counter (i32.add (global.get $counter) (i32.const 5)))
+    (call $check (i32.eq (global.get $counter) (i32.const 15)))
+    (call $check (i64.eq (global.get $base) (i64.const 40)))
+
+    ;; call_indirect
+    (call $check (i32.eq (call_indirect (type $i32_to_i32) (i32.const 21) (i32.const 0)) (i32.const 42)))
+    (call $check (i32.eq (call_indirect (type $i32_to_i32) (i32.const 9) (i32.const 1)) (i32.const 81))))
+
+  (start $start))
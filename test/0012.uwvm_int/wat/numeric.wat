@@ -0,0 +1,43 @@
+(module
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  (func $start
+    ;; integer
+    (call $check (i32.eq (i32.div_s (i32.const -7) (i32.const 2)) (i32.const -3)))
+    (call $check (i32.eq (i32.rem_s (i32.const -7) (i32.const 2)) (i32.const -1)))
+    (call $check (i32.eq (i32.div_u (i32.const -1) (i32.const 2)) (i32.const 0x7fffffff)))
+    (call $check (i32.eq (i32.rem_s (i32.const 0x80000000) (i32.const -1)) (i32.const 0)))
+    (call $check (i32.eq (i32.shl (i32.const 1) (i32.const 33)) (i32.const 2)))
+    (call $check (i32.eq (i32.shr_s (i32.const -8) (i32.const 1)) (i32.const -4)))
+    (call $check (i32.eq (i32.rotl (i32.const 0x80000001) (i32.const 1)) (i32.const 3)))
+    (call $check (i32.eq (i32.clz (i32.const 1)) (i32.const 31)))
+    (call $check (i32.eq (i32.ctz (i32.const 0)) (i32.const 32)))
+    (call $check (i32.eq (i32.popcnt (i32.const -1)) (i32.const 32)))
+    (call $check (i64.eq (i64.rotr (i64.const 1) (i64.const 1)) (i64.const 0x8000000000000000)))
+    (call $check (i64.eq (i64.extend_i32_s (i32.const -1)) (i64.const -1)))
+    (call $check (i64.eq (i64.extend_i32_u (i32.const -1)) (i64.const 0xffffffff)))
+    (call $check (i32.eq (i32.wrap_i64 (i64.const 0x100000002)) (i32.const 2)))
+    (call $check (i32.lt_u (i32.const 1) (i32.const -1)))
+    (call $check (i32.gt_s (i32.const 1) (i32.const -1)))
+
+    ;; float
+    (call $check (f64.eq (f64.add (f64.const 0.5) (f64.const 0.25)) (f64.const 0.75)))
+    (call $check (f32.eq (f32.sqrt (f32.const 16)) (f32.const 4)))
+    (call $check (f64.eq (f64.nearest (f64.const 2.5)) (f64.const 2)))
+    (call $check (f64.eq (f64.nearest (f64.const -3.5)) (f64.const -4)))
+    (call $check (f32.eq (f32.min (f32.const -0) (f32.const 0)) (f32.const -0)))
+    (call $check (f64.ne (f64.min (f64.const nan) (f64.const 1)) (f64.min (f64.const nan) (f64.const 1))))
+    (call $check (f64.eq (f64.copysign (f64.const 3) (f64.const -1)) (f64.const -3)))
+    (call $check (i32.eq (i32.trunc_f64_s (f64.const -3.9)) (i32.const -3)))
+    (call $check (i64.eq (i64.trunc_f32_u (f32.const 4294967296)) (i64.const 4294967296)))
+    (call $check (f64.eq (f64.convert_i64_u (i64.const -1)) (f64.const 18446744073709551616)))
+    (call $check (f32.eq (f32.demote_f64 (f64.const 1.5)) (f32.const 1.5)))
+    (call $check (i32.eq (i32.reinterpret_f32 (f32.const 1)) (i32.const 0x3f800000)))
+    (call $check (i64.eq (i64.reinterpret_f64 (f64.const -0)) (i64.const 0x8000000000000000))))
+
+  (start $start))
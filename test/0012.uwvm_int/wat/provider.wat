@@ -0,0 +1,11 @@
+(module
+  (memory (export "memory") 1)
+  (global (export "g") (mut i32) (i32.const 1))
+
+  (func (export "add") (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.add)
+
+  (func (export "bump")
+    (global.set 0 (i32.add (global.get 0) (i32.const 1)))))
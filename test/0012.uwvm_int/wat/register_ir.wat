@@ -0,0 +1,81 @@
+(module
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  ;; local.get a; local.get b; op; local.set c (both operands read from locals, result retargeted)
+  (func $mul_add (param i32 i32 i32) (result i32)
+    (local i32)
+    local.get 0
+    local.get 1
+    i32.mul
+    local.set 3
+    local.get 3
+    local.get 2
+    i32.add)
+
+  ;; the destination local is also a source
+  (func $sum_to (param i32) (result i32)
+    (local i32)
+    block
+      loop
+        local.get 0
+        i32.eqz
+        br_if 1
+        local.get 1
+        local.get 0
+        i32.add
+        local.set 1
+        local.get 0
+        i32.const 1
+        i32.sub
+        local.set 0
+        br 0
+      end
+    end
+    local.get 1)
+
+  ;; local.tee of an op result, then reused as a pending operand
+  (func $square_plus (param i64) (result i64)
+    (local i64)
+    local.get 0
+    local.get 0
+    i64.mul
+    local.tee 1
+    local.get 1
+    i64.add)
+
+  ;; a pending local.get below an operand already on the stack, plus dropped and copied locals
+  (func $mixed (param i32 i32) (result i32)
+    (local i32)
+    local.get 0
+    drop
+    local.get 1
+    local.set 2
+    local.get 0
+    i32.const 10
+    i32.add
+    local.get 2
+    i32.sub
+    local.get 0
+    local.set 0)
+
+  ;; a local is overwritten while an older read of it is still pending
+  (func $swap_sub (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    local.set 0
+    local.get 0
+    f64.sub)
+
+  (func $start
+    (call $check (i32.eq (call $mul_add (i32.const 6) (i32.const 7) (i32.const 8)) (i32.const 50)))
+    (call $check (i32.eq (call $sum_to (i32.const 100)) (i32.const 5050)))
+    (call $check (i64.eq (call $square_plus (i64.const 9)) (i64.const 162)))
+    (call $check (i32.eq (call $mixed (i32.const 5) (i32.const 3)) (i32.const 12)))
+    (call $check (f64.eq (call $swap_sub (f64.const 10) (f64.const 4)) (f64.const 6))))
+
+  (start $start))
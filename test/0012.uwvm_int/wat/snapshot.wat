@@ -0,0 +1,17 @@
+(module
+  (memory 1 4)
+  (global $initialized (mut i32) (i32.const 0))
+
+  ;; Runs once: in this run, or in the run that wrote the snapshot.
+  (func $init
+    (global.set $initialized (i32.add (global.get $initialized) (i32.const 1)))
+    (drop (memory.grow (i32.const 1)))
+    (i32.store (i32.const 0) (i32.const 42))
+    (i32.store (i32.const 65536) (i32.const 0x12345678)))
+  (start $init)
+
+  (func (export "_start")
+    (if (i32.ne (global.get $initialized) (i32.const 1)) (then unreachable))
+    (if (i32.ne (memory.size) (i32.const 2)) (then unreachable))
+    (if (i32.ne (i32.load (i32.const 0)) (i32.const 42)) (then unreachable))
+    (if (i32.ne (i32.load (i32.const 65536)) (i32.const 0x12345678)) (then unreachable))))
@@ -0,0 +1,97 @@
+(module
+  (memory 1)
+  (data (i32.const 16) "\01\00\00\00\02\00\00\00\03\00\00\00\04\00\00\00")
+
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  ;; local.get; i32.load / i32.const; i32.add / i32.const; i32.lt_u; br_if
+  (func $sum_words (param $p i32) (param $n i32) (result i32)
+    (local $i i32) (local $sum i32)
+    block
+      loop
+        local.get $i
+        local.get $n
+        i32.ge_u
+        br_if 1
+        local.get $sum
+        local.get $p
+        i32.load
+        i32.add
+        local.set $sum
+        local.get $p
+        i32.const 4
+        i32.add
+        local.set $p
+        local.get $i
+        i32.const 1
+        i32.add
+        local.tee $i
+        i32.const 100
+        i32.lt_u
+        br_if 0
+      end
+    end
+    local.get $sum)
+
+  ;; local.get; br_if and local.tee; br_if, the branches carry a value
+  (func $first_nonzero (param i32 i32) (result i32)
+    block (result i32)
+      local.get 0
+      local.get 0
+      br_if 0
+      drop
+      local.get 1
+      local.get 1
+      i32.const -1
+      i32.xor
+      local.tee 1
+      br_if 0
+      drop
+      i32.const 7
+    end)
+
+  ;; i32.eqz; br_if and an i64 compare; br_if
+  (func $classify (param i32 i64) (result i32)
+    block
+      local.get 0
+      i32.eqz
+      br_if 0
+      block
+        local.get 1
+        i64.const 0
+        i64.lt_s
+        br_if 0
+        i32.const 1
+        return
+      end
+      i32.const 2
+      return
+    end
+    i32.const 3)
+
+  ;; i32.const operand of an op whose result stays on the stack, and of a shift
+  (func $mix (param i32) (result i32)
+    local.get 0
+    i32.const 3
+    i32.shl
+    local.get 0
+    i32.const 1
+    i32.sub
+    i32.mul)
+
+  (func $start
+    (call $check (i32.eq (call $sum_words (i32.const 16) (i32.const 4)) (i32.const 10)))
+    (call $check (i32.eq (call $first_nonzero (i32.const 5) (i32.const 0)) (i32.const 5)))
+    (call $check (i32.eq (call $first_nonzero (i32.const 0) (i32.const 9)) (i32.const 9)))
+    (call $check (i32.eq (call $first_nonzero (i32.const 0) (i32.const -1)) (i32.const 7)))
+    (call $check (i32.eq (call $classify (i32.const 0) (i64.const 5)) (i32.const 3)))
+    (call $check (i32.eq (call $classify (i32.const 1) (i64.const -5)) (i32.const 2)))
+    (call $check (i32.eq (call $classify (i32.const 1) (i64.const 5)) (i32.const 1)))
+    (call $check (i32.eq (call $mix (i32.const 5)) (i32.const 160))))
+
+  (start $start))
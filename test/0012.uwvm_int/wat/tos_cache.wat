@@ -0,0 +1,87 @@
+(module
+  (func $check (param i32)
+    local.get 0
+    i32.eqz
+    if
+      unreachable
+    end)
+
+  (func $id (param i32) (result i32)
+    local.get 0)
+
+  ;; the first product is spilled when the second one takes the cache, the add reads its right operand from the cache
+  (func $dot2 (param i32 i32 i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.mul
+    local.get 2
+    local.get 3
+    i32.mul
+    i32.add)
+
+  ;; a chain of ops passing one cached value through f32, f64 and i64
+  (func $mixed_chain (param f32 f64 i64) (result i64)
+    local.get 0
+    f32.neg
+    f64.promote_f32
+    local.get 1
+    f64.add
+    i64.trunc_f64_s
+    local.get 2
+    i64.add
+    i64.const 1
+    i64.shl)
+
+  ;; i32.const; op with a cached left operand, then a br_if on a cached condition
+  (func $scale_until (param i32) (result i32)
+    block
+      loop
+        local.get 0
+        i32.const 3
+        i32.mul
+        local.tee 0
+        i32.const 100
+        i32.gt_u
+        br_if 1
+        br 0
+      end
+    end
+    local.get 0)
+
+  ;; the cached value has to be in its slot before a call and before a block
+  (func $across_call (param i32 i32) (result i32)
+    local.get 0
+    local.get 1
+    i32.sub
+    local.get 1
+    call $id
+    i32.mul)
+
+  (func $across_block (param f64 f64) (result f64)
+    local.get 0
+    local.get 1
+    f64.mul
+    block (result f64)
+      local.get 1
+    end
+    f64.sub)
+
+  ;; stack form consts are pushed above the cached value, which is spilled for the op that ignores it
+  (func $under_consts (param i32) (result i32)
+    local.get 0
+    i32.eqz
+    i64.const 5
+    i64.const 3
+    i64.sub
+    i32.wrap_i64
+    i32.add)
+
+  (func $start
+    (call $check (i32.eq (call $dot2 (i32.const 2) (i32.const 3) (i32.const 4) (i32.const 5)) (i32.const 26)))
+    (call $check (i64.eq (call $mixed_chain (f32.const 1.5) (f64.const 10) (i64.const 4)) (i64.const 24)))
+    (call $check (i32.eq (call $scale_until (i32.const 2)) (i32.const 162)))
+    (call $check (i32.eq (call $across_call (i32.const 9) (i32.const 4)) (i32.const 20)))
+    (call $check (f64.eq (call $across_block (f64.const 3) (f64.const 0.5)) (f64.const 1)))
+    (call $check (i32.eq (call $under_consts (i32.const 0)) (i32.const 3))))
+
+  (start $start))
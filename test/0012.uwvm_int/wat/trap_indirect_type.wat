@@ -0,0 +1,10 @@
+(module
+  (type $v (func))
+  (type $i (func (param i32)))
+  (table 2 funcref)
+  (elem (i32.const 0) $f)
+  (func $f (type $v))
+  (func $start
+    ;; signature mismatch
+    (call_indirect (type $i) (i32.const 0) (i32.const 0)))
+  (start $start))
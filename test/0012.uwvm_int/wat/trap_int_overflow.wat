@@ -0,0 +1,4 @@
+(module
+  (func $start
+    (drop (i32.div_s (i32.const 0x80000000) (i32.const -1))))
+  (start $start))
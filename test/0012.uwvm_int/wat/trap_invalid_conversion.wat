@@ -0,0 +1,4 @@
+(module
+  (func $start
+    (drop (i32.trunc_f32_s (f32.const nan))))
+  (start $start))
@@ -0,0 +1,6 @@
+(module
+  (type $v (func))
+  (table 2 funcref)
+  (func $start
+    (call_indirect (type $v) (i32.const 1)))
+  (start $start))
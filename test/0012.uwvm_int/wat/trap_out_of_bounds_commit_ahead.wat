@@ -0,0 +1,8 @@
+(module
+  (memory 1)
+  (func $start
+    ;; Pages committed ahead of the grown length are still out of bounds.
+    (drop (memory.grow (i32.const 1)))
+    (i32.store (i32.const 131068) (i32.const 1))
+    (i32.store (i32.const 131072) (i32.const 1)))
+  (start $start))
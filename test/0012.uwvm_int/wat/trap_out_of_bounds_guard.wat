@@ -0,0 +1,8 @@
+(module
+  (memory 1)
+  (func $start
+    ;; Grown pages are accessible, the largest effective address is not.
+    (drop (memory.grow (i32.const 1)))
+    (i32.store (i32.const 131068) (i32.const 1))
+    (i64.store offset=4294967295 (i32.const -1) (i64.const 0)))
+  (start $start))
@@ -0,0 +1,4 @@
+(module
+  (func $f
+    call $f)
+  (start $f))
@@ -87,6 +87,21 @@ function def_build()
 		add_defines("UWVM_USE_DEFAULT_JIT")
 	elseif enable_jit == "llvm" then
 		add_defines("UWVM_USE_LLVM_JIT")
+
+		-- The llvm jit engine (src/uwvm2/compiler/jit/llvm_jit) links against the LLVM found by llvm-config, set LLVM_CONFIG to use another one.
+		on_load(
+			function (target)
+				local llvm_config = os.getenv("LLVM_CONFIG") or "llvm-config"
+				target:add("sysincludedirs", os.iorun(llvm_config .. " --includedir"):trim())
+				target:add("ldflags", os.iorun(llvm_config .. " --ldflags"):trim(), {force = true})
+				for _, flag in ipairs(os.iorun(llvm_config .. " --libs core orcjit passes native"):trim():split("%s+")) do
+					target:add("ldflags", flag, {force = true})
+				end
+				for _, flag in ipairs(os.iorun(llvm_config .. " --system-libs"):trim():split("%s+")) do
+					target:add("ldflags", flag, {force = true})
+				end
+			end
+		)
 	end
 
     local detailed_debug_check = get_config("detailed-debug-check")
@@ -277,6 +292,14 @@ target("uwvm")
         -- wasm parser
 		add_files("src/uwvm2/parser/**.cppm", {public = is_debug_mode})
 
+		-- compiler (uwvm-int)
+		add_files("src/uwvm2/compiler/uwvm_int/**.cppm", {public = is_debug_mode})
+
+		-- compiler (llvm jit)
+		if get_config("enable-jit") == "llvm" then
+			add_files("src/uwvm2/compiler/jit/**.cppm", {public = is_debug_mode})
+		end
+
 		-- uwvm
 		add_files("src/uwvm2/uwvm/**.cppm", {public = is_debug_mode})
 	end 
@@ -339,6 +362,14 @@ for _, file in ipairs(os.files("test/**.cc")) do
 			-- wasm parser
 			add_files("src/uwvm2/parser/**.cppm", {public = is_debug_mode})
 
+			-- compiler (uwvm-int)
+			add_files("src/uwvm2/compiler/uwvm_int/**.cppm", {public = is_debug_mode})
+
+			-- compiler (llvm jit)
+			if get_config("enable-jit") == "llvm" then
+				add_files("src/uwvm2/compiler/jit/**.cppm", {public = is_debug_mode})
+			end
+
 			-- uwvm
 			add_files("src/uwvm2/uwvm/**.cppm", {public = is_debug_mode})
 		end 